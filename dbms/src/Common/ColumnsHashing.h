@@ -84,6 +84,33 @@ struct HashMethodOneNumber
 };
 
 
+/// For the case when there is one numeric key and all the keys fall into a range of at most 65536 values.
+/// The low 16 bits of such keys are distinct, so they are used as the key of a FixedHashMap.
+template <typename Value, typename Mapped, typename FieldType>
+struct HashMethodOneNumberLowBits
+    : public columns_hashing_impl::HashMethodBase<HashMethodOneNumberLowBits<Value, Mapped, FieldType>, Value, Mapped, false>
+{
+    using Self = HashMethodOneNumberLowBits<Value, Mapped, FieldType>;
+    using Base = columns_hashing_impl::HashMethodBase<Self, Value, Mapped, false>;
+
+    const FieldType * vec;
+
+    HashMethodOneNumberLowBits(const ColumnRawPtrs & key_columns, const Sizes & /*key_sizes*/, const TiDB::TiDBCollators &)
+    {
+        vec = &static_cast<const ColumnVector<FieldType> *>(key_columns[0])->getData()[0];
+    }
+
+    using Base::emplaceKey;
+    using Base::findKey;
+    using Base::getHash;
+
+    ALWAYS_INLINE inline UInt16 getKeyHolder(size_t row, Arena *, std::vector<String> &) const
+    {
+        return static_cast<UInt16>(unalignedLoad<FieldType>(vec + row));
+    }
+};
+
+
 /// For the case when there is one string key.
 template <typename Value, typename Mapped, bool place_string_to_arena = true, bool use_cache = true>
 struct HashMethodString
@@ -81,6 +81,9 @@ namespace DB
     M(tiflash_coprocessor_request_handle_seconds, "Bucketed histogram of request handle duration", Histogram,                                       \
         F(type_cop, {{"type", "cop"}}, ExpBuckets{0.001, 2, 20}),                                                                                   \
         F(type_batch, {{"type", "batch"}}, ExpBuckets{0.001, 2, 20}))                                                                               \
+    M(tiflash_coprocessor_result_cache, "Total number of coprocessor result cache lookups and updates", Counter,                                    \
+        F(type_hit, {"type", "hit"}), F(type_miss, {"type", "miss"}), F(type_stale, {"type", "stale"}),                                             \
+        F(type_put, {"type", "put"}), F(type_skip_put, {"type", "skip_put"}))                                                                       \
     M(tiflash_coprocessor_response_bytes, "Total bytes of response body", Counter,                                                                  \
         F(type_cop, {{"type", "cop"}}),                                                                                                             \
         F(type_batch_cop, {{"type", "batch_cop"}}),                                                                                                 \
@@ -127,6 +130,10 @@ namespace DB
         F(type_raft_wait_index_duration, {{"type", "tmt_raft_wait_index_duration"}}, ExpBuckets{0.001, 2, 20}))                                     \
     M(tiflash_syncing_data_freshness, "The freshness of tiflash data with tikv data", Histogram,                                                    \
         F(type_syncing_data_freshness, {{"type", "data_freshness"}}, ExpBuckets{0.001, 2, 20}))                                                     \
+    M(tiflash_raft_async_learner_read_duration_seconds, "Bucketed histogram of each stage of async learner read", Histogram,                        \
+        F(type_read_index, {{"type", "read_index"}}, ExpBuckets{0.001, 2, 20}),                                                                     \
+        F(type_wait_index, {{"type", "wait_index"}}, ExpBuckets{0.001, 2, 20}),                                                                     \
+        F(type_total, {{"type", "total"}}, ExpBuckets{0.001, 2, 20}))                                                                               \
     M(tiflash_storage_read_tasks_count, "Total number of storage engine read tasks", Counter)                                                       \
     M(tiflash_storage_command_count, "Total number of storage's command, such as delete range / shutdown /startup", Counter,                        \
         F(type_delete_range, {"type", "delete_range"}), F(type_ingest, {"type", "ingest"}),                                                         \
@@ -211,6 +218,18 @@ namespace DB
         F(type_bg_write_alloc_bytes, {"type", "bg_write_alloc_bytes"}))                                                                             \
     M(tiflash_storage_rough_set_filter_rate, "Bucketed histogram of rough set filter rate", Histogram,                                              \
         F(type_dtfile_pack, {{"type", "dtfile_pack"}}, EqualWidthBuckets{0, 6, 20}))                                                                \
+    M(tiflash_storage_read_ahead_bytes, "Total bytes of the DTFile packs hinted to read ahead", Counter,                                            \
+        F(type_hint, {"type", "hint"}), F(type_hit, {"type", "hit"}), F(type_wasted, {"type", "wasted"}))                                           \
+    M(tiflash_storage_bitmap_filter_cache, "Total number of bitmap filter cache lookups and updates", Counter,                                      \
+        F(type_hit, {"type", "hit"}), F(type_miss, {"type", "miss"}), F(type_put, {"type", "put"}), F(type_skip_put, {"type", "skip_put"}))         \
+    M(tiflash_storage_checkpoint_data_bytes, "Total bytes of the page data in the checkpoints uploaded to the remote store", Counter,               \
+        F(type_data, {"type", "data"}), F(type_written, {"type", "written"}), F(type_deduplicated, {"type", "deduplicated"}))                       \
+    M(tiflash_storage_restore_duration_seconds, "Bucketed histogram of the duration of restoring DeltaMerge stores", Histogram,                     \
+        F(type_stable_files, {{"type", "stable_files"}}, ExpBuckets{0.001, 2, 20}),                                                                 \
+        F(type_page_storage, {{"type", "page_storage"}}, ExpBuckets{0.001, 2, 20}),                                                                 \
+        F(type_segment_meta, {{"type", "segment_meta"}}, ExpBuckets{0.001, 2, 20}),                                                                 \
+        F(type_segments, {{"type", "segments"}}, ExpBuckets{0.001, 2, 20}),                                                                         \
+        F(type_total, {{"type", "total"}}, ExpBuckets{0.001, 2, 20}))                                                                               \
     M(tiflash_disaggregated_object_lock_request_count, "Total number of S3 object lock/delete request", Counter,                                    \
         F(type_lock, {"type", "lock"}), F(type_delete, {"type", "delete"}),                                                                         \
         F(type_owner_changed, {"type", "owner_changed"}), F(type_error, {"type", "error"}),                                                         \
@@ -248,11 +267,14 @@ namespace DB
         F(type_write, {{"type", "write"}}, ExpBuckets{0.001, 2, 30}))                                                                               \
     M(tiflash_raft_write_data_to_storage_duration_seconds, "Bucketed histogram of writting region into storage layer", Histogram,                   \
         F(type_decode, {{"type", "decode"}}, ExpBuckets{0.0005, 2, 20}), F(type_write, {{"type", "write"}}, ExpBuckets{0.0005, 2, 20}))             \
+    M(tiflash_raft_write_combine_count, "Total number of combined writes of raft data into storage layer", Counter,                                 \
+        F(type_block, {"type", "block"}), F(type_write, {"type", "write"}))                                                                         \
     /* required by DBaaS */                                                                                                                         \
     M(tiflash_server_info, "Indicate the tiflash server info, and the value is the start timestamp (s).", Gauge,                                    \
         F(start_time, {"version", TiFlashBuildInfo::getReleaseVersion()}, {"hash", TiFlashBuildInfo::getGitHash()}))                                \
     M(tiflash_object_count, "Number of objects", Gauge,                                                                                             \
         F(type_count_of_establish_calldata, {"type", "count_of_establish_calldata"}),                                                               \
+        F(type_count_of_fetch_pages_calldata, {"type", "count_of_fetch_pages_calldata"}),                                                           \
         F(type_count_of_mpptunnel, {"type", "count_of_mpptunnel"}))                                                                                 \
     M(tiflash_thread_count, "Number of threads", Gauge,                                                                                             \
         F(type_max_threads_of_thdpool, {"type", "thread_pool_total_max"}),                                                                          \
@@ -279,7 +301,11 @@ namespace DB
         F(type_estimated_thread_usage, {"type", "estimated_thread_usage"}),                                                                         \
         F(type_thread_soft_limit, {"type", "thread_soft_limit"}),                                                                                   \
         F(type_thread_hard_limit, {"type", "thread_hard_limit"}),                                                                                   \
-        F(type_hard_limit_exceeded_count, {"type", "hard_limit_exceeded_count"}))                                                                   \
+        F(type_hard_limit_exceeded_count, {"type", "hard_limit_exceeded_count"}),                                                                   \
+        F(type_estimated_memory_usage, {"type", "estimated_memory_usage"}),                                                                         \
+        F(type_memory_limit, {"type", "memory_limit"}),                                                                                             \
+        F(type_memory_limit_exceeded_count, {"type", "memory_limit_exceeded_count"}),                                                               \
+        F(type_memory_limit_ignored_count, {"type", "memory_limit_ignored_count"}))                                                                 \
     M(tiflash_task_scheduler_waiting_duration_seconds, "Bucketed histogram of task waiting for scheduling duration", Histogram,                     \
         F(type_task_scheduler_waiting_duration, {{"type", "task_waiting_duration"}}, ExpBuckets{0.001, 2, 20}))                                     \
     M(tiflash_storage_read_thread_counter, "The counter of storage read thread", Counter,                                                           \
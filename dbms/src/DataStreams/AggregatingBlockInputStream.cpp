@@ -30,7 +30,7 @@ Block AggregatingBlockInputStream::readImpl()
     if (!executed)
     {
         executed = true;
-        AggregatedDataVariantsPtr data_variants = std::make_shared<AggregatedDataVariants>();
+        data_variants = std::make_shared<AggregatedDataVariants>();
 
         Aggregator::CancellationHook hook = [&]() {
             return this->isCancelled();
@@ -38,38 +38,29 @@ Block AggregatingBlockInputStream::readImpl()
         aggregator.setCancellationHook(hook);
         aggregator.initThresholdByAggregatedDataVariantsSize(1);
 
-        aggregator.execute(children.back(), *data_variants);
+        bypassed = aggregator.execute(children.back(), *data_variants);
+        if (!bypassed)
+            prepareAggregatedResult();
+    }
+
+    while (bypassed)
+    {
+        if (isCancelledOrThrowIfKilled())
+            return {};
 
-        if (!aggregator.hasSpilledData())
+        FilterPtr filter = nullptr;
+        Block block = children.back()->read(filter, /*return_filter=*/true);
+        if (!block)
         {
-            ManyAggregatedDataVariants many_data{data_variants};
-            auto merging_buckets = aggregator.mergeAndConvertToBlocks(many_data, final, 1);
-            if (!merging_buckets)
-            {
-                impl = std::make_unique<NullBlockInputStream>(aggregator.getHeader(final));
-            }
-            else
-            {
-                RUNTIME_CHECK(1 == merging_buckets->getConcurrency());
-                impl = std::make_unique<MergingAndConvertingBlockInputStream>(merging_buckets, 0, log->identifier());
-            }
+            /// All the source blocks are passed through, output the rows aggregated before bypassing.
+            bypassed = false;
+            prepareAggregatedResult();
+            break;
         }
-        else
-        {
-            /** If there are temporary files with partially-aggregated data on the disk,
-              *  then read and merge them, spending the minimum amount of memory.
-              */
 
-            if (!isCancelled())
-            {
-                /// Flush data in the RAM to disk also. It's easier than merging on-disk and RAM data.
-                if (!data_variants->empty())
-                    aggregator.spill(*data_variants);
-            }
-            aggregator.finishSpill();
-            BlockInputStreams input_streams = aggregator.restoreSpilledData();
-            impl = std::make_unique<MergingAggregatedMemoryEfficientBlockInputStream>(input_streams, params, final, 1, 1, log->identifier());
-        }
+        Block res = aggregator.convertToBypassBlock(block, filter);
+        if (res.rows() > 0)
+            return res;
     }
 
     if (isCancelledOrThrowIfKilled() || !impl)
@@ -78,4 +69,38 @@ Block AggregatingBlockInputStream::readImpl()
     return impl->read();
 }
 
+void AggregatingBlockInputStream::prepareAggregatedResult()
+{
+    if (!aggregator.hasSpilledData())
+    {
+        ManyAggregatedDataVariants many_data{data_variants};
+        auto merging_buckets = aggregator.mergeAndConvertToBlocks(many_data, final, 1);
+        if (!merging_buckets)
+        {
+            impl = std::make_unique<NullBlockInputStream>(aggregator.getHeader(final));
+        }
+        else
+        {
+            RUNTIME_CHECK(1 == merging_buckets->getConcurrency());
+            impl = std::make_unique<MergingAndConvertingBlockInputStream>(merging_buckets, 0, log->identifier());
+        }
+    }
+    else
+    {
+        /** If there are temporary files with partially-aggregated data on the disk,
+          *  then read and merge them, spending the minimum amount of memory.
+          */
+
+        if (!isCancelled())
+        {
+            /// Flush data in the RAM to disk also. It's easier than merging on-disk and RAM data.
+            if (!data_variants->empty())
+                aggregator.spill(*data_variants);
+        }
+        aggregator.finishSpill();
+        BlockInputStreams input_streams = aggregator.restoreSpilledData();
+        impl = std::make_unique<MergingAggregatedMemoryEfficientBlockInputStream>(input_streams, params, final, 1, 1, log->identifier());
+    }
+}
+
 } // namespace DB
@@ -53,6 +53,9 @@ public:
 protected:
     Block readImpl() override;
 
+    /// Prepare `impl` to output the aggregated data after all the source blocks are consumed.
+    void prepareAggregatedResult();
+
     LoggerPtr log;
 
     Aggregator::Params params;
@@ -60,6 +63,10 @@ protected:
     bool final;
 
     bool executed = false;
+    /// The aggregation is bypassed, the remaining source blocks are converted and output directly.
+    bool bypassed = false;
+
+    AggregatedDataVariantsPtr data_variants;
 
     /** From here we will get the completed blocks after the aggregation. */
     std::unique_ptr<IBlockInputStream> impl;
@@ -82,6 +82,13 @@ void BlockStreamProfileInfo::update(Block & block)
     bytes += block.bytes();
 }
 
+void BlockStreamProfileInfo::update(Block & block, size_t selected_rows)
+{
+    ++blocks;
+    rows += selected_rows;
+    bytes += block.bytes();
+}
+
 
 void BlockStreamProfileInfo::collectInfosForStreamsWithName(const char * name, BlockStreamProfileInfos & res) const
 {
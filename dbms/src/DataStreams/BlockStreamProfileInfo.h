@@ -63,6 +63,8 @@ struct BlockStreamProfileInfo
     bool hasAppliedLimit() const;
 
     void update(Block & block);
+    /// Only `selected_rows` rows of `block` are counted, used when a filter is returned with the block.
+    void update(Block & block, size_t selected_rows);
 
     void updateExecutionTime(UInt64 time) { execution_time += time; }
 
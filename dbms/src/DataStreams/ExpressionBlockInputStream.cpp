@@ -42,4 +42,16 @@ Block ExpressionBlockInputStream::readImpl()
     expression->execute(res);
     return res;
 }
+
+Block ExpressionBlockInputStream::readImpl(FilterPtr & res_filter, bool return_filter)
+{
+    if (!return_filter || !expression->isProjectionOnly())
+        return readImpl();
+
+    Block res = children.back()->read(res_filter, return_filter);
+    if (!res)
+        return res;
+    expression->execute(res);
+    return res;
+}
 } // namespace DB
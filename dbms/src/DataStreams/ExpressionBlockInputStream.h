@@ -44,6 +44,11 @@ public:
 protected:
     Block readImpl() override;
 
+    // The filter of the child is passed through only when the expression is a pure projection,
+    // otherwise the functions would be evaluated on the rows to be filtered out.
+    // The projection may drop the filter column, the filter is held by the child until its next read.
+    Block readImpl(FilterPtr & res_filter, bool return_filter) override;
+
 private:
     ExpressionActionsPtr expression;
     const LoggerPtr log;
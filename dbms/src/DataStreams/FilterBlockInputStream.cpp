@@ -33,8 +33,10 @@ FilterBlockInputStream::FilterBlockInputStream(
     const BlockInputStreamPtr & input,
     const ExpressionActionsPtr & expression_,
     const String & filter_column_name,
-    const String & req_id)
+    const String & req_id,
+    std::optional<double> min_selectivity_to_defer_)
     : filter_transform_action(input->getHeader(), expression_, filter_column_name)
+    , min_selectivity_to_defer(min_selectivity_to_defer_)
     , log(Logger::get(req_id))
 {
     children.push_back(input);
@@ -63,7 +65,12 @@ Block FilterBlockInputStream::readImpl(FilterPtr & res_filter, bool return_filte
         if (!res)
             return res;
 
-        if (filter_transform_action.transform(res, res_filter, return_filter))
+        if (return_filter && min_selectivity_to_defer)
+        {
+            if (filter_transform_action.transformWithSelection(res, res_filter, *min_selectivity_to_defer))
+                return res;
+        }
+        else if (filter_transform_action.transform(res, res_filter, return_filter))
             return res;
     }
 }
@@ -17,6 +17,8 @@
 #include <DataStreams/FilterTransformAction.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
 
+#include <optional>
+
 namespace DB
 {
 using FilterPtr = IColumn::Filter *;
@@ -37,7 +39,8 @@ public:
         const BlockInputStreamPtr & input,
         const ExpressionActionsPtr & expression_,
         const String & filter_column_name_,
-        const String & req_id);
+        const String & req_id,
+        std::optional<double> min_selectivity_to_defer_ = std::nullopt);
 
     String getName() const override { return NAME; }
     Block getHeader() const override;
@@ -51,10 +54,15 @@ protected:
 
     // Note: When return_filter is true, res_filter will be point to the filter column of the returned block.
     // If res_filter is nullptr, it means the filter conditions are always true.
+    // If min_selectivity_to_defer is set, the filter is only returned when enough rows are selected,
+    // sparser blocks are filtered here and returned with res_filter = nullptr. Otherwise the filter is
+    // always returned, which is required by the consumers reading the other columns by the filter.
+    // The rows filtered out by the returned filter are not counted in the profile info.
     Block readImpl(FilterPtr & res_filter, bool return_filter) override;
 
 private:
     FilterTransformAction filter_transform_action;
+    const std::optional<double> min_selectivity_to_defer;
 
     const LoggerPtr log;
 };
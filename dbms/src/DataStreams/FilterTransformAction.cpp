@@ -84,8 +84,6 @@ bool FilterTransformAction::transform(Block & block, FilterPtr & res_filter, boo
         return true;
     }
 
-    size_t columns = block.columns();
-    size_t rows = block.rows();
     ColumnPtr column_of_filter = block.safeGetByPosition(filter_column).column;
 
     /** It happens that at the stage of analysis of expressions (in sample_block) the columns-constants have not been calculated yet,
@@ -111,7 +109,9 @@ bool FilterTransformAction::transform(Block & block, FilterPtr & res_filter, boo
     {
         FilterDescription filter_and_holder(*column_of_filter);
         filter = const_cast<IColumn::Filter *>(filter_and_holder.data);
-        filter_holder = filter_and_holder.data_holder;
+        // The filter may point into the filter column itself, hold the column so that the returned filter
+        // stays valid when the downstream drops the column from the block, e.g. a projection.
+        filter_holder = filter_and_holder.data_holder ? filter_and_holder.data_holder : column_of_filter;
     }
 
     if (return_filter)
@@ -126,6 +126,45 @@ bool FilterTransformAction::transform(Block & block, FilterPtr & res_filter, boo
     if (filtered_rows == 0)
         return false;
 
+    filterBlock(block, filtered_rows);
+    return true;
+}
+
+bool FilterTransformAction::transformWithSelection(Block & block, FilterPtr & res_filter, double min_selectivity)
+{
+    res_filter = nullptr;
+    FilterPtr selection = nullptr;
+    if (!transform(block, selection, /*return_filter=*/true) || !block || !selection)
+        return true;
+
+    size_t rows = block.rows();
+    size_t filtered_rows = countBytesInFilter(*selection);
+
+    /// If the current block is completely filtered out, let's move on to the next one.
+    if (filtered_rows == 0)
+        return false;
+
+    /// All the rows pass through the filter, no need to hand it out.
+    if (filtered_rows == rows)
+        return true;
+
+    /// Evaluating the downstream expressions on the filtered out rows and skipping them one by one
+    /// is only cheaper than copying the selected rows of every column when most of the rows are kept.
+    if (static_cast<double>(filtered_rows) >= min_selectivity * rows)
+    {
+        res_filter = selection;
+        return true;
+    }
+
+    filterBlock(block, filtered_rows);
+    return true;
+}
+
+void FilterTransformAction::filterBlock(Block & block, size_t filtered_rows)
+{
+    size_t columns = block.columns();
+    size_t rows = block.rows();
+
     /// If all the rows pass through the filter.
     if (filtered_rows == rows)
     {
@@ -133,7 +172,7 @@ bool FilterTransformAction::transform(Block & block, FilterPtr & res_filter, boo
         block.safeGetByPosition(filter_column).column
             = block.safeGetByPosition(filter_column).type->createColumnConst(filtered_rows, UInt64(1));
         /// No need to touch the rest of the columns.
-        return true;
+        return;
     }
 
     /// Filter the rest of the columns.
@@ -157,7 +196,5 @@ bool FilterTransformAction::transform(Block & block, FilterPtr & res_filter, boo
         else
             current_column.column = current_column.column->filter(*filter, filtered_rows);
     }
-
-    return true;
 }
 } // namespace DB
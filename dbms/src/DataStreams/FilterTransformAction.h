@@ -35,10 +35,16 @@ public:
     // When return_filter is true, res_filter will be set to the filter column.
     // Always return true, and when filter conditions are always true, set res_filter = nullptr.
     bool transform(Block & block, FilterPtr & res_filter, bool return_filter);
+    // Like transform with return_filter = true, but only hand out the filter when at least
+    // `min_selectivity` of the rows are selected, otherwise the block is filtered here and
+    // res_filter is set to nullptr. Return false if all filter out.
+    bool transformWithSelection(Block & block, FilterPtr & res_filter, double min_selectivity);
     Block getHeader() const;
     ExpressionActionsPtr getExperssion() const;
 
 private:
+    void filterBlock(Block & block, size_t filtered_rows);
+
     Block header;
     ExpressionActionsPtr expression;
     size_t filter_column;
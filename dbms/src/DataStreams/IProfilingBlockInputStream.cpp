@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Columns/ColumnsCommon.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
 #include <Interpreters/ProcessList.h>
 #include <Interpreters/Quota.h>
@@ -77,7 +78,11 @@ Block IProfilingBlockInputStream::read(FilterPtr & res_filter, bool return_filte
 
     if (res)
     {
-        info.update(res);
+        /// The rows filtered out by the returned filter are not a part of the result.
+        if (return_filter && res_filter)
+            info.update(res, countBytesInFilter(*res_filter));
+        else
+            info.update(res);
 
         if (enabled_extremes)
             updateExtremes(res);
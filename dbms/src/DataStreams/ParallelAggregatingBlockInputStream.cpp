@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Columns/ColumnsCommon.h>
 #include <Common/FmtUtils.h>
 #include <DataStreams/IBlockOutputStream.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
@@ -131,15 +132,16 @@ Block ParallelAggregatingBlockInputStream::readImpl()
     return impl->read();
 }
 
-void ParallelAggregatingBlockInputStream::Handler::onBlock(Block & block, size_t thread_num)
+void ParallelAggregatingBlockInputStream::Handler::onBlock(Block & block, const IColumn::Filter * filter, size_t thread_num)
 {
     parent.aggregator.executeOnBlock(
         block,
         *parent.many_data[thread_num],
         parent.threads_data[thread_num].key_columns,
-        parent.threads_data[thread_num].aggregate_columns);
+        parent.threads_data[thread_num].aggregate_columns,
+        filter);
 
-    parent.threads_data[thread_num].src_rows += block.rows();
+    parent.threads_data[thread_num].src_rows += filter ? countBytesInFilter(*filter) : block.rows();
     parent.threads_data[thread_num].src_bytes += block.bytes();
 }
 
@@ -104,7 +104,7 @@ private:
             : parent(parent_)
         {}
 
-        void onBlock(Block & block, size_t thread_num);
+        void onBlock(Block & block, const IColumn::Filter * filter, size_t thread_num);
         void onFinishThread(size_t thread_num);
         void onFinish();
         void onException(std::exception_ptr & exception, size_t thread_num);
@@ -117,7 +117,7 @@ private:
     };
 
     Handler handler;
-    ParallelInputsProcessor<Handler> processor;
+    ParallelInputsProcessor<Handler, StreamUnionMode::Selection> processor;
 
 
     void execute();
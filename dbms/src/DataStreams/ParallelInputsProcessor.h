@@ -54,7 +54,8 @@ namespace DB
 enum class StreamUnionMode
 {
     Basic = 0, /// take out blocks
-    ExtraInfo /// take out blocks + additional information
+    ExtraInfo, /// take out blocks + additional information
+    Selection /// take out blocks + the filter not applied to them yet
 };
 
 /// Example of the handler.
@@ -66,6 +67,9 @@ struct ParallelInputsHandler
     /// Processing the data block + additional information.
     void onBlock(Block & /*block*/, BlockExtraInfo & /*extra_info*/, size_t /*thread_num*/) {}
 
+    /// Processing the data block + the filter of its rows, nullptr means all rows are selected.
+    void onBlock(Block & /*block*/, const IColumn::Filter * /*filter*/, size_t /*thread_num*/) {}
+
     /// Called for each thread, when the thread has nothing else to do.
     /// Due to the fact that part of the sources has run out, and now there are fewer sources left than streams.
     /// Called if the `onException` method does not throw an exception; is called before the `onFinish` method.
@@ -237,10 +241,12 @@ private:
         }
     }
 
-    void publishPayload(BlockInputStreamPtr & stream, Block & block, size_t thread_num)
+    void publishPayload(BlockInputStreamPtr & stream, Block & block, const IColumn::Filter * filter, size_t thread_num)
     {
         if constexpr (mode == StreamUnionMode::Basic)
             handler.onBlock(block, thread_num);
+        else if constexpr (mode == StreamUnionMode::Selection)
+            handler.onBlock(block, filter, thread_num);
         else
         {
             BlockExtraInfo extra_info = stream->getBlockExtraInfo();
@@ -291,6 +297,9 @@ private:
         }
 
         InputData input;
+        /// The filter returned by a stream is only valid until its next read, but the stream
+        /// may be read by another thread as soon as it is pushed back, so keep a copy of it.
+        IColumn::Filter selection;
 
         while (work.unprepared_inputs.tryPop(input) == MPMCQueueResult::OK)
         {
@@ -304,12 +313,25 @@ private:
         while (work.available_inputs.pop(input) == MPMCQueueResult::OK)
         {
             /// The main work.
-            Block block = input.in->read();
+            Block block;
+            const IColumn::Filter * filter = nullptr;
+            if constexpr (mode == StreamUnionMode::Selection)
+            {
+                FilterPtr res_filter = nullptr;
+                block = input.in->read(res_filter, /*return_filter=*/true);
+                if (res_filter)
+                {
+                    selection.assign(res_filter->begin(), res_filter->end());
+                    filter = &selection;
+                }
+            }
+            else
+                block = input.in->read();
 
             if (block)
             {
                 work.available_inputs.push(input);
-                publishPayload(input.in, block, thread_num);
+                publishPayload(input.in, block, filter, thread_num);
             }
             else
             {
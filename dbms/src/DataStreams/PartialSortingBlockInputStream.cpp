@@ -15,6 +15,7 @@
 #include <Common/FmtUtils.h>
 #include <DataStreams/PartialSortingBlockInputStream.h>
 #include <Interpreters/sortBlock.h>
+#include <common/logger_useful.h>
 
 
 namespace DB
@@ -22,12 +23,37 @@ namespace DB
 Block PartialSortingBlockInputStream::readImpl()
 {
     Block res = children.back()->read();
+    if (!topn_threshold)
+    {
+        sortBlock(res, description, limit);
+        return res;
+    }
+
+    const auto & column_name = description[0].column_name;
+    while (res)
+    {
+        filtered_rows += topn_threshold->filterBlock(res, column_name);
+        if (res.rows() > 0)
+            break;
+        // All rows are filtered out, try the next block.
+        res = children.back()->read();
+    }
     sortBlock(res, description, limit);
+    if (res)
+        topn_threshold->update(*res.getByName(column_name).column);
     return res;
 }
 
+void PartialSortingBlockInputStream::readSuffixImpl()
+{
+    if (topn_threshold)
+        LOG_DEBUG(log, "{} rows are filtered out by the threshold of TopN", filtered_rows);
+}
+
 void PartialSortingBlockInputStream::appendInfo(FmtBuffer & buffer) const
 {
     buffer.fmtAppend(": limit = {}", limit);
+    if (topn_threshold)
+        buffer.append(", with threshold");
 }
 } // namespace DB
@@ -16,6 +16,7 @@
 
 #include <Core/SortDescription.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
+#include <DataStreams/TopNThreshold.h>
 
 namespace DB
 {
@@ -28,13 +29,17 @@ class PartialSortingBlockInputStream : public IProfilingBlockInputStream
 
 public:
     /// limit - if not 0, then you can sort each block not completely, but only `limit` first rows by order.
+    /// topn_threshold - if not null, the rows after the threshold are filtered out before sorting,
+    ///                  and the threshold is updated by the sorted blocks.
     PartialSortingBlockInputStream(
         const BlockInputStreamPtr & input_,
         const SortDescription & description_,
         const String & req_id,
-        size_t limit_ = 0)
+        size_t limit_ = 0,
+        const TopNThresholdPtr & topn_threshold_ = nullptr)
         : description(description_)
         , limit(limit_)
+        , topn_threshold(topn_threshold_)
         , log(Logger::get(req_id))
     {
         children.push_back(input_);
@@ -50,11 +55,14 @@ public:
 
 protected:
     Block readImpl() override;
+    void readSuffixImpl() override;
     void appendInfo(FmtBuffer & buffer) const override;
 
 private:
     SortDescription description;
     size_t limit;
+    TopNThresholdPtr topn_threshold;
+    size_t filtered_rows = 0;
     LoggerPtr log;
 };
 
@@ -0,0 +1,69 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DataStreams/TopNThreshold.h>
+
+namespace DB
+{
+void TopNThreshold::update(const IColumn & sorted_column)
+{
+    // The first `limit` rows are enough to fill the result of TopN.
+    if (limit == 0 || sorted_column.size() < limit)
+        return;
+
+    const size_t candidate = limit - 1;
+    std::lock_guard lock(mu);
+    if (threshold && direction() * sorted_column.compareAt(candidate, 0, *threshold, nulls_direction) >= 0)
+        return;
+    threshold = sorted_column.cut(candidate, 1);
+    threshold_field = sorted_column[candidate];
+}
+
+std::optional<Field> TopNThreshold::get() const
+{
+    std::lock_guard lock(mu);
+    if (!threshold)
+        return std::nullopt;
+    return threshold_field;
+}
+
+size_t TopNThreshold::filterBlock(Block & block, const String & column_name) const
+{
+    ColumnPtr current;
+    {
+        std::lock_guard lock(mu);
+        current = threshold;
+    }
+    if (!current || !block)
+        return 0;
+
+    const size_t rows = block.rows();
+    const auto column = block.getByName(column_name).column->convertToFullColumnIfConst();
+    IColumn::Filter filter(rows);
+    size_t passed_rows = 0;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        // Keep the rows equal to the threshold, they may be chosen by the TopN.
+        filter[i] = direction() * column->compareAt(i, 0, *current, nulls_direction) <= 0;
+        passed_rows += filter[i];
+    }
+    if (passed_rows == rows)
+        return 0;
+
+    for (auto & col : block)
+        col.column = col.column->filter(filter, passed_rows);
+    return rows - passed_rows;
+}
+
+} // namespace DB
@@ -0,0 +1,79 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Columns/IColumn.h>
+#include <Core/Block.h>
+#include <Core/Field.h>
+#include <Core/SortDescription.h>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace DB
+{
+/// The threshold of a TopN ordered by a single column, which is the `limit`-th value of the rows
+/// seen so far. Any row after the threshold in the order of the TopN can not be in the result.
+///
+/// It is shared by all the streams of the TopN and the table scan below it: the streams of the
+/// TopN publish the threshold after sorting a block, and use it to filter the rows before sorting;
+/// the table scan uses it to skip the packs that all rows are after the threshold.
+/// Like TiDB, NULL is less than any other value.
+class TopNThreshold
+{
+public:
+    TopNThreshold(size_t limit_, bool desc_)
+        : limit(limit_)
+        , desc(desc_)
+    {}
+
+    /// Only the TopN ordered by a single column without collation is supported.
+    static bool isSupported(const SortDescription & description)
+    {
+        return description.size() == 1 && !description[0].collator;
+    }
+
+    size_t getLimit() const { return limit; }
+
+    bool isDesc() const { return desc; }
+
+    /// `sorted_column` is the order by column of a block sorted by the TopN.
+    /// The threshold is updated only if it becomes tighter.
+    void update(const IColumn & sorted_column);
+
+    /// Return std::nullopt if no threshold has been published.
+    std::optional<Field> get() const;
+
+    /// Remove the rows of `block` after the threshold, return the number of rows removed.
+    size_t filterBlock(Block & block, const String & column_name) const;
+
+private:
+    int direction() const { return desc ? -1 : 1; }
+
+    static constexpr int nulls_direction = -1;
+
+    const size_t limit;
+    const bool desc;
+
+    mutable std::mutex mu;
+    // A column with one row, which is the threshold.
+    ColumnPtr threshold;
+    Field threshold_field;
+};
+
+using TopNThresholdPtr = std::shared_ptr<TopNThreshold>;
+
+} // namespace DB
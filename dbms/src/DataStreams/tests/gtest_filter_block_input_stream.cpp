@@ -0,0 +1,72 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataStreams/ExpressionBlockInputStream.h>
+#include <DataStreams/FilterBlockInputStream.h>
+#include <Functions/FunctionFactory.h>
+#include <Interpreters/ExpressionActions.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+namespace DB
+{
+namespace tests
+{
+class FilterBlockInputStreamTest : public ::testing::Test
+{
+};
+
+TEST_F(FilterBlockInputStreamTest, ReturnFilterThroughProjection)
+try
+{
+    BlocksList blocks;
+    blocks.push_back(Block{createColumn<Int64>({1, 5, 3, 7}, "a")});
+    blocks.push_back(Block{createColumn<Int64>({6, 2}, "a")});
+    auto source = std::make_shared<BlocksListBlockInputStream>(std::move(blocks));
+
+    // a > 2, the filter column is generated by the expression for every block.
+    auto context = TiFlashTestEnv::getContext();
+    auto filter_expr = std::make_shared<ExpressionActions>(source->getHeader().getColumnsWithTypeAndName());
+    filter_expr->add(ExpressionAction::addColumn(createConstColumn<Int64>(1, 2, "c")));
+    filter_expr->add(ExpressionAction::applyFunction(FunctionFactory::instance().get("greater", *context), {"a", "c"}, "f"));
+    auto filter_stream = std::make_shared<FilterBlockInputStream>(source, filter_expr, "f", "test", /*min_selectivity_to_defer_=*/0.0);
+
+    // The projection drops the filter column, the returned filter must stay valid.
+    auto project_expr = std::make_shared<ExpressionActions>(filter_stream->getHeader().getColumnsWithTypeAndName());
+    project_expr->add(ExpressionAction::project(Names{"a"}));
+    ASSERT_TRUE(project_expr->isProjectionOnly());
+    auto stream = std::make_shared<ExpressionBlockInputStream>(filter_stream, project_expr, "test");
+
+    std::vector<std::vector<UInt8>> expected_filters{{0, 1, 1, 1}, {1, 0}};
+    stream->readPrefix();
+    for (const auto & expected_filter : expected_filters)
+    {
+        FilterPtr filter = nullptr;
+        Block block = stream->read(filter, true);
+        ASSERT_TRUE(block);
+        ASSERT_EQ(block.columns(), 1);
+        ASSERT_NE(filter, nullptr);
+        ASSERT_EQ(std::vector<UInt8>(filter->begin(), filter->end()), expected_filter);
+    }
+    FilterPtr filter = nullptr;
+    ASSERT_FALSE(stream->read(filter, true));
+    stream->readSuffix();
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -0,0 +1,110 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataStreams/PartialSortingBlockInputStream.h>
+#include <DataStreams/TopNThreshold.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+namespace DB
+{
+namespace tests
+{
+class TopNThresholdTest : public ::testing::Test
+{
+};
+
+TEST_F(TopNThresholdTest, Update)
+try
+{
+    TopNThreshold threshold(3, /*desc*/ false);
+    ASSERT_FALSE(threshold.get().has_value());
+
+    // Not enough rows.
+    threshold.update(*createColumn<Int64>({1, 2}).column);
+    ASSERT_FALSE(threshold.get().has_value());
+
+    threshold.update(*createColumn<Int64>({1, 5, 7}).column);
+    ASSERT_EQ(threshold.get()->safeGet<Int64>(), 7);
+    // Only a tighter threshold is taken.
+    threshold.update(*createColumn<Int64>({1, 2, 8}).column);
+    ASSERT_EQ(threshold.get()->safeGet<Int64>(), 7);
+    threshold.update(*createColumn<Int64>({1, 2, 3, 4}).column);
+    ASSERT_EQ(threshold.get()->safeGet<Int64>(), 3);
+
+    TopNThreshold desc_threshold(2, /*desc*/ true);
+    desc_threshold.update(*createColumn<Int64>({9, 5}).column);
+    ASSERT_EQ(desc_threshold.get()->safeGet<Int64>(), 5);
+    desc_threshold.update(*createColumn<Int64>({9, 4}).column);
+    ASSERT_EQ(desc_threshold.get()->safeGet<Int64>(), 5);
+    desc_threshold.update(*createColumn<Int64>({10, 6}).column);
+    ASSERT_EQ(desc_threshold.get()->safeGet<Int64>(), 6);
+}
+CATCH
+
+TEST_F(TopNThresholdTest, FilterBlock)
+try
+{
+    {
+        TopNThreshold threshold(2, /*desc*/ false);
+        Block block{createColumn<Nullable<Int64>>({5, {}, 1, 3}, "a"), createColumn<String>({"a", "b", "c", "d"}, "b")};
+        // No threshold yet.
+        ASSERT_EQ(threshold.filterBlock(block, "a"), 0);
+        ASSERT_EQ(block.rows(), 4);
+
+        threshold.update(*createColumn<Nullable<Int64>>({1, 3}).column);
+        // NULL is less than any other value, the rows equal to the threshold are kept.
+        ASSERT_EQ(threshold.filterBlock(block, "a"), 1);
+        ASSERT_COLUMN_EQ(block.getByName("a"), createColumn<Nullable<Int64>>({{}, 1, 3}));
+        ASSERT_COLUMN_EQ(block.getByName("b"), createColumn<String>({"b", "c", "d"}));
+    }
+    {
+        TopNThreshold threshold(2, /*desc*/ true);
+        Block block{createColumn<Nullable<Int64>>({5, {}, 1, 3}, "a")};
+        threshold.update(*createColumn<Nullable<Int64>>({5, 3}).column);
+        ASSERT_EQ(threshold.filterBlock(block, "a"), 2);
+        ASSERT_COLUMN_EQ(block.getByName("a"), createColumn<Nullable<Int64>>({5, 3}));
+    }
+}
+CATCH
+
+TEST_F(TopNThresholdTest, PartialSorting)
+try
+{
+    auto threshold = std::make_shared<TopNThreshold>(2, /*desc*/ false);
+    SortDescription description{SortColumnDescription("a", 1, -1)};
+    ASSERT_TRUE(TopNThreshold::isSupported(description));
+
+    BlocksList blocks;
+    blocks.emplace_back(Block{createColumn<Int64>({4, 3, 6}, "a")});
+    // All rows are after the threshold 4.
+    blocks.emplace_back(Block{createColumn<Int64>({7, 5}, "a")});
+    blocks.emplace_back(Block{createColumn<Int64>({8, 1, 4}, "a")});
+    PartialSortingBlockInputStream stream(std::make_shared<BlocksListBlockInputStream>(std::move(blocks)), description, "PartialSorting", 2, threshold);
+
+    stream.readPrefix();
+    Block res = stream.read();
+    ASSERT_COLUMN_EQ(res.getByName("a"), createColumn<Int64>({3, 4}));
+    ASSERT_EQ(threshold->get()->safeGet<Int64>(), 4);
+    res = stream.read();
+    ASSERT_COLUMN_EQ(res.getByName("a"), createColumn<Int64>({1, 4}));
+    ASSERT_FALSE(stream.read());
+    stream.readSuffix();
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -286,10 +286,13 @@ void functionToPB(const DAGSchema & input, ASTFunction * func, tipb::Expr * expr
         return;
     }
     case tipb::ScalarFuncSig::IfInt:
+    case tipb::ScalarFuncSig::CaseWhenInt:
     case tipb::ScalarFuncSig::BitAndSig:
     case tipb::ScalarFuncSig::BitOrSig:
     case tipb::ScalarFuncSig::BitXorSig:
     case tipb::ScalarFuncSig::BitNegSig:
+    {
+        const bool is_if = it_sig->second == tipb::ScalarFuncSig::IfInt || it_sig->second == tipb::ScalarFuncSig::CaseWhenInt;
         expr->set_sig(it_sig->second);
         expr->set_tp(tipb::ExprType::ScalarFunc);
         for (size_t i = 0; i < func->arguments->children.size(); i++)
@@ -298,11 +301,11 @@ void functionToPB(const DAGSchema & input, ASTFunction * func, tipb::Expr * expr
             tipb::Expr * child = expr->add_children();
             astToPB(input, child_ast, child, collator_id, context);
             // todo should infer the return type based on all input types
-            if ((it_sig->second == tipb::ScalarFuncSig::IfInt && i == 1)
-                || (it_sig->second != tipb::ScalarFuncSig::IfInt && i == 0))
+            if ((is_if && i == 1) || (!is_if && i == 0))
                 *(expr->mutable_field_type()) = child->field_type();
         }
         return;
+    }
     case tipb::ScalarFuncSig::PlusInt:
     case tipb::ScalarFuncSig::MinusInt:
     {
@@ -542,20 +545,23 @@ TiDB::ColumnInfo compileFunction(const DAGSchema & input, ASTFunction * func)
         }
         return ci;
     case tipb::ScalarFuncSig::IfInt:
+    case tipb::ScalarFuncSig::CaseWhenInt:
     case tipb::ScalarFuncSig::BitAndSig:
     case tipb::ScalarFuncSig::BitOrSig:
     case tipb::ScalarFuncSig::BitXorSig:
     case tipb::ScalarFuncSig::BitNegSig:
+    {
+        const bool is_if = it_sig->second == tipb::ScalarFuncSig::IfInt || it_sig->second == tipb::ScalarFuncSig::CaseWhenInt;
         for (size_t i = 0; i < func->arguments->children.size(); i++)
         {
             const auto & child_ast = func->arguments->children[i];
             auto child_ci = compileExpr(input, child_ast);
             // todo should infer the return type based on all input types
-            if ((it_sig->second == tipb::ScalarFuncSig::IfInt && i == 1)
-                || (it_sig->second != tipb::ScalarFuncSig::IfInt && i == 0))
+            if ((is_if && i == 1) || (!is_if && i == 0))
                 ci = child_ci;
         }
         return ci;
+    }
     case tipb::ScalarFuncSig::PlusInt:
     case tipb::ScalarFuncSig::MinusInt:
         return compileExpr(input, func->arguments->children[0]);
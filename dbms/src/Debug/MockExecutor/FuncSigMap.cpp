@@ -34,6 +34,7 @@ std::unordered_map<String, tipb::ScalarFuncSig> func_name_to_sig({
     {"isnull", tipb::ScalarFuncSig::IntIsNull},
     {"date_format", tipb::ScalarFuncSig::DateFormatSig},
     {"if", tipb::ScalarFuncSig::IfInt},
+    {"case_when", tipb::ScalarFuncSig::CaseWhenInt},
     {"from_unixtime", tipb::ScalarFuncSig::FromUnixTime2Arg},
     /// bit_and/bit_or/bit_xor is aggregated function in clickhouse/mysql
     {"bitand", tipb::ScalarFuncSig::BitAndSig},
@@ -36,6 +36,10 @@ struct CompressedSeekableReaderBuffer : public BufferWithOwnMemory<ReadBuffer>
 
     virtual void seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block) = 0;
 
+    /// Hint the OS to read the compressed data in [offset_in_compressed_file, offset_in_compressed_file + size)
+    /// in background. Return the number of bytes hinted.
+    virtual size_t prefetch(size_t offset_in_compressed_file, size_t size) = 0;
+
     CompressedSeekableReaderBuffer()
         : BufferWithOwnMemory<ReadBuffer>(0)
     {}
@@ -87,6 +91,11 @@ public:
 
     size_t readBig(char * to, size_t n) override;
 
+    size_t prefetch(size_t offset_in_compressed_file, size_t size) override
+    {
+        return file_in.prefetch(offset_in_compressed_file, size);
+    }
+
     void setProfileCallback(
         const ReadBufferFromFileBase::ProfileCallback & profile_callback_,
         clockid_t clock_type_ = CLOCK_MONOTONIC_COARSE) override
@@ -19,6 +19,8 @@
 #include <Flash/Coprocessor/DAGContext.h>
 #include <Interpreters/Context.h>
 
+#include <unordered_set>
+
 namespace DB::AggregationInterpreterHelper
 {
 namespace
@@ -32,6 +34,15 @@ bool isFinalAggMode(const tipb::Expr & expr)
     return expr.aggfuncmode() == tipb::AggFunctionMode::FinalMode || expr.aggfuncmode() == tipb::AggFunctionMode::CompleteMode;
 }
 
+/// Aggregating a single row by these functions gets a valid partial result, which can be merged by the final aggregation.
+bool isBypassable(const AggregateDescriptions & aggregate_descriptions)
+{
+    static const std::unordered_set<String> bypassable_functions{"count", "sum", "min", "max", "first_row", "any"};
+    return std::all_of(aggregate_descriptions.begin(), aggregate_descriptions.end(), [](const auto & descr) {
+        return !descr.function->isState() && bypassable_functions.count(descr.function->getName()) > 0;
+    });
+}
+
 bool isAllowToUseTwoLevelGroupBy(size_t before_agg_streams_size, const Settings & settings)
 {
     /** Two-level aggregation is useful in two cases:
@@ -97,7 +108,7 @@ Aggregator::Params buildParams(
 
     bool has_collator = std::any_of(begin(collators), end(collators), [](const auto & p) { return p != nullptr; });
 
-    return Aggregator::Params(
+    Aggregator::Params params(
         before_agg_header,
         keys,
         aggregate_descriptions,
@@ -110,6 +121,25 @@ Aggregator::Params buildParams(
         spill_config,
         context.getSettingsRef().max_block_size,
         has_collator ? collators : TiDB::dummy_collators);
+    params.max_dense_key_range = settings.max_dense_group_by_key_range;
+    return params;
+}
+
+void setupBypass(
+    Aggregator::Params & params,
+    const Context & context,
+    const String & executor_id,
+    bool is_final_agg)
+{
+    const Settings & settings = context.getSettingsRef();
+    auto * dag_context = context.getDAGContext();
+    if (is_final_agg || settings.agg_bypass_check_rows == 0 || params.keys_size == 0
+        || !dag_context || !dag_context->isMPPTask() || !isBypassable(params.aggregates))
+        return;
+
+    params.bypass_check_rows = settings.agg_bypass_check_rows;
+    params.bypass_groups_ratio = settings.agg_bypass_groups_ratio;
+    params.bypass_rows = dag_context->getAggExecuteInfoMap()[executor_id].bypass_rows;
 }
 
 void fillArgColumnNumbers(AggregateDescriptions & aggregate_descriptions, const Block & before_agg_header)
@@ -44,6 +44,17 @@ Aggregator::Params buildParams(
     bool is_final_agg,
     const SpillConfig & spill_config);
 
+/// Enable the bypass of the partial aggregation in MPP if all the aggregate functions support it,
+/// the number of bypassed rows is recorded for `executor_id`.
+/// Only for `AggregatingBlockInputStream`, which streams the bypassed rows out directly. The parallel and
+/// pipeline aggregations can not output any row before the whole build finishes, the bypassed rows would
+/// be held in memory without being spilled, so they never bypass.
+void setupBypass(
+    Aggregator::Params & params,
+    const Context & context,
+    const String & executor_id,
+    bool is_final_agg);
+
 void fillArgColumnNumbers(AggregateDescriptions & aggregate_descriptions, const Block & before_agg_header);
 } // namespace AggregationInterpreterHelper
 } // namespace DB
@@ -0,0 +1,186 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/SipHash.h>
+#include <Common/TiFlashMetrics.h>
+#include <Flash/Coprocessor/CopResultCache.h>
+#include <Flash/Coprocessor/RequestUtils.h>
+#include <Interpreters/Context.h>
+#include <Storages/RegionQueryInfo.h>
+#include <Storages/Transaction/KVStore.h>
+#include <Storages/Transaction/LearnerRead.h>
+#include <Storages/Transaction/Region.h>
+#include <Storages/Transaction/TMTContext.h>
+
+namespace DB
+{
+std::optional<UInt128> CopResultCache::getKey(const coprocessor::Request & request, const tipb::DAGRequest & dag_request)
+{
+    if (request.ranges().empty())
+        return std::nullopt;
+
+    // The start ts may be passed by the fallback field in the DAG request, exclude it from the key.
+    tipb::DAGRequest normalized_dag_request = dag_request;
+    normalized_dag_request.clear_start_ts_fallback();
+
+    SipHash hash;
+    hash.update(normalized_dag_request.SerializeAsString());
+    hash.update(request.tp());
+    hash.update(request.schema_ver());
+    for (const auto & range : request.ranges())
+    {
+        hash.update(range.start());
+        hash.update(range.end());
+    }
+
+    const auto & kv_context = request.context();
+    hash.update(kv_context.region_id());
+    hash.update(kv_context.region_epoch().version());
+    hash.update(kv_context.region_epoch().conf_ver());
+    hash.update(static_cast<Int32>(kv_context.isolation_level()));
+    hash.update(RequestUtils::deriveKeyspaceID(kv_context));
+
+    UInt128 key;
+    hash.get128(key.low, key.high);
+    return key;
+}
+
+std::optional<CopResultCache::RegionState> CopResultCache::getRegionState(TMTContext & tmt, RegionID region_id)
+{
+    auto region = tmt.getKVStore()->getRegion(region_id);
+    if (!region)
+        return std::nullopt;
+    return RegionState{region->appliedIndex(), region->getSnapshotEventFlag()};
+}
+
+bool CopResultCache::isValid(const CopResultCacheEntry & entry, UInt64 start_ts, const RegionState & state)
+{
+    // The writes committed before `entry.start_ts` may be invisible to an older request.
+    if (start_ts < entry.start_ts)
+        return false;
+    return state.applied_index == entry.applied_index && state.snapshot_event_flag == entry.snapshot_event_flag;
+}
+
+bool CopResultCache::canPut(
+    UInt64 start_ts,
+    const RegionState & state_before_read,
+    const RegionState & state_after_read,
+    UInt64 max_applied_commit_ts)
+{
+    // The region has applied some raft logs during the read, we don't know which version of data is read.
+    if (!(state_before_read == state_after_read))
+        return false;
+    // Otherwise a write with a commit ts in (start_ts, later start_ts] may have been applied, which
+    // is invisible to this request but visible to the later one.
+    // `Region::UNKNOWN_COMMIT_TS` is larger than any start ts, so such responses are never cached.
+    return start_ts >= max_applied_commit_ts;
+}
+
+bool CopResultCache::tryGet(
+    const UInt128 & key,
+    UInt64 start_ts,
+    const RegionInfo & region_info,
+    Context & context,
+    coprocessor::Response & response,
+    const LoggerPtr & log)
+{
+    auto entry = get(key);
+    if (!entry)
+    {
+        GET_METRIC(tiflash_coprocessor_result_cache, type_miss).Increment();
+        return false;
+    }
+    // Check the start ts before waiting for the region.
+    if (start_ts < entry->start_ts)
+    {
+        GET_METRIC(tiflash_coprocessor_result_cache, type_miss).Increment();
+        return false;
+    }
+
+    auto & tmt = context.getTMTContext();
+    auto region = tmt.getKVStore()->getRegion(region_info.region_id);
+    if (!region || region->version() != region_info.region_version || region->confVer() != region_info.region_conf_version)
+    {
+        // Let the normal read path handle and report the region error.
+        GET_METRIC(tiflash_coprocessor_result_cache, type_stale).Increment();
+        remove(key);
+        return false;
+    }
+
+    // Make sure the region has caught up with the leader for `start_ts` and there is no lock
+    // blocking the read, just like a normal read.
+    const auto physical_table_id = region->getMappedTableID();
+    MvccQueryInfo mvcc_query_info(/*resolve_locks=*/true, start_ts);
+    RegionQueryInfo info(region_info.region_id, region_info.region_version, region_info.region_conf_version, physical_table_id);
+    info.range_in_table = region->getRange()->rawKeys();
+    info.required_handle_ranges = region_info.key_ranges;
+    info.bypass_lock_ts = region_info.bypass_lock_ts;
+    mvcc_query_info.regions_query_info.emplace_back(std::move(info));
+    auto learner_read_snapshot = doLearnerRead(physical_table_id, mvcc_query_info, /*for_batch_cop=*/false, context, log);
+
+    auto state = getRegionState(tmt, region_info.region_id);
+    if (!state || !isValid(*entry, start_ts, *state))
+    {
+        GET_METRIC(tiflash_coprocessor_result_cache, type_stale).Increment();
+        remove(key);
+        return false;
+    }
+
+    if (!response.ParseFromString(entry->response))
+    {
+        LOG_WARNING(log, "Failed to parse the cached response, region_id={}", region_info.region_id);
+        remove(key);
+        return false;
+    }
+    GET_METRIC(tiflash_coprocessor_result_cache, type_hit).Increment();
+    return true;
+}
+
+void CopResultCache::tryPut(
+    const UInt128 & key,
+    UInt64 start_ts,
+    const RegionState & state_before_read,
+    TMTContext & tmt,
+    RegionID region_id,
+    const coprocessor::Response & response)
+{
+    if (response.has_region_error() || response.has_locked() || !response.other_error().empty())
+    {
+        GET_METRIC(tiflash_coprocessor_result_cache, type_skip_put).Increment();
+        return;
+    }
+
+    auto region = tmt.getKVStore()->getRegion(region_id);
+    if (!region)
+    {
+        GET_METRIC(tiflash_coprocessor_result_cache, type_skip_put).Increment();
+        return;
+    }
+    const RegionState state_after_read{region->appliedIndex(), region->getSnapshotEventFlag()};
+    if (!canPut(start_ts, state_before_read, state_after_read, region->maxAppliedCommitTs()))
+    {
+        GET_METRIC(tiflash_coprocessor_result_cache, type_skip_put).Increment();
+        return;
+    }
+
+    auto entry = std::make_shared<CopResultCacheEntry>();
+    entry->response = response.SerializeAsString();
+    entry->start_ts = start_ts;
+    entry->applied_index = state_after_read.applied_index;
+    entry->snapshot_event_flag = state_after_read.snapshot_event_flag;
+    set(key, entry);
+    GET_METRIC(tiflash_coprocessor_result_cache, type_put).Increment();
+}
+
+} // namespace DB
@@ -0,0 +1,122 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Common/Logger.h>
+#include <Flash/Coprocessor/RegionInfo.h>
+#include <Storages/Transaction/Types.h>
+#include <common/UInt128.h>
+#include <common/types.h>
+#include <kvproto/coprocessor.pb.h>
+#include <tipb/select.pb.h>
+
+#include <optional>
+
+namespace DB
+{
+class Context;
+class TMTContext;
+
+struct CopResultCacheEntry
+{
+    // The serialized `coprocessor::Response`.
+    String response;
+    // The start ts of the request that produced `response`.
+    UInt64 start_ts = 0;
+    // The state of the region when `response` is produced. If any of them is changed,
+    // the data of the region may be changed and the entry can not be used anymore.
+    UInt64 applied_index = 0;
+    UInt64 snapshot_event_flag = 0;
+};
+
+struct CopResultCacheWeightFunction
+{
+    size_t operator()(const CopResultCacheEntry & entry) const { return sizeof(CopResultCacheEntry) + entry.response.size(); }
+};
+
+/// Cache the responses of cop requests that read a single region.
+///
+/// The key is the hash of the DAG request and the region (id, epoch and key ranges), the
+/// start ts is excluded so that the same query sent with a newer ts can hit the cache.
+/// An entry is valid for a request with a larger or equal start ts if the region has not
+/// applied any raft log since the entry was produced. The entries are invalidated lazily,
+/// by comparing the applied index and snapshot flag of the region when looking up.
+///
+/// A response is only put into the cache if the request's start ts is not less than the max commit
+/// ts of the writes applied to the region, so that all the applied writes are visible to it, and so
+/// are they to any request with a larger start ts.
+class CopResultCache : public LRUCache<UInt128, CopResultCacheEntry, std::hash<UInt128>, CopResultCacheWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, CopResultCacheEntry, std::hash<UInt128>, CopResultCacheWeightFunction>;
+
+public:
+    struct RegionState
+    {
+        UInt64 applied_index;
+        UInt64 snapshot_event_flag;
+
+        bool operator==(const RegionState & rhs) const
+        {
+            return applied_index == rhs.applied_index && snapshot_event_flag == rhs.snapshot_event_flag;
+        }
+    };
+
+    explicit CopResultCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {}
+
+    /// Return std::nullopt if the result of the request can not be cached.
+    static std::optional<UInt128> getKey(const coprocessor::Request & request, const tipb::DAGRequest & dag_request);
+
+    /// Return std::nullopt if the region is not found in this store.
+    static std::optional<RegionState> getRegionState(TMTContext & tmt, RegionID region_id);
+
+    /// Whether `entry` can be used by the request of `start_ts` when the region is in `state`.
+    static bool isValid(const CopResultCacheEntry & entry, UInt64 start_ts, const RegionState & state);
+
+    /// Whether the response of the request of `start_ts` can be reused by the later requests.
+    static bool canPut(
+        UInt64 start_ts,
+        const RegionState & state_before_read,
+        const RegionState & state_after_read,
+        UInt64 max_applied_commit_ts);
+
+    /// Fill `response` and return true if there is a valid entry of `key` for `start_ts`.
+    /// Like a normal read, it waits for the region to catch up with the leader (read index)
+    /// and checks the locks, so it may throw `RegionException` or `LockException`.
+    bool tryGet(
+        const UInt128 & key,
+        UInt64 start_ts,
+        const RegionInfo & region_info,
+        Context & context,
+        coprocessor::Response & response,
+        const LoggerPtr & log);
+
+    /// Put the `response` produced by the request of `start_ts` into the cache if it is safe to
+    /// be reused. `state_before_read` is the state of the region before the request is executed.
+    void tryPut(
+        const UInt128 & key,
+        UInt64 start_ts,
+        const RegionState & state_before_read,
+        TMTContext & tmt,
+        RegionID region_id,
+        const coprocessor::Response & response);
+};
+
+using CopResultCachePtr = std::shared_ptr<CopResultCache>;
+
+} // namespace DB
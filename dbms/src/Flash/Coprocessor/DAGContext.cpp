@@ -205,6 +205,19 @@ std::unordered_map<String, BlockInputStreams> & DAGContext::getProfileStreamsMap
     return profile_streams_map;
 }
 
+void DAGContext::addOperatorProfileInfos(const String & executor_id, OperatorProfileInfos && profile_infos)
+{
+    std::lock_guard lock(operator_profile_infos_mu);
+    auto & infos = operator_profile_infos_map[executor_id];
+    infos.insert(infos.end(), profile_infos.begin(), profile_infos.end());
+}
+
+std::unordered_map<String, OperatorProfileInfos> DAGContext::getOperatorProfileInfosMap() const
+{
+    std::lock_guard lock(operator_profile_infos_mu);
+    return operator_profile_infos_map;
+}
+
 void DAGContext::updateFinalConcurrency(size_t cur_streams_size, size_t streams_upper_limit)
 {
     final_concurrency = std::min(std::max(final_concurrency, cur_streams_size), streams_upper_limit);
@@ -245,6 +258,11 @@ std::unordered_map<String, JoinExecuteInfo> & DAGContext::getJoinExecuteInfoMap(
     return join_execute_info_map;
 }
 
+std::unordered_map<String, AggExecuteInfo> & DAGContext::getAggExecuteInfoMap()
+{
+    return agg_execute_info_map;
+}
+
 std::unordered_map<String, BlockInputStreams> & DAGContext::getInBoundIOInputStreamsMap()
 {
     return inbound_io_input_streams_map;
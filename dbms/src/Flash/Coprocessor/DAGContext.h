@@ -31,6 +31,7 @@
 #include <Flash/Coprocessor/TablesRegionsInfo.h>
 #include <Flash/Mpp/MPPTaskId.h>
 #include <Interpreters/SubqueryForSet.h>
+#include <Operators/OperatorProfileInfo.h>
 #include <Parsers/makeDummyQuery.h>
 #include <Storages/DeltaMerge/Remote/DisaggTaskId.h>
 #include <Storages/DeltaMerge/ScanContext.h>
@@ -59,6 +60,12 @@ struct JoinExecuteInfo
     BlockInputStreams join_build_streams;
 };
 
+struct AggExecuteInfo
+{
+    /// The number of rows passed through by the bypassed partial aggregation.
+    std::shared_ptr<std::atomic<size_t>> bypass_rows = std::make_shared<std::atomic<size_t>>(0);
+};
+
 using MPPTunnelSetPtr = std::shared_ptr<MPPTunnelSet>;
 
 class ProcessListEntry;
@@ -144,9 +151,14 @@ public:
 
     std::unordered_map<String, BlockInputStreams> & getProfileStreamsMap();
 
+    /// The operators of a pipeline are built when the pipeline is scheduled, which may happen in different threads.
+    void addOperatorProfileInfos(const String & executor_id, OperatorProfileInfos && profile_infos);
+    std::unordered_map<String, OperatorProfileInfos> getOperatorProfileInfosMap() const;
+
     std::unordered_map<String, std::vector<String>> & getExecutorIdToJoinIdMap();
 
     std::unordered_map<String, JoinExecuteInfo> & getJoinExecuteInfoMap();
+    std::unordered_map<String, AggExecuteInfo> & getAggExecuteInfoMap();
     std::unordered_map<String, BlockInputStreams> & getInBoundIOInputStreamsMap();
     void handleTruncateError(const String & msg);
     void handleOverflowError(const String & msg, const TiFlashError & error);
@@ -335,11 +347,17 @@ private:
     TableLockHolders table_locks;
     /// profile_streams_map is a map that maps from executor_id to profile BlockInputStreams.
     std::unordered_map<String, BlockInputStreams> profile_streams_map;
+    /// operator_profile_infos_map is a map that maps from executor_id to the profile infos of operators, used in pipeline model.
+    mutable std::mutex operator_profile_infos_mu;
+    std::unordered_map<String, OperatorProfileInfos> operator_profile_infos_map;
     /// executor_id_to_join_id_map is a map that maps executor id to all the join executor id of itself and all its children.
     std::unordered_map<String, std::vector<String>> executor_id_to_join_id_map;
     /// join_execute_info_map is a map that maps from join_probe_executor_id to JoinExecuteInfo
     /// DAGResponseWriter / JoinStatistics gets JoinExecuteInfo through it.
     std::unordered_map<std::string, JoinExecuteInfo> join_execute_info_map;
+    /// agg_execute_info_map is a map that maps from aggregation executor_id to AggExecuteInfo
+    /// AggStatistics gets AggExecuteInfo through it.
+    std::unordered_map<std::string, AggExecuteInfo> agg_execute_info_map;
     /// profile_streams_map is a map that maps from executor_id (table_scan / exchange_receiver) to BlockInputStreams.
     /// BlockInputStreams contains ExchangeReceiverInputStream, CoprocessorBlockInputStream and local_read_input_stream etc.
     std::unordered_map<String, BlockInputStreams> inbound_io_input_streams_map;
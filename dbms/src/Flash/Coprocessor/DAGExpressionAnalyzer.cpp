@@ -1398,6 +1398,7 @@ String DAGExpressionAnalyzer::alignReturnType(
 
 void DAGExpressionAnalyzer::initChain(ExpressionActionsChain & chain) const
 {
+    chain.enable_short_circuit_evaluation = context.getSettingsRef().enable_short_circuit_evaluation;
     if (chain.steps.empty())
     {
         const auto & columns = getCurrentInputColumns();
@@ -293,6 +293,8 @@ void DAGQueryBlockInterpreter::handleJoin(const tipb::Join & join, DAGPipeline &
         match_helper_name,
         0,
         context.isTest());
+    join_ptr->setMaxDenseKeyRange(settings.max_dense_join_key_range);
+    join_ptr->setPartitionedBuild(settings.join_partitioned_build);
 
     recordJoinExecuteInfo(tiflash_join.build_side_index, join_ptr);
 
@@ -365,7 +367,7 @@ void DAGQueryBlockInterpreter::recordJoinExecuteInfo(size_t build_side_index, co
 void DAGQueryBlockInterpreter::executeWhere(DAGPipeline & pipeline, const ExpressionActionsPtr & expr, String & filter_column, const String & extra_info)
 {
     pipeline.transform([&](auto & stream) {
-        stream = std::make_shared<FilterBlockInputStream>(stream, expr, filter_column, log->identifier());
+        stream = std::make_shared<FilterBlockInputStream>(stream, expr, filter_column, log->identifier(), getMinSelectivityToDeferFilter(context));
         stream->setExtraInfo(extra_info);
     });
 }
@@ -429,6 +431,7 @@ void DAGQueryBlockInterpreter::executeAggregation(
 
     if (enable_fine_grained_shuffle)
     {
+        AggregationInterpreterHelper::setupBypass(params, context, query_block.aggregation_name, is_final_agg);
         /// Go straight forward without merging phase when enable_fine_grained_shuffle
         pipeline.transform([&](auto & stream) {
             stream = std::make_shared<AggregatingBlockInputStream>(
@@ -462,6 +465,7 @@ void DAGQueryBlockInterpreter::executeAggregation(
     else
     {
         assert(pipeline.streams.size() == 1);
+        AggregationInterpreterHelper::setupBypass(params, context, query_block.aggregation_name, is_final_agg);
         pipeline.firstStream() = std::make_shared<AggregatingBlockInputStream>(
             pipeline.firstStream(),
             params,
@@ -479,7 +483,8 @@ void DAGQueryBlockInterpreter::executeWindowOrder(DAGPipeline & pipeline, SortDe
 void DAGQueryBlockInterpreter::executeOrder(DAGPipeline & pipeline, const NamesAndTypes & order_columns)
 {
     Int64 limit = query_block.limit_or_topn->topn().limit();
-    orderStreams(pipeline, max_streams, getSortDescription(order_columns, query_block.limit_or_topn->topn().order_by()), limit, false, context, log);
+    auto order_descr = getSortDescription(order_columns, query_block.limit_or_topn->topn().order_by());
+    orderStreams(pipeline, max_streams, order_descr, limit, false, context, log, TopNThreshold::isSupported(order_descr) ? topn_threshold : nullptr);
 }
 
 void DAGQueryBlockInterpreter::recordProfileStreams(DAGPipeline & pipeline, const String & key)
@@ -627,6 +632,12 @@ void DAGQueryBlockInterpreter::executeImpl(DAGPipeline & pipeline)
     else if (query_block.isTableScanSource())
     {
         TiDBTableScan table_scan(query_block.source, query_block.source_name, dagContext());
+        // The Limit/TopN is executed on the rows read from table scan directly.
+        if (query_block.limit_or_topn && !query_block.selection && !query_block.aggregation)
+        {
+            if (table_scan.setLimitHint(*query_block.limit_or_topn, context.getSettingsRef().dt_enable_topn_threshold))
+                topn_threshold = table_scan.getTopNThreshold();
+        }
         if (unlikely(context.isTest()))
             handleMockTableScan(table_scan, pipeline);
         else
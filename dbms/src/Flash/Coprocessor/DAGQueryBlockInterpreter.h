@@ -105,6 +105,9 @@ private:
 
     std::unique_ptr<DAGExpressionAnalyzer> analyzer;
 
+    /// The threshold shared by the TopN and the table scan of this query block, see `TopNThreshold`.
+    TopNThresholdPtr topn_threshold;
+
     LoggerPtr log;
 };
 } // namespace DB
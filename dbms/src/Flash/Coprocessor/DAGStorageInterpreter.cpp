@@ -244,6 +244,27 @@ String genErrMsgForLocalRead(
             table_id,
             logical_table_id);
 }
+
+/// Whether the column type can be compared with the threshold of TopN by the min-max index.
+/// The value of the Timestamp column is casted after read, and the strings may have collation.
+bool canFilterByTopNThreshold(const TiDB::ColumnInfo & ci)
+{
+    switch (ci.tp)
+    {
+    case TiDB::TypeTiny:
+    case TiDB::TypeShort:
+    case TiDB::TypeInt24:
+    case TiDB::TypeLong:
+    case TiDB::TypeLongLong:
+    case TiDB::TypeFloat:
+    case TiDB::TypeDouble:
+    case TiDB::TypeDate:
+    case TiDB::TypeDatetime:
+        return true;
+    default:
+        return false;
+    }
+}
 } // namespace
 
 DAGStorageInterpreter::DAGStorageInterpreter(
@@ -376,12 +397,15 @@ void DAGStorageInterpreter::prepare()
     // TODO: If we can acquire a read-only view on the IStorage structure (both `ITableDeclaration`
     // and `TiDB::TableInfo`) we may get this process more simplified. (tiflash/issues/1853)
 
-    // Do learner read
-    const DAGContext & dag_context = *context.getDAGContext();
-    if (dag_context.isBatchCop() || dag_context.isMPPTask())
-        learner_read_snapshot = doBatchCopLearnerRead();
-    else
-        learner_read_snapshot = doCopLearnerRead();
+    // Do learner read, unless it has been done by `startLearnerRead` and `finishLearnerRead` in the pipeline model.
+    if (!learner_read_done)
+    {
+        if (isBatchCopOrMPP())
+            learner_read_snapshot = doBatchCopLearnerRead();
+        else
+            learner_read_snapshot = doCopLearnerRead();
+        learner_read_done = true;
+    }
 
     // Acquire read lock on `alter lock` and build the requested inputstreams
     storages_with_structure_lock = getAndLockStorages(context.getSettingsRef().schema_version);
@@ -497,7 +521,12 @@ void DAGStorageInterpreter::recordProfileStreams(DAGPipeline & pipeline, const S
     pipeline.transform([&profile_streams](auto & stream) { profile_streams.push_back(stream); });
 }
 
-LearnerReadSnapshot DAGStorageInterpreter::doCopLearnerRead()
+bool DAGStorageInterpreter::isBatchCopOrMPP() const
+{
+    return dagContext().isBatchCop() || dagContext().isMPPTask();
+}
+
+void DAGStorageInterpreter::makeCopRegionQueryInfos()
 {
     if (table_scan.isPartitionTableScan())
     {
@@ -518,13 +547,19 @@ LearnerReadSnapshot DAGStorageInterpreter::doCopLearnerRead()
 
     if (info_retry)
         throw RegionException({info_retry->begin()->get().region_id}, status);
+}
 
+LearnerReadSnapshot DAGStorageInterpreter::doCopLearnerRead()
+{
+    makeCopRegionQueryInfos();
     return doLearnerRead(logical_table_id, *mvcc_query_info, /*for_batch_cop=*/false, context, log);
 }
 
-/// Will assign region_retry_from_local_region
-LearnerReadSnapshot DAGStorageInterpreter::doBatchCopLearnerRead()
+bool DAGStorageInterpreter::makeBatchCopRegionQueryInfos()
 {
+    region_retry_from_local_region.clear();
+    mvcc_query_info->regions_query_info.clear();
+
     TablesRegionInfoMap regions_for_local_read;
     for (const auto physical_table_id : table_scan.getPhysicalTableIDs())
     {
@@ -532,51 +567,172 @@ LearnerReadSnapshot DAGStorageInterpreter::doBatchCopLearnerRead()
         regions_for_local_read.emplace(physical_table_id, std::cref(local_regions));
     }
     if (regions_for_local_read.empty())
-        return {};
-    std::unordered_set<RegionID> force_retry;
-    for (;;)
+        return false;
+
+    auto [retry, status] = MakeRegionQueryInfos(
+        regions_for_local_read,
+        force_retry,
+        tmt,
+        *mvcc_query_info,
+        true);
+    UNUSED(status);
+
+    if (retry)
     {
-        try
+        region_retry_from_local_region = std::move(*retry);
+        for (const auto & r : region_retry_from_local_region)
+            force_retry.emplace(r.get().region_id);
+    }
+    return !mvcc_query_info->regions_query_info.empty();
+}
+
+bool DAGStorageInterpreter::runBatchCopLearnerRead(const std::function<void()> & action)
+{
+    try
+    {
+        action();
+        return true;
+    }
+    catch (const LockException & e)
+    {
+        // We can also use current thread to resolve lock, but it will block next process.
+        // So, force this region retry in another thread in CoprocessorBlockInputStream.
+        force_retry.emplace(e.region_id);
+    }
+    catch (const RegionException & e)
+    {
+        if (tmt.checkShuttingDown())
+            throw TiFlashException("TiFlash server is terminating", Errors::Coprocessor::Internal);
+        // By now, RegionException will contain all region id of MvccQueryInfo, which is needed by CHSpark.
+        // When meeting RegionException, we can let MakeRegionQueryInfos to check in next loop.
+        force_retry.insert(e.unavailable_region.begin(), e.unavailable_region.end());
+    }
+    catch (DB::Exception & e)
+    {
+        e.addMessage(fmt::format("(while doing learner read for table, logical table_id: {})", logical_table_id));
+        throw;
+    }
+    return false;
+}
+
+LearnerReadSnapshot DAGStorageInterpreter::doBatchCopLearnerRead()
+{
+    force_retry.clear();
+    LearnerReadSnapshot snapshot;
+    while (!runBatchCopLearnerRead([&] {
+        snapshot.clear();
+        if (makeBatchCopRegionQueryInfos())
+            snapshot = doLearnerRead(logical_table_id, *mvcc_query_info, /*for_batch_cop=*/true, context, log);
+    }))
+    {
+    }
+    return snapshot;
+}
+
+bool DAGStorageInterpreter::startLearnerRead()
+{
+    RUNTIME_CHECK(!learner_read_done && async_learner_read == nullptr);
+    if (!isBatchCopOrMPP())
+    {
+        makeCopRegionQueryInfos();
+        async_learner_read = std::make_unique<AsyncLearnerRead>(logical_table_id, *mvcc_query_info, /*for_batch_cop=*/false, context, log);
+        return true;
+    }
+
+    bool has_local_region = false;
+    while (!runBatchCopLearnerRead([&] {
+        has_local_region = makeBatchCopRegionQueryInfos();
+        if (has_local_region)
+            async_learner_read = std::make_unique<AsyncLearnerRead>(logical_table_id, *mvcc_query_info, /*for_batch_cop=*/true, context, log);
+    }))
+    {
+    }
+    if (!has_local_region)
+        learner_read_done = true;
+    return has_local_region;
+}
+
+bool DAGStorageInterpreter::pollLearnerRead()
+{
+    RUNTIME_CHECK(async_learner_read != nullptr);
+    try
+    {
+        return async_learner_read->poll();
+    }
+    catch (DB::Exception & e)
+    {
+        if (isBatchCopOrMPP())
+            e.addMessage(fmt::format("(while doing learner read for table, logical table_id: {})", logical_table_id));
+        throw;
+    }
+}
+
+bool DAGStorageInterpreter::finishLearnerRead()
+{
+    RUNTIME_CHECK(async_learner_read != nullptr);
+    auto finish = [&] {
+        learner_read_snapshot = async_learner_read->finish();
+    };
+    bool done = true;
+    if (isBatchCopOrMPP())
+        done = runBatchCopLearnerRead(finish);
+    else
+        finish();
+    async_learner_read.reset();
+    learner_read_done = done;
+    return done;
+}
+
+void DAGStorageInterpreter::setReadLimitHint(SelectQueryInfo & query_info) const
+{
+    const auto & settings = context.getSettingsRef();
+    const auto limit = table_scan.getLimitHint();
+    // The filter is executed after the rows are read from storage, the number of rows needed is unknown.
+    if (limit == 0 || filter_conditions.hasValue())
+        return;
+
+    bool in_handle_order = false;
+    bool desc = false;
+    if (const auto column_index = table_scan.getLimitOrderColumnIndex(); column_index >= 0)
+    {
+        // The data is sorted by the handle in storage, a TopN ordered by other columns needs all the rows.
+        // The unsigned handle is stored as Int64, its order is different from the stored one.
+        const auto & ci = table_scan.getColumns()[column_index];
+        const auto pk_handle_col = storage_for_logical_table->getTableInfo().getPKHandleColumn();
+        const bool is_pk_handle = !storage_for_logical_table->isCommonHandle()
+            && (ci.id == TiDBPkColumnID || (pk_handle_col && pk_handle_col->get().id == ci.id));
+        const bool is_int_handle = is_pk_handle && !ci.hasUnsignedFlag();
+        if (!is_int_handle)
         {
-            region_retry_from_local_region.clear();
-            auto [retry, status] = MakeRegionQueryInfos(
-                regions_for_local_read,
-                force_retry,
-                tmt,
-                *mvcc_query_info,
-                true);
-            UNUSED(status);
-
-            if (retry)
+            // All the rows are needed, but the packs that all rows are after the threshold of TopN can be skipped.
+            if (!is_pk_handle && table_scan.getTopNThreshold() && settings.dt_enable_rough_set_filter && canFilterByTopNThreshold(ci))
             {
-                region_retry_from_local_region = std::move(*retry);
-                for (const auto & r : region_retry_from_local_region)
-                    force_retry.emplace(r.get().region_id);
+                query_info.topn_threshold = table_scan.getTopNThreshold();
+                query_info.topn_column_id = ci.id;
             }
-            if (mvcc_query_info->regions_query_info.empty())
-                return {};
-            return doLearnerRead(logical_table_id, *mvcc_query_info, /*for_batch_cop=*/true, context, log);
-        }
-        catch (const LockException & e)
-        {
-            // We can also use current thread to resolve lock, but it will block next process.
-            // So, force this region retry in another thread in CoprocessorBlockInputStream.
-            force_retry.emplace(e.region_id);
-        }
-        catch (const RegionException & e)
-        {
-            if (tmt.checkShuttingDown())
-                throw TiFlashException("TiFlash server is terminating", Errors::Coprocessor::Internal);
-            // By now, RegionException will contain all region id of MvccQueryInfo, which is needed by CHSpark.
-            // When meeting RegionException, we can let MakeRegionQueryInfos to check in next loop.
-            force_retry.insert(e.unavailable_region.begin(), e.unavailable_region.end());
-        }
-        catch (DB::Exception & e)
-        {
-            e.addMessage(fmt::format("(while doing learner read for table, logical table_id: {})", logical_table_id));
-            throw;
+            return;
         }
+        in_handle_order = true;
+        desc = table_scan.isLimitOrderDesc();
+    }
+    else if (table_scan.keepOrder())
+    {
+        // The rows are required in the order of handle, so the first rows of the limit should be in order too.
+        in_handle_order = true;
+        desc = table_scan.getTableScanPB()->tbl_scan().desc();
     }
+
+    if (!settings.dt_enable_read_limit_pushdown)
+        return;
+
+    // Reading in the order of handle only uses one stream, it is slower than reading all segments
+    // concurrently when the limit is large.
+    if (in_handle_order && limit > settings.dt_max_read_limit_in_handle_order)
+        return;
+
+    query_info.read_limit = limit;
+    query_info.read_in_handle_order = in_handle_order;
+    query_info.read_desc = desc;
 }
 
 std::unordered_map<TableID, SelectQueryInfo> DAGStorageInterpreter::generateSelectQueryInfos()
@@ -595,6 +751,7 @@ std::unordered_map<TableID, SelectQueryInfo> DAGStorageInterpreter::generateSele
         query_info.req_id = fmt::format("{} table_id={}", log->identifier(), table_id);
         query_info.keep_order = table_scan.keepOrder();
         query_info.is_fast_scan = table_scan.isFastScan();
+        setReadLimitHint(query_info);
         return query_info;
     };
     RUNTIME_CHECK_MSG(mvcc_query_info->scan_context != nullptr, "Unexpected null scan_context");
@@ -31,6 +31,8 @@
 #include <Storages/Transaction/Types.h>
 #include <pingcap/coprocessor/Client.h>
 
+#include <functional>
+#include <unordered_set>
 #include <vector>
 
 namespace DB
@@ -53,6 +55,15 @@ public:
 
     void execute(DAGPipeline & pipeline);
 
+    /// The non-blocking learner read used by the pipeline model, it should be done before `execute`.
+    /// - `startLearnerRead` sends the read index requests, return false if there is no local region to read.
+    /// - `pollLearnerRead` returns true once the read index and wait index are done, it is cheap enough for `WaitReactor`.
+    /// - `finishLearnerRead` resolves locks and takes the snapshot, return false if some regions must be
+    ///   retried by `startLearnerRead` again.
+    bool startLearnerRead();
+    bool pollLearnerRead();
+    bool finishLearnerRead();
+
     /// Members will be transferred to DAGQueryBlockInterpreter after execute
 
     std::unique_ptr<DAGExpressionAnalyzer> analyzer;
@@ -67,6 +78,17 @@ private:
 
     LearnerReadSnapshot doBatchCopLearnerRead();
 
+    bool isBatchCopOrMPP() const;
+
+    void makeCopRegionQueryInfos();
+
+    /// Will assign region_retry_from_local_region, return false if there is no region to read locally.
+    bool makeBatchCopRegionQueryInfos();
+
+    /// Run the learner read action of batch cop, return false if it should be retried because of
+    /// `LockException` or `RegionException`, the regions are added into `force_retry`.
+    bool runBatchCopLearnerRead(const std::function<void()> & action);
+
     bool checkRetriableForBatchCopOrMPP(
         const TableID & table_id,
         const SelectQueryInfo & query_info,
@@ -90,6 +112,8 @@ private:
 
     std::unordered_map<TableID, SelectQueryInfo> generateSelectQueryInfos();
 
+    void setReadLimitHint(SelectQueryInfo & query_info) const;
+
     DAGContext & dagContext() const;
 
     void recordProfileStreams(DAGPipeline & pipeline, const String & key);
@@ -128,6 +152,10 @@ private:
     std::unique_ptr<MvccQueryInfo> mvcc_query_info;
     // We need to validate regions snapshot after getting streams from storage.
     LearnerReadSnapshot learner_read_snapshot;
+    // The regions that should be read from other nodes by batch cop.
+    std::unordered_set<RegionID> force_retry;
+    AsyncLearnerReadPtr async_learner_read;
+    bool learner_read_done = false;
     /// Table from where to read data, if not subquery.
     /// Hold read lock on both `alter_lock` and `drop_lock` until the local input streams are created.
     /// We need an immutable structure to build the TableScan operator and create snapshot input streams
@@ -37,6 +37,35 @@ RemoteExecutionSummary getRemoteExecutionSummariesFromExchange(DAGContext & dag_
     }
     return exchange_execution_summary;
 }
+
+ExecutionSummary getLocalExecutionSummary(const BlockInputStreams & streams)
+{
+    ExecutionSummary current;
+    for (const auto & stream_ptr : streams)
+    {
+        if (auto * p_stream = dynamic_cast<IProfilingBlockInputStream *>(stream_ptr.get()))
+        {
+            current.time_processed_ns = std::max(current.time_processed_ns, p_stream->getProfileInfo().execution_time);
+            current.num_produced_rows += p_stream->getProfileInfo().rows;
+            current.num_iterations += p_stream->getProfileInfo().blocks;
+        }
+        ++current.concurrency;
+    }
+    return current;
+}
+
+ExecutionSummary getLocalExecutionSummary(const OperatorProfileInfos & profile_infos)
+{
+    ExecutionSummary current;
+    for (const auto & profile_info : profile_infos)
+    {
+        current.time_processed_ns = std::max(current.time_processed_ns, profile_info->execution_time);
+        current.num_produced_rows += profile_info->rows;
+        current.num_iterations += profile_info->blocks;
+        ++current.concurrency;
+    }
+    return current;
+}
 } // namespace
 
 void ExecutionSummaryCollector::fillTiExecutionSummary(
@@ -64,22 +93,10 @@ tipb::SelectResponse ExecutionSummaryCollector::genExecutionSummaryResponse()
 void ExecutionSummaryCollector::fillLocalExecutionSummary(
     tipb::SelectResponse & response,
     const String & executor_id,
-    const BlockInputStreams & streams,
+    ExecutionSummary & current,
     const std::unordered_map<String, DM::ScanContextPtr> & scan_context_map) const
 {
-    ExecutionSummary current;
     /// part 1: local execution info
-    // get execution info from streams
-    for (const auto & stream_ptr : streams)
-    {
-        if (auto * p_stream = dynamic_cast<IProfilingBlockInputStream *>(stream_ptr.get()))
-        {
-            current.time_processed_ns = std::max(current.time_processed_ns, p_stream->getProfileInfo().execution_time);
-            current.num_produced_rows += p_stream->getProfileInfo().rows;
-            current.num_iterations += p_stream->getProfileInfo().blocks;
-        }
-        ++current.concurrency;
-    }
     // get execution info from scan_context
     if (const auto & iter = scan_context_map.find(executor_id); iter != scan_context_map.end())
     {
@@ -118,19 +135,25 @@ void ExecutionSummaryCollector::addExecuteSummaries(tipb::SelectResponse & respo
         return;
 
     /// fill execution_summary for local executor
+    // get execution info from streams, or from operators in pipeline model.
+    std::unordered_map<String, ExecutionSummary> local_execution_summaries;
+    for (const auto & p : dag_context.getProfileStreamsMap())
+        local_execution_summaries.emplace(p.first, getLocalExecutionSummary(p.second));
+    for (const auto & p : dag_context.getOperatorProfileInfosMap())
+        local_execution_summaries.emplace(p.first, getLocalExecutionSummary(p.second));
+
     if (dag_context.return_executor_id)
     {
-        for (auto & p : dag_context.getProfileStreamsMap())
+        for (auto & p : local_execution_summaries)
             fillLocalExecutionSummary(response, p.first, p.second, dag_context.scan_context_map);
     }
     else
     {
-        const auto & profile_streams_map = dag_context.getProfileStreamsMap();
-        assert(profile_streams_map.size() == dag_context.list_based_executors_order.size());
+        assert(local_execution_summaries.size() == dag_context.list_based_executors_order.size());
         for (const auto & executor_id : dag_context.list_based_executors_order)
         {
-            auto it = profile_streams_map.find(executor_id);
-            assert(it != profile_streams_map.end());
+            auto it = local_execution_summaries.find(executor_id);
+            assert(it != local_execution_summaries.end());
             fillLocalExecutionSummary(response, executor_id, it->second, dag_context.scan_context_map);
         }
     }
@@ -43,7 +43,7 @@ private:
     void fillLocalExecutionSummary(
         tipb::SelectResponse & response,
         const String & executor_id,
-        const BlockInputStreams & streams,
+        ExecutionSummary & current,
         const std::unordered_map<String, DM::ScanContextPtr> & scan_context_map) const;
 
 private:
@@ -103,7 +103,8 @@ void orderStreams(
     Int64 limit,
     bool enable_fine_grained_shuffle,
     const Context & context,
-    const LoggerPtr & log)
+    const LoggerPtr & log,
+    const TopNThresholdPtr & topn_threshold)
 {
     const Settings & settings = context.getSettingsRef();
     String extra_info;
@@ -111,7 +112,7 @@ void orderStreams(
         extra_info = enableFineGrainedShuffleExtraInfo;
 
     pipeline.transform([&](auto & stream) {
-        stream = std::make_shared<PartialSortingBlockInputStream>(stream, order_descr, log->identifier(), limit);
+        stream = std::make_shared<PartialSortingBlockInputStream>(stream, order_descr, log->identifier(), limit, topn_threshold);
         stream->setExtraInfo(extra_info);
     });
 
@@ -200,6 +201,12 @@ std::tuple<ExpressionActionsPtr, String, ExpressionActionsPtr> buildPushDownFilt
     return {before_where, filter_column_name, project_after_where};
 }
 
+double getMinSelectivityToDeferFilter(const Context & context)
+{
+    // A value larger than 1 is kept as is, so that no filter is handed out and the rows are always filtered eagerly.
+    return std::max(static_cast<double>(context.getSettingsRef().min_selectivity_to_defer_filter), 0.0);
+}
+
 void executePushedDownFilter(
     size_t remote_read_streams_start_index,
     const FilterConditions & filter_conditions,
@@ -214,7 +221,12 @@ void executePushedDownFilter(
     for (size_t i = 0; i < remote_read_streams_start_index; ++i)
     {
         auto & stream = pipeline.streams[i];
-        stream = std::make_shared<FilterBlockInputStream>(stream, before_where, filter_column_name, log->identifier());
+        stream = std::make_shared<FilterBlockInputStream>(
+            stream,
+            before_where,
+            filter_column_name,
+            log->identifier(),
+            getMinSelectivityToDeferFilter(analyzer.getContext()));
         stream->setExtraInfo("push down filter");
         // after filter, do project action to keep the schema of local streams and remote streams the same.
         stream = std::make_shared<ExpressionBlockInputStream>(stream, project_after_where, log->identifier());
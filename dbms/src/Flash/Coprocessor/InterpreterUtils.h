@@ -16,6 +16,7 @@
 
 #include <Common/Logger.h>
 #include <Core/SortDescription.h>
+#include <DataStreams/TopNThreshold.h>
 #include <Flash/Coprocessor/DAGExpressionAnalyzer.h>
 #include <Flash/Coprocessor/DAGPipeline.h>
 #include <Flash/Coprocessor/FilterConditions.h>
@@ -60,7 +61,8 @@ void orderStreams(
     Int64 limit,
     bool enable_fine_grained_shuffle,
     const Context & context,
-    const LoggerPtr & log);
+    const LoggerPtr & log,
+    const TopNThresholdPtr & topn_threshold = nullptr);
 
 void executeCreatingSets(
     DAGPipeline & pipeline,
@@ -72,6 +74,10 @@ std::tuple<ExpressionActionsPtr, String, ExpressionActionsPtr> buildPushDownFilt
     const google::protobuf::RepeatedPtrField<tipb::Expr> & conditions,
     DAGExpressionAnalyzer & analyzer);
 
+/// The min ratio of selected rows for which a filter stream hands its filter to the consumer instead
+/// of filtering every column, see `min_selectivity_to_defer_filter`. A value larger than 1 means never defer.
+double getMinSelectivityToDeferFilter(const Context & context);
+
 void executePushedDownFilter(
     size_t remote_read_streams_start_index,
     const FilterConditions & filter_conditions,
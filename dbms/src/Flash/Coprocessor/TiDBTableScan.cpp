@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Flash/Coprocessor/DAGCodec.h>
 #include <Flash/Coprocessor/DAGContext.h>
 #include <Flash/Coprocessor/TiDBTableScan.h>
 
@@ -84,4 +85,39 @@ void TiDBTableScan::constructTableScanForRemoteRead(tipb::TableScan * tipb_table
         tipb_table_scan->set_table_id(table_id);
     }
 }
+
+bool TiDBTableScan::setLimitHint(const tipb::Executor & limit_or_topn, bool enable_topn_threshold)
+{
+    // The pushed down filters are executed after the rows are read from storage.
+    if (!pushed_down_filters.empty())
+        return false;
+
+    if (limit_or_topn.tp() == tipb::ExecType::TypeLimit)
+    {
+        limit_hint = limit_or_topn.limit().limit();
+        limit_order_column_index = -1;
+        limit_order_desc = false;
+        return limit_hint > 0;
+    }
+    if (limit_or_topn.tp() == tipb::ExecType::TypeTopN)
+    {
+        // Only the TopN ordered by a single column can be pushed down. Whether the column is the handle
+        // is checked by the storage interpreter.
+        const auto & topn = limit_or_topn.topn();
+        if (topn.order_by_size() != 1 || topn.order_by(0).expr().tp() != tipb::ExprType::ColumnRef)
+            return false;
+        auto column_index = decodeDAGInt64(topn.order_by(0).expr().val());
+        if (column_index < 0 || column_index >= getColumnSize())
+            return false;
+        limit_hint = topn.limit();
+        limit_order_column_index = column_index;
+        limit_order_desc = topn.order_by(0).desc();
+        if (limit_hint == 0)
+            return false;
+        if (enable_topn_threshold)
+            topn_threshold = std::make_shared<TopNThreshold>(limit_hint, limit_order_desc);
+        return true;
+    }
+    return false;
+}
 } // namespace DB
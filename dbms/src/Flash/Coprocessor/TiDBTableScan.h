@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <DataStreams/TopNThreshold.h>
 #include <Storages/Transaction/TypeMapping.h>
 #include <common/types.h>
 #include <tipb/executor.pb.h>
@@ -76,6 +77,34 @@ public:
         return pushed_down_filters;
     }
 
+    /// Push down the Limit/TopN directly above the table scan, so that the storage can stop reading
+    /// once enough rows are read. Return false if `limit_or_topn` can not be pushed down.
+    /// The caller should make sure that there is no filter between them.
+    /// If `enable_topn_threshold` is true, a `TopNThreshold` is created for the TopN, which should be
+    /// shared with the TopN so that the storage can skip the packs by it.
+    bool setLimitHint(const tipb::Executor & limit_or_topn, bool enable_topn_threshold);
+
+    UInt64 getLimitHint() const
+    {
+        return limit_hint;
+    }
+
+    /// The index of the column in `columns` that the TopN is ordered by, -1 means no order.
+    Int64 getLimitOrderColumnIndex() const
+    {
+        return limit_order_column_index;
+    }
+
+    bool isLimitOrderDesc() const
+    {
+        return limit_order_desc;
+    }
+
+    const TopNThresholdPtr & getTopNThreshold() const
+    {
+        return topn_threshold;
+    }
+
 private:
     const tipb::Executor * table_scan;
     String executor_id;
@@ -98,6 +127,11 @@ private:
 
     bool keep_order;
     bool is_fast_scan;
+
+    UInt64 limit_hint = 0;
+    Int64 limit_order_column_index = -1;
+    bool limit_order_desc = false;
+    TopNThresholdPtr topn_threshold;
 };
 
 } // namespace DB
@@ -0,0 +1,133 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Coprocessor/CopResultCache.h>
+#include <Storages/Transaction/Region.h>
+#include <gtest/gtest.h>
+
+namespace DB
+{
+namespace tests
+{
+namespace
+{
+coprocessor::Request makeRequest(UInt64 start_ts, const String & range_start, const String & range_end, UInt64 region_version)
+{
+    tipb::DAGRequest dag_request;
+    dag_request.set_start_ts_fallback(start_ts);
+    dag_request.add_output_offsets(0);
+    auto * executor = dag_request.add_executors();
+    executor->set_tp(tipb::ExecType::TypeTableScan);
+    executor->mutable_tbl_scan()->set_table_id(100);
+
+    coprocessor::Request request;
+    request.set_tp(103); // COP_REQ_TYPE_DAG
+    request.set_start_ts(start_ts);
+    request.set_data(dag_request.SerializeAsString());
+    auto * range = request.add_ranges();
+    range->set_start(range_start);
+    range->set_end(range_end);
+    auto * kv_context = request.mutable_context();
+    kv_context->set_region_id(10);
+    kv_context->mutable_region_epoch()->set_version(region_version);
+    kv_context->mutable_region_epoch()->set_conf_ver(1);
+    return request;
+}
+
+UInt128 getKey(const coprocessor::Request & request)
+{
+    tipb::DAGRequest dag_request;
+    dag_request.ParseFromString(request.data());
+    auto key = CopResultCache::getKey(request, dag_request);
+    EXPECT_TRUE(key.has_value());
+    return key.value_or(UInt128{});
+}
+} // namespace
+
+TEST(CopResultCacheTest, Key)
+{
+    const auto key = getKey(makeRequest(100, "a", "z", 1));
+    // The start ts is not a part of the key.
+    ASSERT_EQ(key, getKey(makeRequest(200, "a", "z", 1)));
+    // Different key ranges.
+    ASSERT_NE(key, getKey(makeRequest(100, "a", "y", 1)));
+    ASSERT_NE(key, getKey(makeRequest(100, "b", "z", 1)));
+    // Different region epoch.
+    ASSERT_NE(key, getKey(makeRequest(100, "a", "z", 2)));
+
+    // Different DAG.
+    auto request = makeRequest(100, "a", "z", 1);
+    tipb::DAGRequest dag_request;
+    dag_request.ParseFromString(request.data());
+    dag_request.add_output_offsets(1);
+    auto another_key = CopResultCache::getKey(request, dag_request);
+    ASSERT_TRUE(another_key.has_value());
+    ASSERT_NE(key, *another_key);
+
+    // Requests without any key range are not cached.
+    request.clear_ranges();
+    ASSERT_FALSE(CopResultCache::getKey(request, dag_request).has_value());
+}
+
+TEST(CopResultCacheTest, Weight)
+{
+    CopResultCache cache(1024);
+    auto entry = std::make_shared<CopResultCacheEntry>();
+    entry->response = String(100, 'a');
+    cache.set(UInt128(1), entry);
+    ASSERT_EQ(cache.weight(), sizeof(CopResultCacheEntry) + 100);
+
+    // Exceeds the limit, the older entry is evicted.
+    auto large_entry = std::make_shared<CopResultCacheEntry>();
+    large_entry->response = String(900, 'b');
+    cache.set(UInt128(2), large_entry);
+    ASSERT_EQ(cache.get(UInt128(1)), nullptr);
+    ASSERT_NE(cache.get(UInt128(2)), nullptr);
+}
+
+TEST(CopResultCacheTest, Staleness)
+{
+    CopResultCacheEntry entry;
+    entry.start_ts = 100;
+    entry.applied_index = 10;
+    entry.snapshot_event_flag = 1;
+
+    ASSERT_TRUE(CopResultCache::isValid(entry, 100, {10, 1}));
+    ASSERT_TRUE(CopResultCache::isValid(entry, 200, {10, 1}));
+    // An older request may not see the writes committed before the entry's start ts.
+    ASSERT_FALSE(CopResultCache::isValid(entry, 99, {10, 1}));
+    // The region has applied a write or a snapshot since the entry is put.
+    ASSERT_FALSE(CopResultCache::isValid(entry, 200, {11, 1}));
+    ASSERT_FALSE(CopResultCache::isValid(entry, 200, {10, 2}));
+}
+
+TEST(CopResultCacheTest, SkipPut)
+{
+    const UInt64 max_applied_commit_ts = 100;
+
+    ASSERT_TRUE(CopResultCache::canPut(200, {10, 1}, {10, 1}, max_applied_commit_ts));
+    ASSERT_TRUE(CopResultCache::canPut(100, {10, 1}, {10, 1}, max_applied_commit_ts));
+    // The region has applied a write during the read.
+    ASSERT_FALSE(CopResultCache::canPut(200, {10, 1}, {11, 1}, max_applied_commit_ts));
+    ASSERT_FALSE(CopResultCache::canPut(200, {10, 1}, {10, 2}, max_applied_commit_ts));
+    // A write committed after the start ts has been applied.
+    ASSERT_FALSE(CopResultCache::canPut(99, {10, 1}, {10, 1}, max_applied_commit_ts));
+    // The writes applied before restarting are unknown.
+    ASSERT_FALSE(CopResultCache::canPut(200, {10, 1}, {10, 1}, Region::UNKNOWN_COMMIT_TS));
+    // No write has been applied.
+    ASSERT_TRUE(CopResultCache::canPut(1, {10, 1}, {10, 1}, 0));
+}
+
+} // namespace tests
+} // namespace DB
@@ -15,6 +15,7 @@
 #include <Common/Stopwatch.h>
 #include <Common/TiFlashException.h>
 #include <Common/TiFlashMetrics.h>
+#include <Flash/Coprocessor/CopResultCache.h>
 #include <Flash/Coprocessor/DAGContext.h>
 #include <Flash/Coprocessor/DAGDriver.h>
 #include <Flash/Coprocessor/InterpreterDAG.h>
@@ -109,6 +110,28 @@ grpc::Status CoprocessorHandler::execute()
                     genCopKeyRange(cop_request->ranges()),
                     &bypass_lock_ts));
 
+            const UInt64 start_ts = cop_request->start_ts() > 0 ? cop_request->start_ts() : dag_request.start_ts_fallback();
+            auto & tmt = cop_context.db_context.getTMTContext();
+            auto result_cache = cop_context.db_context.getCopResultCache();
+            std::optional<UInt128> cache_key;
+            std::optional<CopResultCache::RegionState> region_state_before_read;
+            if (result_cache)
+            {
+                cache_key = CopResultCache::getKey(*cop_request, dag_request);
+                if (cache_key)
+                {
+                    const auto & region_info = table_regions_info.local_regions.at(cop_context.kv_context.region_id());
+                    auto query_log = Logger::get("CoprocessorHandler");
+                    if (result_cache->tryGet(*cache_key, start_ts, region_info, cop_context.db_context, *cop_response, query_log))
+                    {
+                        LOG_DEBUG(log, "Handle DAG request done by cached response");
+                        break;
+                    }
+                    // Record the state before reading, so that we know whether the region is changed during the read.
+                    region_state_before_read = CopResultCache::getRegionState(tmt, cop_context.kv_context.region_id());
+                }
+            }
+
             DAGContext dag_context(
                 dag_request,
                 std::move(tables_regions_info),
@@ -118,9 +141,11 @@ grpc::Status CoprocessorHandler::execute()
                 Logger::get("CoprocessorHandler"));
             cop_context.db_context.setDAGContext(&dag_context);
 
-            DAGDriver driver(cop_context.db_context, cop_request->start_ts() > 0 ? cop_request->start_ts() : dag_request.start_ts_fallback(), cop_request->schema_ver(), &dag_response);
+            DAGDriver driver(cop_context.db_context, start_ts, cop_request->schema_ver(), &dag_response);
             driver.execute();
             cop_response->set_data(dag_response.SerializeAsString());
+            if (cache_key && region_state_before_read && !dag_response.has_error())
+                result_cache->tryPut(*cache_key, start_ts, *region_state_before_read, tmt, cop_context.kv_context.region_id(), *cop_response);
             LOG_DEBUG(log, "Handle DAG request done");
             break;
         }
@@ -14,13 +14,13 @@
 
 #include <Common/Exception.h>
 #include <Flash/Coprocessor/CHBlockChunkCodec.h>
+#include <Flash/Coprocessor/CHBlockChunkCodecV1.h>
 #include <Flash/Disaggregated/WNFetchPagesStreamWriter.h>
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileDataProvider.h>
 #include <Storages/DeltaMerge/Delta/DeltaValueSpace.h>
 #include <Storages/DeltaMerge/DeltaMergeDefines.h>
 #include <Storages/DeltaMerge/Remote/DisaggSnapshot.h>
-#include <Storages/DeltaMerge/Remote/Proto/remote.pb.h>
 #include <Storages/DeltaMerge/Remote/WNDisaggSnapshotManager.h>
 #include <Storages/DeltaMerge/Segment.h>
 #include <Storages/Page/PageUtil.h>
@@ -34,36 +34,70 @@ namespace DB
 {
 WNFetchPagesStreamWriterPtr WNFetchPagesStreamWriter::build(
     const DM::Remote::SegmentPagesFetchTask & task,
-    const PageIdU64s & read_page_ids)
+    const PageIdU64s & read_page_ids,
+    size_t packet_limit_size,
+    CompressionMethod compression_method)
 {
     return std::unique_ptr<WNFetchPagesStreamWriter>(new WNFetchPagesStreamWriter(
         task.seg_task,
         task.column_defines,
         task.output_field_types,
-        read_page_ids));
+        read_page_ids,
+        packet_limit_size,
+        compression_method));
 }
 
-disaggregated::PagesPacket WNFetchPagesStreamWriter::nextPacket()
+size_t WNFetchPagesStreamWriter::fillPageData(DM::RemotePb::RemotePage & remote_page, std::string_view data) const
+{
+    if (compression_method != CompressionMethod::NONE && !data.empty())
+    {
+        auto compressed = CHBlockChunkCodecV1::encode(data, compression_method);
+        // Only keep the compressed data when it is smaller, so that the read node
+        // does not need to decompress the pages which are not compressible.
+        if (compressed.size() < data.size())
+        {
+            const size_t compressed_size = compressed.size();
+            remote_page.set_data(std::move(compressed));
+            remote_page.set_uncompressed_size(data.size());
+            return compressed_size;
+        }
+    }
+    remote_page.mutable_data()->assign(data.begin(), data.end());
+    return data.size();
+}
+
+std::optional<disaggregated::PagesPacket> WNFetchPagesStreamWriter::nextPacket()
 {
     // TODO: the returned rows should respect max_rows_per_chunk
 
+    if (next_page_index >= read_page_ids.size() && sent_packets > 0)
+        return std::nullopt;
+
+    if (!persisted_cf)
+        persisted_cf = seg_task->read_snapshot->delta->getPersistedFileSetSnapshot();
+
     disaggregated::PagesPacket packet;
 
-    // read page data by page_ids
-    size_t total_pages_data_size = 0;
-    auto persisted_cf = seg_task->read_snapshot->delta->getPersistedFileSetSnapshot();
-    for (const auto page_id : read_page_ids)
+    // Read page data by page_ids until the packet is full. There is at least one page in
+    // the packet, so that a page larger than `packet_limit_size` can still be sent.
+    size_t packet_pages_size = 0;
+    size_t packet_compressed_size = 0;
+    for (; next_page_index < read_page_ids.size(); ++next_page_index)
     {
+        if (packet.pages_size() > 0 && packet_compressed_size >= packet_limit_size)
+            break;
+
+        const auto page_id = read_page_ids[next_page_index];
         auto page = persisted_cf->getDataProvider()->readTinyData(page_id);
         DM::RemotePb::RemotePage remote_page;
         remote_page.set_page_id(page_id);
-        remote_page.mutable_data()->assign(page.data.begin(), page.data.end());
+        packet_compressed_size += fillPageData(remote_page, page.data);
         const auto field_sizes = PageUtil::getFieldSizes(page.field_offsets, page.data.size());
         for (const auto field_sz : field_sizes)
         {
             remote_page.add_field_sizes(field_sz);
         }
-        total_pages_data_size += page.data.size();
+        packet_pages_size += page.data.size();
         packet.mutable_pages()->Add(remote_page.SerializeAsString());
     }
 
@@ -71,19 +105,36 @@ disaggregated::PagesPacket WNFetchPagesStreamWriter::nextPacket()
     //       We could improve it to respond in the FetchPages stage, so that the parallel FetchPages could start
     //       as soon as possible.
 
+    ++sent_packets;
+    sent_pages_size += packet_pages_size;
+    sent_compressed_size += packet_compressed_size;
     LOG_DEBUG(log,
-              "Send FetchPagesStream, pages={} pages_size={} blocks={}",
+              "Send FetchPagesStream, packet_index={} pages={} pages_size={} compressed_size={} blocks={} remaining_pages={}",
+              sent_packets - 1,
               packet.pages_size(),
-              total_pages_data_size,
-              packet.chunks_size());
+              packet_pages_size,
+              packet_compressed_size,
+              packet.chunks_size(),
+              read_page_ids.size() - next_page_index);
     return packet;
 }
 
 void WNFetchPagesStreamWriter::pipeTo(SyncPagePacketWriter * sync_writer)
 {
-    // Currently we only send one stream packet.
-    // TODO: split the packet into smaller size
-    sync_writer->Write(nextPacket());
+    while (auto packet = nextPacket())
+    {
+        if (!sync_writer->Write(*packet))
+        {
+            LOG_WARNING(log, "Write FetchPagesStream failed, the stream may be closed by the peer, packets={}", sent_packets);
+            return;
+        }
+    }
+    LOG_DEBUG(log,
+              "Send FetchPagesStream done, packets={} pages={} pages_size={} compressed_size={}",
+              sent_packets,
+              read_page_ids.size(),
+              sent_pages_size,
+              sent_compressed_size);
 }
 
 
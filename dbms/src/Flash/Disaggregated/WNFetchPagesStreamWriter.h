@@ -15,8 +15,11 @@
 #pragma once
 
 #include <Common/Logger.h>
+#include <IO/CompressedStream.h>
+#include <Storages/DeltaMerge/ColumnFile/ColumnFileSetSnapshot.h>
 #include <Storages/DeltaMerge/Remote/DisaggSnapshot_fwd.h>
 #include <Storages/DeltaMerge/Remote/DisaggTaskId.h>
+#include <Storages/DeltaMerge/Remote/Proto/remote.pb.h>
 #include <Storages/DeltaMerge/SegmentReadTaskPool.h>
 #include <Storages/Page/PageDefinesBase.h>
 #include <Storages/Transaction/Types.h>
@@ -27,6 +30,7 @@
 #include <grpcpp/support/sync_stream.h>
 #pragma GCC diagnostic pop
 
+#include <optional>
 
 namespace DB
 {
@@ -39,39 +43,70 @@ using WNFetchPagesStreamWriterPtr = std::unique_ptr<WNFetchPagesStreamWriter>;
  * A writer in TiFlash write node, who sends the delta layer data to the read node in a streaming way.
  * It writes ColumnFileTiny and ColumnFileInMemory.
  * This writer is used for responding the FetchPages request.
+ *
+ * The pages are split into packets by `packet_limit_size`, so that many small pages are
+ * batched into one packet while a large response does not block the read node from
+ * decoding the pages already received. The data of each page is compressed by
+ * `compression_method` when it makes the page smaller.
  */
 class WNFetchPagesStreamWriter
 {
 public:
     static WNFetchPagesStreamWriterPtr build(
         const DM::Remote::SegmentPagesFetchTask & task,
-        const PageIdU64s & read_page_ids);
+        const PageIdU64s & read_page_ids,
+        size_t packet_limit_size,
+        CompressionMethod compression_method);
 
+    /// Write all packets to the sync response sink.
     void pipeTo(SyncPagePacketWriter * sync_writer);
 
+    /// Returns the next packet that could write to the response sink.
+    /// Returns std::nullopt when all pages have been returned. At least one packet
+    /// is returned even if there is no page to send.
+    std::optional<disaggregated::PagesPacket> nextPacket();
+
+#ifndef DBMS_PUBLIC_GTEST
 private:
+#endif
     WNFetchPagesStreamWriter(
         DM::SegmentReadTaskPtr seg_task_,
         DM::ColumnDefinesPtr column_defines_,
         std::shared_ptr<std::vector<tipb::FieldType>> result_field_types_,
-        PageIdU64s read_page_ids)
+        PageIdU64s read_page_ids,
+        size_t packet_limit_size_,
+        CompressionMethod compression_method_)
         : seg_task(std::move(seg_task_))
         , column_defines(column_defines_)
         , result_field_types(std::move(result_field_types_))
         , read_page_ids(std::move(read_page_ids))
+        , packet_limit_size(packet_limit_size_)
+        , compression_method(compression_method_)
         , log(Logger::get())
     {}
 
-    /// Returns the next packet that could write to the response sink.
-    disaggregated::PagesPacket nextPacket();
+    /// Fill the page data into `remote_page`, compressed if it is worth.
+    /// Returns the size of the data filled.
+    size_t fillPageData(DM::RemotePb::RemotePage & remote_page, std::string_view data) const;
 
+#ifndef DBMS_PUBLIC_GTEST
 private:
+#endif
     const DM::DisaggTaskId task_id;
     DM::SegmentReadTaskPtr seg_task;
     DM::ColumnDefinesPtr column_defines;
     std::shared_ptr<std::vector<tipb::FieldType>> result_field_types;
     PageIdU64s read_page_ids;
 
+    const size_t packet_limit_size;
+    const CompressionMethod compression_method;
+
+    DM::ColumnFileSetSnapshotPtr persisted_cf;
+    size_t next_page_index = 0;
+    size_t sent_packets = 0;
+    size_t sent_pages_size = 0;
+    size_t sent_compressed_size = 0;
+
     LoggerPtr log;
 };
 
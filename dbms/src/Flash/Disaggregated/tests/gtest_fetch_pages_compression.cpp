@@ -0,0 +1,93 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Disaggregated/WNFetchPagesStreamWriter.h>
+#include <Storages/DeltaMerge/Remote/RNRemoteReadTask.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace DB::tests
+{
+namespace
+{
+String makeCompressibleData(size_t size)
+{
+    String data(size, '\0');
+    for (size_t i = 0; i < size; ++i)
+        data[i] = static_cast<char>('a' + i % 4);
+    return data;
+}
+
+String makeRandomData(size_t size)
+{
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<int> dist(0, 255);
+    String data(size, '\0');
+    for (auto & c : data)
+        c = static_cast<char>(dist(gen));
+    return data;
+}
+
+// Fill the page by the write node and then decode it as the read node does.
+void assertRoundTrip(CompressionMethod method, const String & data, bool expect_compressed)
+{
+    WNFetchPagesStreamWriter writer(nullptr, nullptr, nullptr, {}, 1024, method);
+    DM::RemotePb::RemotePage remote_page;
+    const size_t filled_size = writer.fillPageData(remote_page, data);
+    ASSERT_EQ(filled_size, remote_page.data().size());
+    if (expect_compressed)
+    {
+        ASSERT_EQ(remote_page.uncompressed_size(), data.size());
+        ASSERT_LT(remote_page.data().size(), data.size());
+    }
+    else
+    {
+        ASSERT_EQ(remote_page.uncompressed_size(), 0);
+        ASSERT_EQ(remote_page.data(), data);
+    }
+
+    // The page goes through the wire.
+    DM::RemotePb::RemotePage received;
+    ASSERT_TRUE(received.ParseFromString(remote_page.SerializeAsString()));
+    DM::RNRemoteSegmentReadTask::decompressPage(received);
+    ASSERT_EQ(received.uncompressed_size(), 0);
+    ASSERT_EQ(received.data(), data);
+}
+} // namespace
+
+TEST(FetchPagesCompressionTest, NotCompressed)
+try
+{
+    assertRoundTrip(CompressionMethod::NONE, makeCompressibleData(4096), false);
+    assertRoundTrip(CompressionMethod::NONE, makeRandomData(4096), false);
+    assertRoundTrip(CompressionMethod::NONE, "", false);
+}
+CATCH
+
+TEST(FetchPagesCompressionTest, Compressed)
+try
+{
+    for (auto method : {CompressionMethod::LZ4, CompressionMethod::ZSTD})
+    {
+        assertRoundTrip(method, makeCompressibleData(4096), true);
+        // The pages which are not worth compressing are sent as they are.
+        assertRoundTrip(method, makeRandomData(4096), false);
+        assertRoundTrip(method, "", false);
+    }
+}
+CATCH
+
+} // namespace DB::tests
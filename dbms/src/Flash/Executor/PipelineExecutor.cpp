@@ -12,10 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/escapeForFileName.h>
 #include <Flash/Executor/PipelineExecutor.h>
 #include <Flash/Pipeline/Pipeline.h>
 #include <Flash/Pipeline/Schedule/Events/Event.h>
+#include <IO/WriteBufferFromFile.h>
+#include <IO/WriteHelpers.h>
 #include <Interpreters/Context.h>
+#include <Poco/File.h>
 
 namespace DB
 {
@@ -61,9 +65,40 @@ ExecutionResult PipelineExecutor::execute(ResultHandler && result_handler)
     {
         status.wait();
     }
+    dumpTaskProfile();
     return status.toExecutionResult();
 }
 
+void PipelineExecutor::dumpTaskProfile()
+{
+    const auto & task_tracer = status.getTaskTracer();
+    const auto total = task_tracer.getTotal();
+    LOG_DEBUG(
+        log,
+        "{} pipeline tasks finished, execute time: {}ms, queue time: {}ms, wait time: {}ms",
+        task_tracer.size(),
+        total.execute_time_ns / 1'000'000,
+        total.queue_time_ns / 1'000'000,
+        total.wait_time_ns / 1'000'000);
+
+    const String trace_path = context.getSettingsRef().pipeline_trace_path;
+    if (trace_path.empty())
+        return;
+    try
+    {
+        Poco::File(trace_path).createDirectories();
+        const auto file_path = fmt::format("{}/{}.json", trace_path, escapeForFileName(log->identifier()));
+        WriteBufferFromFile buf(file_path);
+        writeString(task_tracer.toChromeTrace(), buf);
+        buf.next();
+        LOG_DEBUG(log, "pipeline trace is dumped to {}", file_path);
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, "dump pipeline trace failed");
+    }
+}
+
 void PipelineExecutor::cancel()
 {
     status.cancel();
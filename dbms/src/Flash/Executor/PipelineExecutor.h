@@ -69,6 +69,10 @@ public:
 protected:
     ExecutionResult execute(ResultHandler && result_handler) override;
 
+private:
+    /// Log the time the tasks spent in each state, and dump the trace of tasks if `pipeline_trace_path` is set.
+    void dumpTaskProfile();
+
 private:
     PipelinePtr root_pipeline;
 
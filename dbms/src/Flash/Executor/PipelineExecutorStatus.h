@@ -16,6 +16,7 @@
 
 #include <Common/Logger.h>
 #include <Flash/Executor/ExecutionResult.h>
+#include <Flash/Pipeline/Schedule/Tasks/TaskProfileInfo.h>
 
 #include <atomic>
 #include <exception>
@@ -74,6 +75,8 @@ public:
         return is_cancelled.load(std::memory_order_acquire);
     }
 
+    TaskTracer & getTaskTracer() noexcept { return task_tracer; }
+
 private:
     bool setExceptionPtr(const std::exception_ptr & exception_ptr_) noexcept;
 
@@ -86,5 +89,7 @@ private:
     UInt32 active_event_count{0};
 
     std::atomic_bool is_cancelled{false};
+
+    TaskTracer task_tracer;
 };
 } // namespace DB
@@ -0,0 +1,213 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/Exception.h>
+#include <Common/TiFlashMetrics.h>
+#include <Flash/Disaggregated/WNFetchPagesStreamWriter.h>
+#include <Flash/FetchDisaggPagesCall.h>
+#include <Flash/FlashService.h>
+#include <IO/IOThreadPools.h>
+
+#include <chrono>
+#include <thread>
+
+namespace DB
+{
+std::atomic<Int64> FetchDisaggPagesCallData::producing_packets{0};
+
+FetchDisaggPagesCallData::FetchDisaggPagesCallData(
+    AsyncFlashService * service,
+    grpc::ServerCompletionQueue * cq,
+    grpc::ServerCompletionQueue * notify_cq,
+    const std::shared_ptr<std::atomic<bool>> & is_shutdown)
+    : service(service)
+    , cq(cq)
+    , notify_cq(notify_cq)
+    , is_shutdown(is_shutdown)
+    , responder(&ctx)
+    , state(NEW_REQUEST)
+{
+    // As part of the initial CREATE state, we *request* that the system
+    // start processing requests. In this request, "this" acts are
+    // the tag uniquely identifying the request.
+    service->RequestFetchDisaggPages(&ctx, &request, &responder, cq, notify_cq, this);
+}
+
+FetchDisaggPagesCallData::~FetchDisaggPagesCallData()
+{
+    if (is_processing)
+        GET_METRIC(tiflash_object_count, type_count_of_fetch_pages_calldata).Decrement();
+}
+
+FetchDisaggPagesCallData * FetchDisaggPagesCallData::spawn(
+    AsyncFlashService * service,
+    grpc::ServerCompletionQueue * cq,
+    grpc::ServerCompletionQueue * notify_cq,
+    const std::shared_ptr<std::atomic<bool>> & is_shutdown)
+{
+    return new FetchDisaggPagesCallData(service, cq, notify_cq, is_shutdown);
+}
+
+void FetchDisaggPagesCallData::proceed(bool ok)
+{
+    if (state == PREPARING)
+    {
+        // The alarm is fired because the next packet is ready. The alarm is never cancelled,
+        // so we don't care about `ok` here.
+        onPacketReady();
+        return;
+    }
+
+    if (unlikely(!ok))
+    {
+        /// state == NEW_REQUEST means the server is shutdown and no new rpc has come.
+        if (state == NEW_REQUEST || state == FINISH)
+        {
+            delete this;
+            return;
+        }
+        writeDone(grpc::Status(static_cast<grpc::StatusCode>(GRPC_STATUS_UNKNOWN), "grpc writes failed"));
+        return;
+    }
+
+    if (state == NEW_REQUEST)
+    {
+        spawn(service, cq, notify_cq, is_shutdown);
+        initRpc();
+    }
+    else if (state == WRITING)
+    {
+        if (unlikely(is_shutdown->load(std::memory_order_relaxed)))
+        {
+            writeDone(grpc::Status(static_cast<grpc::StatusCode>(GRPC_STATUS_UNAVAILABLE), "server is shutting down"));
+            return;
+        }
+        scheduleNextPacket();
+    }
+    else if (state == ERR_HANDLE)
+    {
+        writeDone(err_status);
+    }
+    else
+    {
+        assert(state == FINISH);
+        // Once in the FINISH state, deallocate ourselves.
+        delete this;
+        return;
+    }
+}
+
+void FetchDisaggPagesCallData::initRpc()
+{
+    is_processing = true;
+    GET_METRIC(tiflash_object_count, type_count_of_fetch_pages_calldata).Increment();
+    try
+    {
+        stream_writer = service->fetchDisaggPagesAsync(&ctx, &request, err_status, err_packet);
+    }
+    catch (...)
+    {
+        err_status = grpc::Status(static_cast<grpc::StatusCode>(GRPC_STATUS_UNKNOWN), getCurrentExceptionMessage(false));
+    }
+
+    if (stream_writer)
+        scheduleNextPacket();
+    else if (err_packet.has_error())
+        writeErr();
+    else
+        writeDone(err_status);
+}
+
+void FetchDisaggPagesCallData::scheduleNextPacket()
+{
+    // Count the packet before checking `is_shutdown`, so that the server either waits for the
+    // alarm to be set before shutting down the completion queues, or the alarm is never set.
+    producing_packets.fetch_add(1);
+    if (unlikely(is_shutdown->load()))
+    {
+        producing_packets.fetch_sub(1);
+        writeDone(grpc::Status(static_cast<grpc::StatusCode>(GRPC_STATUS_UNAVAILABLE), "server is shutting down"));
+        return;
+    }
+
+    state = PREPARING;
+    // A fired alarm can not be set again, use a new one for each packet.
+    alarm = std::make_unique<grpc::Alarm>();
+    auto job = [this] {
+        produceNextPacket();
+        // `this` may be handled by another grpc thread once the alarm is set.
+        alarm->Set(cq, std::chrono::system_clock::now(), this);
+        producing_packets.fetch_sub(1);
+    };
+    if (WNFetchPagesPool::instance && WNFetchPagesPool::instance->trySchedule(job))
+        return;
+
+    // The pool is not available or busy, produce the packet in the grpc thread instead.
+    producing_packets.fetch_sub(1);
+    produceNextPacket();
+    onPacketReady();
+}
+
+void FetchDisaggPagesCallData::waitForProducingPackets()
+{
+    while (producing_packets.load() > 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void FetchDisaggPagesCallData::produceNextPacket()
+{
+    try
+    {
+        packet = stream_writer->nextPacket();
+    }
+    catch (...)
+    {
+        meet_error = true;
+        err_status = FlashService::handleFetchDisaggPagesException(Logger::get(DM::DisaggTaskId(request.snapshot_id())), err_packet);
+    }
+}
+
+void FetchDisaggPagesCallData::onPacketReady()
+{
+    if (meet_error)
+    {
+        writeErr();
+        return;
+    }
+    if (!packet)
+    {
+        writeDone(grpc::Status::OK);
+        return;
+    }
+    state = WRITING;
+    responder.Write(*packet, this);
+}
+
+void FetchDisaggPagesCallData::writeErr()
+{
+    state = ERR_HANDLE;
+    responder.Write(err_packet, this);
+}
+
+void FetchDisaggPagesCallData::writeDone(const grpc::Status & status)
+{
+    state = FINISH;
+    // Release the snapshot before finishing the call, so that the snapshot can be unregistered.
+    stream_writer.reset();
+    if (is_processing)
+        service->finishFetchDisaggPagesAsync(&request);
+    responder.Finish(status, this);
+}
+
+} // namespace DB
@@ -0,0 +1,119 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Flash/FlashService.h>
+#include <grpcpp/alarm.h>
+#include <kvproto/disaggregated.pb.h>
+#include <kvproto/tikvpb.grpc.pb.h>
+
+#include <optional>
+
+namespace DB
+{
+class AsyncFlashService;
+
+class FetchDisaggPagesCallData
+{
+public:
+    // A state machine used for async grpc api FetchDisaggPages. When a relative grpc event arrives,
+    // it reacts base on current state.
+    // "notify_cq" gets the tag back indicating a call has started. All subsequent operations (writes,
+    // alarms, etc) on that call report back to "cq".
+    // The packets are read and compressed in `WNFetchPagesPool`, so that no grpc thread is blocked
+    // by reading pages. When a packet is ready, the call data is pushed back to "cq" by an alarm and
+    // the packet is written in the grpc thread.
+    FetchDisaggPagesCallData(
+        AsyncFlashService * service,
+        grpc::ServerCompletionQueue * cq,
+        grpc::ServerCompletionQueue * notify_cq,
+        const std::shared_ptr<std::atomic<bool>> & is_shutdown);
+
+    ~FetchDisaggPagesCallData();
+
+    void proceed(bool ok);
+
+    // Spawn a new FetchDisaggPagesCallData instance to serve new clients while we process the one for this FetchDisaggPagesCallData.
+    // The instance will deallocate itself as part of its FINISH state.
+    static FetchDisaggPagesCallData * spawn(
+        AsyncFlashService * service,
+        grpc::ServerCompletionQueue * cq,
+        grpc::ServerCompletionQueue * notify_cq,
+        const std::shared_ptr<std::atomic<bool>> & is_shutdown);
+
+    // Wait for the packets being produced in background, after that no alarm will be set on the
+    // completion queues. Must be called after `is_shutdown` is set and before shutting down the
+    // completion queues.
+    static void waitForProducingPackets();
+
+private:
+    /// WARNING: Same as EstablishCallData, it's EXTREMELY DANGEROUS to read/write any data
+    /// after calling a grpc function or setting the alarm with a `this` pointer because the
+    /// pointer may be gotten by another grpc thread in a very short time.
+
+    void initRpc();
+
+    /// Produce the next packet in background and push this call data back to `cq` when it is ready.
+    void scheduleNextPacket();
+    /// Read the next packet from `stream_writer`.
+    void produceNextPacket();
+    /// Called in the grpc thread when the next packet is produced.
+    void onPacketReady();
+
+    /// Called when an application error happens.
+    /// No more packet can be written after writing the error packet.
+    void writeErr();
+    /// Called when all packets are written or a grpc error happens.
+    void writeDone(const grpc::Status & status);
+
+    // Server instance
+    AsyncFlashService * service;
+
+    // The producer-consumer queue where for asynchronous server notifications.
+    grpc::ServerCompletionQueue * cq;
+    grpc::ServerCompletionQueue * notify_cq;
+    std::shared_ptr<std::atomic<bool>> is_shutdown;
+    grpc::ServerContext ctx;
+
+    // What we get from the client.
+    disaggregated::FetchDisaggPagesRequest request;
+
+    // The means to get back to the client.
+    grpc::ServerAsyncWriter<disaggregated::PagesPacket> responder;
+
+    enum CallStatus
+    {
+        NEW_REQUEST,
+        PREPARING,
+        WRITING,
+        ERR_HANDLE,
+        FINISH
+    };
+    // The current serving state.
+    CallStatus state;
+
+    WNFetchPagesStreamWriterPtr stream_writer;
+    // The packet produced by `stream_writer`, std::nullopt means all packets are written.
+    std::optional<disaggregated::PagesPacket> packet;
+    disaggregated::PagesPacket err_packet;
+    grpc::Status err_status;
+    bool meet_error = false;
+    bool is_processing = false;
+    std::unique_ptr<grpc::Alarm> alarm;
+
+    // The number of packets being produced in background, which will set alarms on the completion queues.
+    static std::atomic<Int64> producing_packets;
+};
+} // namespace DB
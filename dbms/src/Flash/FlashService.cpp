@@ -717,56 +717,54 @@ grpc::Status FlashService::EstablishDisaggTask(grpc::ServerContext * grpc_contex
     return grpc::Status::OK;
 }
 
-grpc::Status FlashService::FetchDisaggPages(
-    grpc::ServerContext * grpc_context,
-    const disaggregated::FetchDisaggPagesRequest * request,
-    grpc::ServerWriter<disaggregated::PagesPacket> * sync_writer)
+WNFetchPagesStreamWriterPtr FlashService::prepareFetchDisaggPages(const disaggregated::FetchDisaggPagesRequest * request)
 {
-    CPUAffinityManager::getInstance().bindSelfGrpcThread();
-    LOG_DEBUG(log, "Handling FetchDisaggPages request: {}", request->ShortDebugString());
-    if (auto check_result = checkGrpcContext(grpc_context); !check_result.ok())
-        return check_result;
-
-    auto record_error = [&](grpc::StatusCode err_code, const String & err_msg) {
-        disaggregated::PagesPacket err_response;
-        auto * err = err_response.mutable_error();
-        err->set_code(ErrorCodes::UNKNOWN_EXCEPTION);
-        err->set_msg(err_msg);
-        sync_writer->Write(err_response);
-        return grpc::Status(err_code, err_msg);
-    };
-
     RUNTIME_CHECK_MSG(context->getSharedContextDisagg()->isDisaggregatedStorageMode(), "FetchDisaggPages should only be called on write node");
 
     auto snaps = context->getSharedContextDisagg()->wn_snapshot_manager;
     const DM::DisaggTaskId task_id(request->snapshot_id());
     auto logger = Logger::get(task_id);
 
-    LOG_DEBUG(logger, "Fetching pages, table_id={} segment_id={}", task_id, request->table_id(), request->segment_id());
+    LOG_DEBUG(logger, "Fetching pages, table_id={} segment_id={}", request->table_id(), request->segment_id());
 
-    SCOPE_EXIT({
-        // The snapshot is created in the 1st request (Establish), and will be destroyed when all FetchPages are finished.
-        snaps->unregisterSnapshotIfEmpty(task_id);
-    });
+    auto snap = snaps->getSnapshot(task_id);
+    RUNTIME_CHECK_MSG(snap != nullptr, "Can not find disaggregated task, task_id={}", task_id);
+    auto task = snap->popSegTask(request->table_id(), request->segment_id());
+    RUNTIME_CHECK(task.isValid(), task.err_msg);
 
-    try
-    {
-        auto snap = snaps->getSnapshot(task_id);
-        RUNTIME_CHECK_MSG(snap != nullptr, "Can not find disaggregated task, task_id={}", task_id);
-        auto task = snap->popSegTask(request->table_id(), request->segment_id());
-        RUNTIME_CHECK(task.isValid(), task.err_msg);
+    PageIdU64s read_ids;
+    read_ids.reserve(request->page_ids_size());
+    for (auto page_id : request->page_ids())
+        read_ids.emplace_back(page_id);
 
-        PageIdU64s read_ids;
-        read_ids.reserve(request->page_ids_size());
-        for (auto page_id : request->page_ids())
-            read_ids.emplace_back(page_id);
+    const auto & settings = context->getSettingsRef();
+    return WNFetchPagesStreamWriter::build(
+        task,
+        read_ids,
+        settings.disagg_fetch_pages_packet_limit_size,
+        settings.disagg_fetch_pages_compression_method);
+}
 
-        auto stream_writer = WNFetchPagesStreamWriter::build(task, read_ids);
-        stream_writer->pipeTo(sync_writer);
-        stream_writer.reset();
+void FlashService::finishFetchDisaggPages(const disaggregated::FetchDisaggPagesRequest * request)
+{
+    if (!context->getSharedContextDisagg()->isDisaggregatedStorageMode())
+        return;
+    auto snaps = context->getSharedContextDisagg()->wn_snapshot_manager;
+    snaps->unregisterSnapshotIfEmpty(DM::DisaggTaskId(request->snapshot_id()));
+}
 
-        LOG_DEBUG(logger, "FetchDisaggPages respond finished, task_id={}", task_id);
-        return grpc::Status::OK;
+grpc::Status FlashService::handleFetchDisaggPagesException(const LoggerPtr & logger, disaggregated::PagesPacket & err_packet)
+{
+    auto record_error = [&](grpc::StatusCode err_code, const String & err_msg) {
+        auto * err = err_packet.mutable_error();
+        err->set_code(ErrorCodes::UNKNOWN_EXCEPTION);
+        err->set_msg(err_msg);
+        return grpc::Status(err_code, err_msg);
+    };
+
+    try
+    {
+        throw;
     }
     catch (const TiFlashException & e)
     {
@@ -795,6 +793,64 @@ grpc::Status FlashService::FetchDisaggPages(
     }
 }
 
+grpc::Status FlashService::FetchDisaggPages(
+    grpc::ServerContext * grpc_context,
+    const disaggregated::FetchDisaggPagesRequest * request,
+    grpc::ServerWriter<disaggregated::PagesPacket> * sync_writer)
+{
+    CPUAffinityManager::getInstance().bindSelfGrpcThread();
+    LOG_DEBUG(log, "Handling FetchDisaggPages request: {}", request->ShortDebugString());
+    if (auto check_result = checkGrpcContext(grpc_context); !check_result.ok())
+        return check_result;
+
+    const DM::DisaggTaskId task_id(request->snapshot_id());
+    auto logger = Logger::get(task_id);
+
+    SCOPE_EXIT({
+        finishFetchDisaggPages(request);
+    });
+
+    try
+    {
+        auto stream_writer = prepareFetchDisaggPages(request);
+        stream_writer->pipeTo(sync_writer);
+        stream_writer.reset();
+
+        LOG_DEBUG(logger, "FetchDisaggPages respond finished, task_id={}", task_id);
+        return grpc::Status::OK;
+    }
+    catch (...)
+    {
+        disaggregated::PagesPacket err_response;
+        auto status = handleFetchDisaggPagesException(logger, err_response);
+        sync_writer->Write(err_response);
+        return status;
+    }
+}
+
+WNFetchPagesStreamWriterPtr AsyncFlashService::fetchDisaggPagesAsync(
+    grpc::ServerContext * grpc_context,
+    const disaggregated::FetchDisaggPagesRequest * request,
+    grpc::Status & status,
+    disaggregated::PagesPacket & err_packet)
+{
+    LOG_DEBUG(log, "Handling FetchDisaggPages request: {}", request->ShortDebugString());
+    if (status = checkGrpcContext(grpc_context); !status.ok())
+        return nullptr;
+
+    try
+    {
+        auto stream_writer = prepareFetchDisaggPages(request);
+        status = grpc::Status::OK;
+        return stream_writer;
+    }
+    catch (...)
+    {
+        status = handleFetchDisaggPagesException(Logger::get(DM::DisaggTaskId(request->snapshot_id())), err_packet);
+        return nullptr;
+    }
+}
+
 void FlashService::setMockStorage(MockStorage * mock_storage_)
 {
     mock_storage = mock_storage_;
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <Common/Logger.h>
 #include <Debug/MockServerInfo.h>
 #include <common/ThreadPool.h>
 #include <common/logger_useful.h>
@@ -34,6 +35,8 @@ namespace DB
 class IServer;
 class IAsyncCallData;
 class EstablishCallData;
+class WNFetchPagesStreamWriter;
+using WNFetchPagesStreamWriterPtr = std::unique_ptr<WNFetchPagesStreamWriter>;
 class MockStorage;
 class Context;
 using ContextPtr = std::shared_ptr<Context>;
@@ -101,7 +104,17 @@ public:
     void setMockMPPServerInfo(MockMPPServerInfo & mpp_test_info_);
     Context * getContext() { return context; }
 
+    /// Must be called in a catch block. Fill `err_packet` by the exception being handled
+    /// and return the status that should be responded to the client.
+    static grpc::Status handleFetchDisaggPagesException(const LoggerPtr & logger, disaggregated::PagesPacket & err_packet);
+
 protected:
+    /// Build the stream writer for responding the FetchDisaggPages request. Throws exception
+    /// if the disaggregated task or the segment task can not be found.
+    WNFetchPagesStreamWriterPtr prepareFetchDisaggPages(const disaggregated::FetchDisaggPagesRequest * request);
+    /// The snapshot is created in the 1st request (Establish), and will be destroyed when all FetchPages are finished.
+    void finishFetchDisaggPages(const disaggregated::FetchDisaggPagesRequest * request);
+
     std::tuple<ContextPtr, grpc::Status> createDBContextForTest() const;
     std::tuple<ContextPtr, grpc::Status> createDBContext(const grpc::ServerContext * grpc_context) const;
     grpc::Status checkGrpcContext(const grpc::ServerContext * grpc_context) const;
@@ -123,7 +136,7 @@ protected:
     std::unique_ptr<legacy::ThreadPool> cop_pool, batch_cop_pool;
 };
 
-class AsyncFlashService final : public tikvpb::Tikv::WithAsyncMethod_EstablishMPPConnection<FlashService>
+class AsyncFlashService final : public tikvpb::Tikv::WithAsyncMethod_EstablishMPPConnection<tikvpb::Tikv::WithAsyncMethod_FetchDisaggPages<FlashService>>
 {
 public:
     AsyncFlashService()
@@ -133,5 +146,10 @@ public:
     /// Return grpc::Status::OK when the connection is established.
     /// Return non-OK grpc::Status when the connection can not be established.
     grpc::Status establishMPPConnectionAsync(grpc::ServerContext * context, const mpp::EstablishMPPConnectionRequest * request, EstablishCallData * call_data);
+
+    /// Return the stream writer when the FetchDisaggPages request is accepted.
+    /// Return nullptr and fill `status` and `err_packet` when the request can not be handled.
+    WNFetchPagesStreamWriterPtr fetchDisaggPagesAsync(grpc::ServerContext * grpc_context, const disaggregated::FetchDisaggPagesRequest * request, grpc::Status & status, disaggregated::PagesPacket & err_packet);
+    void finishFetchDisaggPagesAsync(const disaggregated::FetchDisaggPagesRequest * request) { finishFetchDisaggPages(request); }
 };
 } // namespace DB
@@ -34,6 +34,7 @@
 #include <Interpreters/executeQuery.h>
 #include <Storages/Transaction/KVStore.h>
 #include <Storages/Transaction/TMTContext.h>
+#include <common/getMemoryAmount.h>
 #include <fmt/core.h>
 
 #include <chrono>
@@ -387,7 +388,8 @@ void MPPTask::runImpl()
         LOG_INFO(log, "task starts preprocessing");
         preprocess();
         schedule_entry.setNeededThreads(estimateCountOfNewThreads());
-        LOG_DEBUG(log, "Estimate new thread count of query: {} including tunnel_threads: {}, receiver_threads: {}", schedule_entry.getNeededThreads(), dag_context->tunnel_set->getExternalThreadCnt(), new_thread_count_of_mpp_receiver);
+        schedule_entry.setNeededMemory(estimateMemoryUsage(dag_req, context->getSettingsRef(), getMemoryAmount()));
+        LOG_DEBUG(log, "Estimate new thread count of query: {} including tunnel_threads: {}, receiver_threads: {}, estimated memory usage: {}", schedule_entry.getNeededThreads(), dag_context->tunnel_set->getExternalThreadCnt(), new_thread_count_of_mpp_receiver, schedule_entry.getNeededMemory());
 
         scheduleOrWait();
 
@@ -563,4 +565,39 @@ int MPPTask::estimateCountOfNewThreads()
         + new_thread_count_of_mpp_receiver;
 }
 
+UInt64 estimateMemoryUsage(const tipb::DAGRequest & dag_req, const Settings & settings, UInt64 total_memory)
+{
+    // The memory usage is dominated by the operators that hold the whole input in memory, which are
+    // hash join build side, hash aggregation and sort. The spill threshold of an operator bounds its
+    // memory usage from above if it is set. Otherwise the operator is only bounded by the memory limit
+    // of the query, or use the default estimation if there is no limit.
+    const UInt64 query_limit = settings.max_memory_usage.getActualBytes(total_memory);
+    const UInt64 unbounded_bytes = query_limit > 0 ? query_limit : static_cast<UInt64>(settings.task_scheduler_estimated_memory_per_operator);
+    auto estimate = [unbounded_bytes](UInt64 spill_threshold) {
+        return spill_threshold > 0 ? spill_threshold : unbounded_bytes;
+    };
+
+    UInt64 estimated_bytes = 0;
+    traverseExecutors(&dag_req, [&](const tipb::Executor & executor) {
+        switch (executor.tp())
+        {
+        case tipb::ExecType::TypeJoin:
+            estimated_bytes += estimate(settings.max_bytes_before_external_join);
+            break;
+        case tipb::ExecType::TypeAggregation:
+            estimated_bytes += estimate(settings.max_bytes_before_external_group_by);
+            break;
+        case tipb::ExecType::TypeTopN:
+        case tipb::ExecType::TypeSort:
+            estimated_bytes += estimate(settings.max_bytes_before_external_sort);
+            break;
+        default:
+            break;
+        }
+        return true;
+    });
+    // The task can not use more memory than the limit of the query.
+    return query_limit > 0 ? std::min(estimated_bytes, query_limit) : estimated_bytes;
+}
+
 } // namespace DB
@@ -38,6 +38,7 @@
 namespace DB
 {
 class MPPTaskManager;
+struct Settings;
 
 enum class AbortType
 {
@@ -150,4 +151,8 @@ using MPPTaskPtr = std::shared_ptr<MPPTask>;
 
 using MPPTaskMap = std::unordered_map<MPPTaskId, MPPTaskPtr>;
 
+/// Estimate the memory usage in bytes of a task by its join, aggregation and sort operators, used by the memory-aware
+/// admission of MinTSOScheduler. `total_memory` is used to resolve `max_memory_usage` given in ratio.
+UInt64 estimateMemoryUsage(const tipb::DAGRequest & dag_req, const Settings & settings, UInt64 total_memory);
+
 } // namespace DB
@@ -300,10 +300,10 @@ bool MPPTaskManager::tryToScheduleTask(MPPTaskScheduleEntry & schedule_entry)
     return scheduler->tryToSchedule(schedule_entry, *this);
 }
 
-void MPPTaskManager::releaseThreadsFromScheduler(const int needed_threads)
+void MPPTaskManager::releaseResourcesFromScheduler(const int needed_threads, const UInt64 needed_memory)
 {
     std::lock_guard lock(mu);
-    scheduler->releaseThreadsThenSchedule(needed_threads, *this);
+    scheduler->releaseResourcesThenSchedule(needed_threads, needed_memory, *this);
 }
 
 } // namespace DB
@@ -27,6 +27,11 @@
 
 namespace DB
 {
+namespace tests
+{
+class MinTSOSchedulerTest;
+} // namespace tests
+
 struct MPPQueryTaskSet
 {
     enum State
@@ -87,7 +92,7 @@ public:
 
     bool tryToScheduleTask(MPPTaskScheduleEntry & schedule_entry);
 
-    void releaseThreadsFromScheduler(int needed_threads);
+    void releaseResourcesFromScheduler(int needed_threads, UInt64 needed_memory);
 
     std::pair<MPPTunnelPtr, String> findTunnelWithTimeout(const ::mpp::EstablishMPPConnectionRequest * request, std::chrono::seconds timeout);
 
@@ -100,6 +105,8 @@ public:
 private:
     MPPQueryTaskSetPtr addMPPQueryTaskSet(const MPPQueryId & query_id);
     void removeMPPQueryTaskSet(const MPPQueryId & query_id, bool on_abort);
+
+    friend class tests::MinTSOSchedulerTest;
 };
 
 } // namespace DB
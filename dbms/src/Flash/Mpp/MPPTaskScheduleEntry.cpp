@@ -23,6 +23,7 @@ MPPTaskScheduleEntry::MPPTaskScheduleEntry(MPPTaskManager * manager_, const MPPT
     : manager(manager_)
     , id(id_)
     , needed_threads(0)
+    , needed_memory(0)
     , schedule_state(ScheduleState::WAITING)
     , log(Logger::get(id.toString()))
 {}
@@ -31,7 +32,7 @@ MPPTaskScheduleEntry::~MPPTaskScheduleEntry()
 {
     if (schedule_state == ScheduleState::SCHEDULED)
     {
-        manager->releaseThreadsFromScheduler(needed_threads);
+        manager->releaseResourcesFromScheduler(needed_threads, needed_memory);
         schedule_state = ScheduleState::COMPLETED;
     }
 }
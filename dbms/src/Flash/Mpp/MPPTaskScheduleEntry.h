@@ -36,6 +36,10 @@ public:
     int getNeededThreads() const;
     void setNeededThreads(int needed_threads_);
 
+    /// The estimated memory usage in bytes of this task, used for the memory-aware admission.
+    UInt64 getNeededMemory() const { return needed_memory; }
+    void setNeededMemory(UInt64 needed_memory_) { needed_memory = needed_memory_; }
+
     bool schedule(ScheduleState state);
     void waitForSchedule();
 
@@ -50,6 +54,7 @@ private:
     MPPTaskId id;
 
     int needed_threads;
+    UInt64 needed_memory;
 
     std::mutex schedule_mu;
     std::condition_variable schedule_cv;
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/FailPoint.h>
+#include <Common/MemoryTracker.h>
 #include <Common/TiFlashMetrics.h>
 #include <Common/getNumberOfCPUCores.h>
 #include <Flash/Mpp/MPPTaskManager.h>
@@ -27,11 +28,13 @@ extern const char random_min_tso_scheduler_failpoint[];
 
 constexpr UInt64 OS_THREAD_SOFT_LIMIT = 100000;
 
-MinTSOScheduler::MinTSOScheduler(UInt64 soft_limit, UInt64 hard_limit, UInt64 active_set_soft_limit_)
+MinTSOScheduler::MinTSOScheduler(UInt64 soft_limit, UInt64 hard_limit, UInt64 active_set_soft_limit_, UInt64 memory_limit_)
     : min_query_id(MPPTaskId::Max_Query_Id)
     , thread_soft_limit(soft_limit)
     , thread_hard_limit(hard_limit)
     , estimated_thread_usage(0)
+    , memory_limit(memory_limit_)
+    , estimated_memory_usage(0)
     , active_set_soft_limit(active_set_soft_limit_)
     , log(Logger::get())
 {
@@ -57,6 +60,7 @@ MinTSOScheduler::MinTSOScheduler(UInt64 soft_limit, UInt64 hard_limit, UInt64 ac
         {
             LOG_INFO(log, "thread_hard_limit is {}, thread_soft_limit is {}, and active_set_soft_limit is {} in MinTSOScheduler.", thread_hard_limit, thread_soft_limit, active_set_soft_limit);
         }
+        LOG_INFO(log, "memory_limit is {} in MinTSOScheduler.", memory_limit);
         GET_METRIC(tiflash_task_scheduler, type_min_tso).Set(min_query_id.query_ts);
         GET_METRIC(tiflash_task_scheduler, type_thread_soft_limit).Set(thread_soft_limit);
         GET_METRIC(tiflash_task_scheduler, type_thread_hard_limit).Set(thread_hard_limit);
@@ -66,6 +70,10 @@ MinTSOScheduler::MinTSOScheduler(UInt64 soft_limit, UInt64 hard_limit, UInt64 ac
         GET_METRIC(tiflash_task_scheduler, type_waiting_tasks_count).Set(0);
         GET_METRIC(tiflash_task_scheduler, type_active_tasks_count).Set(0);
         GET_METRIC(tiflash_task_scheduler, type_hard_limit_exceeded_count).Set(0);
+        GET_METRIC(tiflash_task_scheduler, type_estimated_memory_usage).Set(estimated_memory_usage);
+        GET_METRIC(tiflash_task_scheduler, type_memory_limit).Set(memory_limit);
+        GET_METRIC(tiflash_task_scheduler, type_memory_limit_exceeded_count).Set(0);
+        GET_METRIC(tiflash_task_scheduler, type_memory_limit_ignored_count).Set(0);
     }
 }
 
@@ -126,7 +134,7 @@ void MinTSOScheduler::deleteQuery(const MPPQueryId & query_id, MPPTaskManager &
 }
 
 /// NOTE: should not throw exceptions due to being called when destruction.
-void MinTSOScheduler::releaseThreadsThenSchedule(const int needed_threads, MPPTaskManager & task_manager)
+void MinTSOScheduler::releaseResourcesThenSchedule(const int needed_threads, const UInt64 needed_memory, MPPTaskManager & task_manager)
 {
     if (isDisabled())
     {
@@ -135,11 +143,14 @@ void MinTSOScheduler::releaseThreadsThenSchedule(const int needed_threads, MPPTa
 
     auto updated_estimated_threads = static_cast<Int64>(estimated_thread_usage) - needed_threads;
     RUNTIME_ASSERT(updated_estimated_threads >= 0, log, "estimated_thread_usage should not be smaller than 0, actually is {}.", updated_estimated_threads);
+    RUNTIME_ASSERT(estimated_memory_usage >= needed_memory, log, "estimated_memory_usage {} should not be smaller than the released memory {}.", estimated_memory_usage, needed_memory);
 
     estimated_thread_usage = updated_estimated_threads;
+    estimated_memory_usage -= needed_memory;
     GET_METRIC(tiflash_task_scheduler, type_estimated_thread_usage).Set(estimated_thread_usage);
+    GET_METRIC(tiflash_task_scheduler, type_estimated_memory_usage).Set(estimated_memory_usage);
     GET_METRIC(tiflash_task_scheduler, type_active_tasks_count).Decrement();
-    /// as tasks release some threads, so some tasks would get scheduled.
+    /// as tasks release some threads and memory, so some tasks would get scheduled.
     scheduleWaitingQueries(task_manager);
 }
 
@@ -189,19 +200,29 @@ void MinTSOScheduler::scheduleWaitingQueries(MPPTaskManager & task_manager)
 bool MinTSOScheduler::scheduleImp(const MPPQueryId & query_id, const MPPQueryTaskSetPtr & query_task_set, MPPTaskScheduleEntry & schedule_entry, const bool isWaiting, bool & has_error)
 {
     auto needed_threads = schedule_entry.getNeededThreads();
+    auto needed_memory = schedule_entry.getNeededMemory();
+    auto memory_available = isMemoryAvailable(needed_memory);
     auto check_for_new_min_tso = query_id <= min_query_id && estimated_thread_usage + needed_threads <= thread_hard_limit;
     auto check_for_not_min_tso = (active_set.size() < active_set_soft_limit || query_id <= *active_set.rbegin()) && (estimated_thread_usage + needed_threads <= thread_soft_limit);
-    if (check_for_new_min_tso || check_for_not_min_tso)
+    if (check_for_new_min_tso || (check_for_not_min_tso && memory_available))
     {
+        if (!memory_available)
+        {
+            /// the min_query_id query is scheduled beyond the memory limit to avoid hanging, rely on the memory limit of query and spilling to protect the node.
+            LOG_WARNING(log, "{} is scheduled beyond the memory limit {}, need {} bytes, estimated {} bytes of memory are used.", schedule_entry.getMPPTaskId().toString(), memory_limit, needed_memory, estimated_memory_usage);
+            GET_METRIC(tiflash_task_scheduler, type_memory_limit_ignored_count).Increment();
+        }
         updateMinQueryId(query_id, false, isWaiting ? "from the waiting set" : "when directly schedule it");
         active_set.insert(query_id);
         if (schedule_entry.schedule(ScheduleState::SCHEDULED))
         {
             estimated_thread_usage += needed_threads;
+            estimated_memory_usage += needed_memory;
             GET_METRIC(tiflash_task_scheduler, type_active_tasks_count).Increment();
         }
         GET_METRIC(tiflash_task_scheduler, type_active_queries_count).Set(active_set.size());
         GET_METRIC(tiflash_task_scheduler, type_estimated_thread_usage).Set(estimated_thread_usage);
+        GET_METRIC(tiflash_task_scheduler, type_estimated_memory_usage).Set(estimated_memory_usage);
         LOG_INFO(log, "{} is scheduled (active set size = {}) due to available threads {}, after applied for {} threads, used {} of the thread {} limit {}.", schedule_entry.getMPPTaskId().toString(), active_set.size(), isWaiting ? "from the waiting set" : "directly", needed_threads, estimated_thread_usage, min_query_id == query_id ? "hard" : "soft", min_query_id == query_id ? thread_hard_limit : thread_soft_limit);
         return true;
     }
@@ -233,12 +254,26 @@ bool MinTSOScheduler::scheduleImp(const MPPQueryId & query_id, const MPPQueryTas
             query_task_set->waiting_tasks.push(schedule_entry.getMPPTaskId());
             GET_METRIC(tiflash_task_scheduler, type_waiting_queries_count).Set(waiting_set.size());
             GET_METRIC(tiflash_task_scheduler, type_waiting_tasks_count).Increment();
+            if (check_for_not_min_tso && !memory_available)
+                GET_METRIC(tiflash_task_scheduler, type_memory_limit_exceeded_count).Increment();
         }
-        LOG_INFO(log, "threads are unavailable for the query {} or active set is full (size =  {}), need {}, but used {} of the thread soft limit {},{} waiting set size = {}", query_id.toString(), active_set.size(), needed_threads, estimated_thread_usage, thread_soft_limit, isWaiting ? "" : " put into", waiting_set.size());
+        if (check_for_not_min_tso && !memory_available)
+            LOG_INFO(log, "memory is unavailable for the query {}, need {} bytes, but estimated {} bytes of the memory limit {} are used,{} waiting set size = {}", query_id.toString(), needed_memory, estimated_memory_usage, memory_limit, isWaiting ? "" : " put into", waiting_set.size());
+        else
+            LOG_INFO(log, "threads are unavailable for the query {} or active set is full (size =  {}), need {}, but used {} of the thread soft limit {},{} waiting set size = {}", query_id.toString(), active_set.size(), needed_threads, estimated_thread_usage, thread_soft_limit, isWaiting ? "" : " put into", waiting_set.size());
         return false;
     }
 }
 
+bool MinTSOScheduler::isMemoryAvailable(UInt64 needed_memory) const
+{
+    if (memory_limit == 0)
+        return true;
+    /// the estimation may be far from the actual usage, so the memory tracked by running queries is also taken into account.
+    auto tracked_memory = root_of_query_mem_trackers ? std::max<Int64>(root_of_query_mem_trackers->get(), 0) : 0;
+    return std::max(estimated_memory_usage, static_cast<UInt64>(tracked_memory)) + needed_memory <= memory_limit;
+}
+
 /// if return true, then need to schedule the waiting tasks of the min_query_id.
 bool MinTSOScheduler::updateMinQueryId(const MPPQueryId & query_id, const bool retired, const String & msg)
 {
@@ -30,12 +30,15 @@ using MPPQueryTaskSetPtr = std::shared_ptr<MPPQueryTaskSet>;
 
 /// scheduling tasks in the set according to the tso order under the soft limit of threads, but allow the min_query_id query to preempt threads under the hard limit of threads.
 /// The min_query_id query avoids the deadlock resulted from threads competition among nodes.
+/// If memory_limit is set, the other queries are also scheduled under the limit of memory, which is projected by the max of
+/// the estimated memory of running tasks and the memory tracked by running queries, plus the estimated memory of the new task.
+/// The min_query_id query ignores the memory limit, because it can not wait for the memory released by the newer queries.
 /// schedule tasks under the lock protection of the task manager.
 /// NOTE: if the updated min-tso query has waiting tasks, necessarily scheduling them, otherwise the query would hang.
 class MinTSOScheduler : private boost::noncopyable
 {
 public:
-    MinTSOScheduler(UInt64 soft_limit, UInt64 hard_limit, UInt64 active_set_soft_limit_);
+    MinTSOScheduler(UInt64 soft_limit, UInt64 hard_limit, UInt64 active_set_soft_limit_, UInt64 memory_limit_ = 0);
     ~MinTSOScheduler() = default;
     /// try to schedule this task if it is the min_query_id query or there are enough threads, otherwise put it into the waiting set.
     /// NOTE: call tryToSchedule under the lock protection of MPPTaskManager
@@ -45,8 +48,8 @@ public:
     /// NOTE: call deleteQuery under the lock protection of MPPTaskManager
     void deleteQuery(const MPPQueryId & query_id, MPPTaskManager & task_manager, const bool is_cancelled);
 
-    /// all scheduled tasks should finally call this function to release threads and schedule new tasks
-    void releaseThreadsThenSchedule(const int needed_threads, MPPTaskManager & task_manager);
+    /// all scheduled tasks should finally call this function to release threads and memory, and schedule new tasks
+    void releaseResourcesThenSchedule(const int needed_threads, const UInt64 needed_memory, MPPTaskManager & task_manager);
 
 private:
     bool scheduleImp(const MPPQueryId & query_id, const MPPQueryTaskSetPtr & query_task_set, MPPTaskScheduleEntry & schedule_entry, const bool isWaiting, bool & has_error);
@@ -56,12 +59,17 @@ private:
     {
         return thread_hard_limit == 0 && thread_soft_limit == 0;
     }
+    /// return true if the memory limit is not set or the task can be scheduled under the memory limit.
+    bool isMemoryAvailable(UInt64 needed_memory) const;
     std::set<MPPQueryId> waiting_set;
     std::set<MPPQueryId> active_set;
     MPPQueryId min_query_id;
     UInt64 thread_soft_limit;
     UInt64 thread_hard_limit;
     UInt64 estimated_thread_usage;
+    /// 0 means the memory usage is not limited.
+    UInt64 memory_limit;
+    UInt64 estimated_memory_usage;
     /// to prevent from too many queries just issue a part of tasks to occupy threads, in proportion to the hardware cores.
     size_t active_set_soft_limit;
     LoggerPtr log;
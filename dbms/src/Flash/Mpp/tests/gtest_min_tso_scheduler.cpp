@@ -0,0 +1,124 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Mpp/MPPTask.h>
+#include <Flash/Mpp/MPPTaskManager.h>
+#include <Flash/Mpp/MinTSOScheduler.h>
+#include <Interpreters/Settings.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace DB
+{
+namespace tests
+{
+class MinTSOSchedulerTest : public ::testing::Test
+{
+protected:
+    static constexpr UInt64 MiB = 1024 * 1024;
+
+    void initManager(UInt64 memory_limit)
+    {
+        manager = std::make_unique<MPPTaskManager>(std::make_unique<MinTSOScheduler>(100, 200, 2, memory_limit));
+    }
+
+    std::unique_ptr<MPPTaskScheduleEntry> newEntry(UInt64 query_ts, Int64 task_id, UInt64 needed_memory)
+    {
+        MPPTaskId id(/*start_ts=*/query_ts, task_id, /*server_id=*/1, query_ts, /*local_query_id=*/1);
+        if (!manager->getQueryTaskSetWithoutLock(id.query_id))
+            manager->addMPPQueryTaskSet(id.query_id);
+        auto entry = std::make_unique<MPPTaskScheduleEntry>(manager.get(), id);
+        entry->setNeededThreads(10);
+        entry->setNeededMemory(needed_memory);
+        return entry;
+    }
+
+    std::unique_ptr<MPPTaskManager> manager;
+};
+
+TEST_F(MinTSOSchedulerTest, ScheduleUnderMemoryLimit)
+try
+{
+    initManager(100 * MiB);
+
+    auto entry1 = newEntry(10, 1, 80 * MiB);
+    ASSERT_TRUE(manager->tryToScheduleTask(*entry1));
+    // The memory is not enough for the newer query, it waits.
+    auto entry2 = newEntry(20, 2, 30 * MiB);
+    ASSERT_FALSE(manager->tryToScheduleTask(*entry2));
+    // The task fits under the memory limit is scheduled.
+    auto entry3 = newEntry(30, 3, 10 * MiB);
+    ASSERT_TRUE(manager->tryToScheduleTask(*entry3));
+    // The min-tso query ignores the memory limit.
+    auto entry4 = newEntry(5, 4, 200 * MiB);
+    ASSERT_TRUE(manager->tryToScheduleTask(*entry4));
+
+    // The memory is released by the finished tasks.
+    entry4.reset();
+    entry1.reset();
+    auto entry5 = newEntry(20, 5, 30 * MiB);
+    ASSERT_TRUE(manager->tryToScheduleTask(*entry5));
+}
+CATCH
+
+TEST_F(MinTSOSchedulerTest, NoMemoryLimit)
+try
+{
+    initManager(0);
+
+    auto entry1 = newEntry(10, 1, 80 * MiB);
+    ASSERT_TRUE(manager->tryToScheduleTask(*entry1));
+    auto entry2 = newEntry(20, 2, 1024 * MiB);
+    ASSERT_TRUE(manager->tryToScheduleTask(*entry2));
+}
+CATCH
+
+TEST(MPPTaskMemoryEstimationTest, EstimateMemoryUsage)
+try
+{
+    // aggregation <- topN <- join <- (table scan, table scan)
+    tipb::DAGRequest dag_req;
+    auto * agg = dag_req.mutable_root_executor();
+    agg->set_tp(tipb::ExecType::TypeAggregation);
+    auto * topn = agg->mutable_aggregation()->mutable_child();
+    topn->set_tp(tipb::ExecType::TypeTopN);
+    auto * join = topn->mutable_topn()->mutable_child();
+    join->set_tp(tipb::ExecType::TypeJoin);
+    join->mutable_join()->add_children()->set_tp(tipb::ExecType::TypeTableScan);
+    join->mutable_join()->add_children()->set_tp(tipb::ExecType::TypeTableScan);
+
+    Settings settings;
+    settings.task_scheduler_estimated_memory_per_operator = 100;
+    // Neither the spill thresholds nor the query memory limit are set.
+    ASSERT_EQ(estimateMemoryUsage(dag_req, settings, 0), 300);
+
+    // The spill threshold bounds the operator from above, even if it is larger than the default.
+    settings.max_bytes_before_external_group_by = 1000;
+    ASSERT_EQ(estimateMemoryUsage(dag_req, settings, 0), 1200);
+
+    // The operators that can not spill are bounded by the query memory limit.
+    settings.max_memory_usage.set(static_cast<UInt64>(5000));
+    ASSERT_EQ(estimateMemoryUsage(dag_req, settings, 0), 5000);
+    settings.max_bytes_before_external_join = 10;
+    settings.max_bytes_before_external_sort = 20;
+    ASSERT_EQ(estimateMemoryUsage(dag_req, settings, 0), 1030);
+    settings.max_memory_usage.set(static_cast<UInt64>(500));
+    ASSERT_EQ(estimateMemoryUsage(dag_req, settings, 0), 500);
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/FmtUtils.h>
 #include <Flash/Pipeline/Exec/PipelineExec.h>
 #include <Operators/OperatorHelper.h>
 
@@ -119,4 +120,14 @@ OperatorStatus PipelineExec::awaitImpl()
     op_status = source_op->await();
     return op_status;
 }
+
+String PipelineExec::toString() const
+{
+    FmtBuffer buffer;
+    buffer.append(source_op->getName());
+    for (const auto & transform_op : transform_ops)
+        buffer.fmtAppend(" -> {}", transform_op->getName());
+    buffer.fmtAppend(" -> {}", sink_op->getName());
+    return buffer.toString();
+}
 } // namespace DB
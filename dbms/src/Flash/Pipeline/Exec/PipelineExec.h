@@ -42,6 +42,9 @@ public:
 
     OperatorStatus await();
 
+    /// The names of the operators from the source to the sink.
+    String toString() const;
+
 private:
     OperatorStatus executeImpl();
 
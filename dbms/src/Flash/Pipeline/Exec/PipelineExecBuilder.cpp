@@ -58,6 +58,19 @@ Block PipelineExecBuilder::getCurrentHeader() const
     }
 }
 
+OperatorProfileInfoPtr PipelineExecBuilder::getCurProfileInfo() const
+{
+    if (sink_op)
+        return sink_op->getProfileInfo();
+    else if (!transform_ops.empty())
+        return transform_ops.back()->getProfileInfo();
+    else
+    {
+        assert(source_op);
+        return source_op->getProfileInfo();
+    }
+}
+
 void PipelineExecGroupBuilder::init(size_t init_concurrency)
 {
     assert(concurrency == 0);
@@ -80,4 +93,14 @@ Block PipelineExecGroupBuilder::getCurrentHeader()
     assert(!group.empty());
     return group.back().getCurrentHeader();
 }
+
+OperatorProfileInfos PipelineExecGroupBuilder::getCurProfileInfos() const
+{
+    assert(concurrency > 0);
+    OperatorProfileInfos ret;
+    ret.reserve(group.size());
+    for (const auto & builder : group)
+        ret.push_back(builder.getCurProfileInfo());
+    return ret;
+}
 } // namespace DB
@@ -30,6 +30,9 @@ struct PipelineExecBuilder
 
     Block getCurrentHeader() const;
 
+    /// The profile info of the last operator added.
+    OperatorProfileInfoPtr getCurProfileInfo() const;
+
     PipelineExecPtr build();
 };
 
@@ -57,5 +60,7 @@ struct PipelineExecGroupBuilder
     PipelineExecGroup build();
 
     Block getCurrentHeader();
+
+    OperatorProfileInfos getCurProfileInfos() const;
 };
 } // namespace DB
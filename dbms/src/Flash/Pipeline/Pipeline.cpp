@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/FmtUtils.h>
+#include <Flash/Coprocessor/DAGContext.h>
 #include <Flash/Coprocessor/FineGrainedShuffle.h>
 #include <Flash/Executor/PipelineExecutorStatus.h>
 #include <Flash/Pipeline/Exec/PipelineExecBuilder.h>
@@ -22,7 +23,9 @@
 #include <Flash/Pipeline/Schedule/Events/PlainPipelineEvent.h>
 #include <Flash/Planner/PhysicalPlanNode.h>
 #include <Flash/Planner/Plans/PhysicalGetResultSink.h>
+#include <Flash/Planner/Plans/PhysicalTableScan.h>
 #include <Flash/Statistics/traverseExecutors.h>
+#include <Interpreters/Context.h>
 #include <tipb/select.pb.h>
 
 namespace DB
@@ -164,8 +167,14 @@ PipelineExecGroup Pipeline::buildExecGroup(PipelineExecutorStatus & exec_status,
 {
     assert(!plan_nodes.empty());
     PipelineExecGroupBuilder builder;
+    auto * dag_context = context.getDAGContext();
     for (const auto & plan_node : plan_nodes)
+    {
         plan_node->buildPipelineExecGroup(exec_status, builder, context, concurrency);
+        // Like `PhysicalPlanNode::recordProfileStreams`, the last operator built by the plan node is recorded.
+        if (dag_context && plan_node->isTiDBOperator())
+            dag_context->addOperatorProfileInfos(plan_node->execId(), builder.getCurProfileInfos());
+    }
     return builder.build();
 }
 
@@ -219,11 +228,28 @@ PipelineEvents Pipeline::toSelfEvents(PipelineExecutorStatus & status, Context &
     return {std::move(self_events), isFineGrainedMode()};
 }
 
+EventPtr Pipeline::toLearnerReadEvent(PipelineExecutorStatus & status, Context & context, size_t concurrency)
+{
+    assert(!plan_nodes.empty());
+    // Only the source plan node reads the table.
+    const auto & source = plan_nodes.front();
+    if (source->tp() != PlanType::TableScan)
+        return nullptr;
+    auto memory_tracker = current_memory_tracker ? current_memory_tracker->shared_from_this() : nullptr;
+    return std::static_pointer_cast<PhysicalTableScan>(source)->toLearnerReadEvent(status, memory_tracker, context, concurrency);
+}
+
 PipelineEvents Pipeline::doToEvents(PipelineExecutorStatus & status, Context & context, size_t concurrency, Events & all_events)
 {
     auto self_events = toSelfEvents(status, context, concurrency);
     for (const auto & child : children)
         self_events.mapInputs(child->doToEvents(status, context, concurrency, all_events));
+    if (auto learner_read_event = toLearnerReadEvent(status, context, concurrency); learner_read_event)
+    {
+        for (const auto & event : self_events.events)
+            event->addInput(learner_read_event);
+        all_events.push_back(learner_read_event);
+    }
     all_events.insert(all_events.end(), self_events.events.cbegin(), self_events.events.cend());
     return self_events;
 }
@@ -80,6 +80,9 @@ public:
 private:
     void toSelfString(FmtBuffer & buffer, size_t level) const;
 
+    // Return the event doing the learner read if the source of the pipeline is a table scan, see `PhysicalTableScan::toLearnerReadEvent`.
+    EventPtr toLearnerReadEvent(PipelineExecutorStatus & status, Context & context, size_t concurrency);
+
     PipelineEvents toSelfEvents(PipelineExecutorStatus & status, Context & context, size_t concurrency);
     PipelineEvents doToEvents(PipelineExecutorStatus & status, Context & context, size_t concurrency, Events & all_events);
 
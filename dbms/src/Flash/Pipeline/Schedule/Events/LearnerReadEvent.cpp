@@ -0,0 +1,36 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <Flash/Coprocessor/DAGStorageInterpreter.h>
+#include <Flash/Pipeline/Schedule/Events/LearnerReadEvent.h>
+#include <Flash/Pipeline/Schedule/Tasks/LearnerReadTask.h>
+#include <Flash/Planner/Plans/PhysicalTableScan.h>
+
+namespace DB
+{
+std::vector<TaskPtr> LearnerReadEvent::scheduleImpl()
+{
+    assert(storage_interpreter);
+    std::vector<TaskPtr> tasks;
+    tasks.push_back(std::make_unique<LearnerReadTask>(mem_tracker, log->identifier(), exec_status, shared_from_this(), storage_interpreter));
+    return tasks;
+}
+
+void LearnerReadEvent::finishImpl()
+{
+    // Like `PlainPipelineEvent::finishImpl`, release the resources before `exec_status.onEventFinish()` is called.
+    // The interpreter is still held by the table scan to build the input streams.
+    storage_interpreter.reset();
+    table_scan.reset();
+}
+} // namespace DB
@@ -0,0 +1,48 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <Flash/Pipeline/Schedule/Events/Event.h>
+
+namespace DB
+{
+class PhysicalTableScan;
+class DAGStorageInterpreter;
+
+/// The event doing the learner read of a table scan, the pipeline reading the table scan depends on it.
+class LearnerReadEvent : public Event
+{
+public:
+    LearnerReadEvent(
+        PipelineExecutorStatus & exec_status_,
+        MemoryTrackerPtr mem_tracker_,
+        const String & req_id,
+        const std::shared_ptr<PhysicalTableScan> & table_scan_,
+        const std::shared_ptr<DAGStorageInterpreter> & storage_interpreter_)
+        : Event(exec_status_, std::move(mem_tracker_), req_id)
+        , table_scan(table_scan_)
+        , storage_interpreter(storage_interpreter_)
+    {}
+
+protected:
+    std::vector<TaskPtr> scheduleImpl() override;
+
+    void finishImpl() override;
+
+private:
+    // Keep the table scan alive because the interpreter refers to its members.
+    std::shared_ptr<PhysicalTableScan> table_scan;
+    std::shared_ptr<DAGStorageInterpreter> storage_interpreter;
+};
+} // namespace DB
@@ -50,8 +50,10 @@ protected:
 private:
     ExecTaskStatus doTaskAction(std::function<ExecTaskStatus()> && action);
 
-private:
+protected:
     PipelineExecutorStatus & exec_status;
+
+private:
     EventPtr event;
     bool finalized = false;
 };
@@ -0,0 +1,57 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <Flash/Coprocessor/DAGStorageInterpreter.h>
+#include <Flash/Pipeline/Schedule/Tasks/LearnerReadTask.h>
+
+namespace DB
+{
+LearnerReadTask::LearnerReadTask(
+    MemoryTrackerPtr mem_tracker_,
+    const String & req_id,
+    PipelineExecutorStatus & exec_status_,
+    const EventPtr & event_,
+    const std::shared_ptr<DAGStorageInterpreter> & storage_interpreter_)
+    : EventTask(std::move(mem_tracker_), req_id, exec_status_, event_)
+    , storage_interpreter(storage_interpreter_)
+{
+    assert(storage_interpreter);
+}
+
+ExecTaskStatus LearnerReadTask::doExecuteImpl()
+{
+    if (!started)
+    {
+        // No local region to read.
+        if (!storage_interpreter->startLearnerRead())
+            return ExecTaskStatus::FINISHED;
+        started = true;
+        return ExecTaskStatus::WAITING;
+    }
+    if (storage_interpreter->finishLearnerRead())
+        return ExecTaskStatus::FINISHED;
+    // Some regions are unavailable for batch cop, retry the learner read for the rest regions.
+    started = false;
+    return ExecTaskStatus::RUNNING;
+}
+
+ExecTaskStatus LearnerReadTask::doAwaitImpl()
+{
+    return storage_interpreter->pollLearnerRead() ? ExecTaskStatus::RUNNING : ExecTaskStatus::WAITING;
+}
+
+void LearnerReadTask::finalizeImpl()
+{
+    storage_interpreter.reset();
+}
+} // namespace DB
@@ -0,0 +1,46 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <Flash/Pipeline/Schedule/Tasks/EventTask.h>
+
+namespace DB
+{
+class DAGStorageInterpreter;
+
+/// Do the learner read of a table scan, see `DAGStorageInterpreter::startLearnerRead`.
+/// The read index requests are sent and the locks are resolved in the task threads,
+/// while waiting for the read index and the applied index is checked by `WaitReactor`.
+class LearnerReadTask : public EventTask
+{
+public:
+    LearnerReadTask(
+        MemoryTrackerPtr mem_tracker_,
+        const String & req_id,
+        PipelineExecutorStatus & exec_status_,
+        const EventPtr & event_,
+        const std::shared_ptr<DAGStorageInterpreter> & storage_interpreter_);
+
+protected:
+    ExecTaskStatus doExecuteImpl() override;
+
+    ExecTaskStatus doAwaitImpl() override;
+
+    void finalizeImpl() override;
+
+private:
+    std::shared_ptr<DAGStorageInterpreter> storage_interpreter;
+    bool started = false;
+};
+} // namespace DB
@@ -27,11 +27,18 @@ PipelineTask::PipelineTask(
     PipelineExecPtr && pipeline_exec_)
     : EventTask(std::move(mem_tracker_), req_id, exec_status_, event_)
     , pipeline_exec(std::move(pipeline_exec_))
+    , name(pipeline_exec->toString())
 {
     assert(pipeline_exec);
     pipeline_exec->executePrefix();
 }
 
+PipelineTask::~PipelineTask()
+{
+    profile_info.end_ts_ns = clock_gettime_ns();
+    exec_status.getTaskTracer().add(name, profile_info);
+}
+
 void PipelineTask::finalizeImpl()
 {
     assert(pipeline_exec);
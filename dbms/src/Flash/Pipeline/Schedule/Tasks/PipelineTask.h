@@ -29,6 +29,8 @@ public:
         const EventPtr & event_,
         PipelineExecPtr && pipeline_exec_);
 
+    ~PipelineTask();
+
 protected:
     ExecTaskStatus doExecuteImpl() override;
 
@@ -38,5 +40,7 @@ protected:
 
 private:
     PipelineExecPtr pipeline_exec;
+    // The name of the task in the trace.
+    const String name;
 };
 } // namespace DB
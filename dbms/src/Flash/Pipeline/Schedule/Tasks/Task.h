@@ -17,6 +17,8 @@
 #include <Common/FailPoint.h>
 #include <Common/Logger.h>
 #include <Common/MemoryTracker.h>
+#include <Common/Stopwatch.h>
+#include <Flash/Pipeline/Schedule/Tasks/TaskProfileInfo.h>
 #include <common/logger_useful.h>
 #include <memory.h>
 
@@ -74,7 +76,10 @@ public:
     ExecTaskStatus execute() noexcept
     {
         assert(getMemTracker().get() == current_memory_tracker);
+        // The task is taken from the task queue, or keeps running in the same task thread.
+        profile_info.queue_time_ns += stopwatch.elapsedFromLastTime();
         switchStatus(executeImpl());
+        profile_info.execute_time_ns += stopwatch.elapsedFromLastTime();
         return exec_status;
     }
 
@@ -82,9 +87,13 @@ public:
     {
         assert(getMemTracker().get() == current_memory_tracker);
         switchStatus(awaitImpl());
+        // The time since the last `execute` or `await` is spent in waiting.
+        profile_info.wait_time_ns += stopwatch.elapsedFromLastTime();
         return exec_status;
     }
 
+    const TaskProfileInfo & getProfileInfo() const { return profile_info; }
+
 protected:
     virtual ExecTaskStatus executeImpl() noexcept = 0;
     // Avoid allocating memory in `await` if possible.
@@ -104,6 +113,9 @@ protected:
     MemoryTrackerPtr mem_tracker;
     LoggerPtr log;
 
+    TaskProfileInfo profile_info;
+    Stopwatch stopwatch;
+
 private:
     ExecTaskStatus exec_status{ExecTaskStatus::INIT};
 };
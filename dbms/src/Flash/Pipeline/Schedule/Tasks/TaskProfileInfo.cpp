@@ -0,0 +1,82 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/FmtUtils.h>
+#include <Flash/Pipeline/Schedule/Tasks/TaskProfileInfo.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace DB
+{
+String TaskProfileInfo::toJson() const
+{
+    return fmt::format(
+        R"({{"execute_time_ns":{},"queue_time_ns":{},"wait_time_ns":{}}})",
+        execute_time_ns,
+        queue_time_ns,
+        wait_time_ns);
+}
+
+void TaskTracer::add(const String & task_name, const TaskProfileInfo & profile_info)
+{
+    std::lock_guard lock(mu);
+    tasks.emplace_back(task_name, profile_info);
+}
+
+TaskProfileInfo TaskTracer::getTotal() const
+{
+    TaskProfileInfo total;
+    std::lock_guard lock(mu);
+    for (const auto & task : tasks)
+        total.merge(task.second);
+    return total;
+}
+
+size_t TaskTracer::size() const
+{
+    std::lock_guard lock(mu);
+    return tasks.size();
+}
+
+String TaskTracer::toChromeTrace() const
+{
+    std::lock_guard lock(mu);
+    UInt64 min_start_ts_ns = std::numeric_limits<UInt64>::max();
+    for (const auto & task : tasks)
+        min_start_ts_ns = std::min(min_start_ts_ns, task.second.start_ts_ns);
+
+    // The tasks run concurrently, so each task is shown in its own track.
+    size_t tid = 0;
+    FmtBuffer buffer;
+    buffer.append(R"({"traceEvents":[)");
+    buffer.joinStr(
+        tasks.cbegin(),
+        tasks.cend(),
+        [&](const auto & task, FmtBuffer & fb) {
+            const auto & [name, info] = task;
+            // The timestamps of Chrome Trace Event Format are in microseconds.
+            fb.fmtAppend(
+                R"({{"name":"{}","cat":"pipeline_task","ph":"X","pid":0,"tid":{},"ts":{},"dur":{},"args":{}}})",
+                name,
+                tid++,
+                (info.start_ts_ns - min_start_ts_ns) / 1000,
+                (std::max(info.end_ts_ns, info.start_ts_ns) - info.start_ts_ns) / 1000,
+                info.toJson());
+        },
+        ",");
+    buffer.append("]}");
+    return buffer.toString();
+}
+} // namespace DB
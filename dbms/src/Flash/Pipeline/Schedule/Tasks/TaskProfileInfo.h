@@ -0,0 +1,68 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/Stopwatch.h>
+#include <common/types.h>
+
+#include <mutex>
+#include <vector>
+
+namespace DB
+{
+/// The time a task spent in each state of its lifetime.
+struct TaskProfileInfo
+{
+    /// The time spent in `Task::execute`, the task is RUNNING in a task thread.
+    UInt64 execute_time_ns = 0;
+    /// The time spent in the task queue, waiting for a task thread.
+    UInt64 queue_time_ns = 0;
+    /// The time spent in WAITING, polled by the wait reactor.
+    UInt64 wait_time_ns = 0;
+
+    /// The time the task is created and finished, from the monotonic clock.
+    UInt64 start_ts_ns = clock_gettime_ns();
+    UInt64 end_ts_ns = 0;
+
+    void merge(const TaskProfileInfo & other)
+    {
+        execute_time_ns += other.execute_time_ns;
+        queue_time_ns += other.queue_time_ns;
+        wait_time_ns += other.wait_time_ns;
+    }
+
+    String toJson() const;
+};
+
+/// Collects the profile infos of the finished tasks of a query, which can be exported
+/// in the Chrome Trace Event Format and loaded by `chrome://tracing` or Perfetto.
+class TaskTracer
+{
+public:
+    void add(const String & task_name, const TaskProfileInfo & profile_info);
+
+    /// The sum of the profile infos of all finished tasks.
+    TaskProfileInfo getTotal() const;
+
+    size_t size() const;
+
+    /// Each task is a complete event lasting from its creation to its end.
+    String toChromeTrace() const;
+
+private:
+    mutable std::mutex mu;
+    std::vector<std::pair<String, TaskProfileInfo>> tasks;
+};
+} // namespace DB
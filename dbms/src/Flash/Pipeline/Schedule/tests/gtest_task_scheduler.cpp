@@ -177,6 +177,25 @@ private:
     Waiter & waiter;
 };
 
+class SleepTask : public Task
+{
+public:
+    static constexpr auto sleep_time = std::chrono::milliseconds(20);
+
+protected:
+    ExecTaskStatus executeImpl() noexcept override
+    {
+        std::this_thread::sleep_for(sleep_time);
+        if (executed)
+            return ExecTaskStatus::FINISHED;
+        executed = true;
+        return ExecTaskStatus::WAITING;
+    }
+
+private:
+    bool executed = false;
+};
+
 class DeadLoopTask : public Task
 {
 protected:
@@ -272,4 +291,31 @@ try
 }
 CATCH
 
+TEST_F(TaskSchedulerTestRunner, task_profile)
+try
+{
+    const UInt64 sleep_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(SleepTask::sleep_time).count();
+    SleepTask task;
+    ASSERT_EQ(task.execute(), ExecTaskStatus::WAITING);
+    std::this_thread::sleep_for(SleepTask::sleep_time);
+    ASSERT_EQ(task.await(), ExecTaskStatus::RUNNING);
+    std::this_thread::sleep_for(SleepTask::sleep_time);
+    ASSERT_EQ(task.execute(), ExecTaskStatus::FINISHED);
+
+    const auto & profile_info = task.getProfileInfo();
+    ASSERT_GE(profile_info.execute_time_ns, 2 * sleep_time_ns);
+    ASSERT_GE(profile_info.wait_time_ns, sleep_time_ns);
+    ASSERT_GE(profile_info.queue_time_ns, sleep_time_ns);
+
+    TaskTracer tracer;
+    tracer.add("a -> b", profile_info);
+    tracer.add("a -> b", profile_info);
+    ASSERT_EQ(tracer.size(), 2);
+    ASSERT_EQ(tracer.getTotal().execute_time_ns, 2 * profile_info.execute_time_ns);
+    auto trace = tracer.toChromeTrace();
+    ASSERT_EQ(trace.find(R"({"traceEvents":[{"name":"a -> b","cat":"pipeline_task","ph":"X","pid":0,"tid":0,"ts":0,)"), 0) << trace;
+    ASSERT_NE(trace.find(R"("tid":1)"), String::npos) << trace;
+}
+CATCH
+
 } // namespace DB::tests
@@ -62,6 +62,18 @@ bool pushDownSelection(Context & context, const PhysicalPlanNodePtr & plan, cons
     return false;
 }
 
+/// Return the threshold shared by the TopN and the table scan, nullptr if not any.
+TopNThresholdPtr pushDownLimit(const Context & context, const PhysicalPlanNodePtr & plan, const tipb::Executor & limit_or_topn)
+{
+    if (plan->tp() == PlanType::TableScan)
+    {
+        auto physical_table_scan = std::static_pointer_cast<PhysicalTableScan>(plan);
+        if (physical_table_scan->setLimitHint(limit_or_topn, context.getSettingsRef().dt_enable_topn_threshold))
+            return physical_table_scan->getTopNThreshold();
+    }
+    return nullptr;
+}
+
 void fillOrderForListBasedExecutors(DAGContext & dag_context, const PhysicalPlanNodePtr & root_node)
 {
     auto & list_based_executors_order = dag_context.list_based_executors_order;
@@ -111,13 +123,21 @@ void PhysicalPlan::build(const String & executor_id, const tipb::Executor * exec
     switch (executor->tp())
     {
     case tipb::ExecType::TypeLimit:
+    {
         GET_METRIC(tiflash_coprocessor_executor_count, type_limit).Increment();
-        pushBack(PhysicalLimit::build(executor_id, log, executor->limit(), popBack()));
+        auto child = popBack();
+        pushDownLimit(context, child, *executor);
+        pushBack(PhysicalLimit::build(executor_id, log, executor->limit(), child));
         break;
+    }
     case tipb::ExecType::TypeTopN:
+    {
         GET_METRIC(tiflash_coprocessor_executor_count, type_topn).Increment();
-        pushBack(PhysicalTopN::build(context, executor_id, log, executor->topn(), popBack()));
+        auto child = popBack();
+        auto topn_threshold = pushDownLimit(context, child, *executor);
+        pushBack(PhysicalTopN::build(context, executor_id, log, executor->topn(), child, topn_threshold));
         break;
+    }
     case tipb::ExecType::TypeSelection:
     {
         GET_METRIC(tiflash_coprocessor_executor_count, type_sel).Increment();
@@ -116,6 +116,7 @@ void PhysicalAggregation::buildBlockInputStreamImpl(DAGPipeline & pipeline, Cont
 
     if (fine_grained_shuffle.enable())
     {
+        AggregationInterpreterHelper::setupBypass(params, context, executor_id, is_final_agg);
         /// For fine_grained_shuffle, just do aggregation in streams independently
         pipeline.transform([&](auto & stream) {
             stream = std::make_shared<AggregatingBlockInputStream>(
@@ -147,6 +148,7 @@ void PhysicalAggregation::buildBlockInputStreamImpl(DAGPipeline & pipeline, Cont
     else
     {
         assert(pipeline.streams.size() == 1);
+        AggregationInterpreterHelper::setupBypass(params, context, executor_id, is_final_agg);
         pipeline.firstStream() = std::make_shared<AggregatingBlockInputStream>(
             pipeline.firstStream(),
             params,
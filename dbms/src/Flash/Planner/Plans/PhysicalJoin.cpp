@@ -143,6 +143,8 @@ PhysicalPlanNodePtr PhysicalJoin::build(
         match_helper_name,
         0,
         context.isTest());
+    join_ptr->setMaxDenseKeyRange(settings.max_dense_join_key_range);
+    join_ptr->setPartitionedBuild(settings.join_partitioned_build);
 
     recordJoinExecuteInfo(dag_context, executor_id, build_plan->execId(), join_ptr);
 
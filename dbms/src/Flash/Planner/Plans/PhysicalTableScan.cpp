@@ -18,11 +18,14 @@
 #include <Flash/Coprocessor/GenSchemaAndColumn.h>
 #include <Flash/Coprocessor/InterpreterUtils.h>
 #include <Flash/Coprocessor/StorageDisaggregatedInterpreter.h>
+#include <Flash/Pipeline/Exec/PipelineExecBuilder.h>
+#include <Flash/Pipeline/Schedule/Events/LearnerReadEvent.h>
 #include <Flash/Planner/FinalizeHelper.h>
 #include <Flash/Planner/PhysicalPlanHelper.h>
 #include <Flash/Planner/Plans/PhysicalTableScan.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
+#include <Operators/BlockInputStreamSourceOp.h>
 
 namespace DB
 {
@@ -64,12 +67,49 @@ void PhysicalTableScan::buildBlockInputStreamImpl(DAGPipeline & pipeline, Contex
     }
     else
     {
-        DAGStorageInterpreter storage_interpreter(context, tidb_table_scan, filter_conditions, max_streams);
-        storage_interpreter.execute(pipeline);
-        buildProjection(pipeline, storage_interpreter.analyzer->getCurrentInputColumns());
+        if (!storage_interpreter)
+            storage_interpreter = std::make_shared<DAGStorageInterpreter>(context, tidb_table_scan, filter_conditions, max_streams);
+        storage_interpreter->execute(pipeline);
+        buildProjection(pipeline, storage_interpreter->analyzer->getCurrentInputColumns());
+        storage_interpreter.reset();
     }
 }
 
+void PhysicalTableScan::buildPipelineExecGroup(
+    PipelineExecutorStatus & exec_status,
+    PipelineExecGroupBuilder & group_builder,
+    Context & context,
+    size_t concurrency)
+{
+    // The storage and the remote read only provide input streams so far, wrap them as source operators.
+    DAGPipeline pipeline;
+    buildBlockInputStreamImpl(pipeline, context, concurrency);
+    group_builder.init(pipeline.streams.size());
+    size_t i = 0;
+    group_builder.transform([&](auto & builder) {
+        builder.setSourceOp(std::make_unique<BlockInputStreamSourceOp>(exec_status, log->identifier(), pipeline.streams[i++]));
+    });
+}
+
+EventPtr PhysicalTableScan::toLearnerReadEvent(
+    PipelineExecutorStatus & exec_status,
+    const MemoryTrackerPtr & mem_tracker,
+    Context & context,
+    size_t concurrency)
+{
+    // There is no learner read on the compute node in the disaggregated mode.
+    if (context.getSharedContextDisagg()->isDisaggregatedComputeMode() || !context.getSettingsRef().enable_async_learner_read)
+        return nullptr;
+
+    storage_interpreter = std::make_shared<DAGStorageInterpreter>(context, tidb_table_scan, filter_conditions, concurrency);
+    return std::make_shared<LearnerReadEvent>(
+        exec_status,
+        mem_tracker,
+        log->identifier(),
+        std::static_pointer_cast<PhysicalTableScan>(shared_from_this()),
+        storage_interpreter);
+}
+
 void PhysicalTableScan::buildProjection(DAGPipeline & pipeline, const NamesAndTypes & storage_schema)
 {
     RUNTIME_CHECK(
@@ -127,4 +167,12 @@ const String & PhysicalTableScan::getFilterConditionsId() const
     assert(hasFilterConditions());
     return filter_conditions.executor_id;
 }
+
+bool PhysicalTableScan::setLimitHint(const tipb::Executor & limit_or_topn, bool enable_topn_threshold)
+{
+    /// The rows are filtered after read, so the limit can not be pushed down.
+    if (hasFilterConditions())
+        return false;
+    return tidb_table_scan.setLimitHint(limit_or_topn, enable_topn_threshold);
+}
 } // namespace DB
@@ -14,11 +14,14 @@
 
 #include <Flash/Coprocessor/FilterConditions.h>
 #include <Flash/Coprocessor/TiDBTableScan.h>
+#include <Flash/Pipeline/Schedule/Events/Event.h>
 #include <Flash/Planner/Plans/PhysicalLeaf.h>
 #include <tipb/executor.pb.h>
 
 namespace DB
 {
+class DAGStorageInterpreter;
+
 class PhysicalTableScan : public PhysicalLeaf
 {
 public:
@@ -34,6 +37,21 @@ public:
         const TiDBTableScan & tidb_table_scan_,
         const Block & sample_block_);
 
+    void buildPipelineExecGroup(
+        PipelineExecutorStatus & exec_status,
+        PipelineExecGroupBuilder & group_builder,
+        Context & context,
+        size_t concurrency) override;
+
+    /// Return the event doing the learner read before the table scan is built in the pipeline model,
+    /// so that the read index and wait index do not block the task threads.
+    /// Return nullptr if the learner read is not needed or is done when building the table scan.
+    EventPtr toLearnerReadEvent(
+        PipelineExecutorStatus & exec_status,
+        const MemoryTrackerPtr & mem_tracker,
+        Context & context,
+        size_t concurrency);
+
     void finalize(const Names & parent_require) override;
 
     const Block & getSampleBlock() const override;
@@ -44,6 +62,11 @@ public:
 
     const String & getFilterConditionsId() const;
 
+    /// Push down the Limit/TopN above the table scan to storage as a hint, see `TiDBTableScan::setLimitHint`.
+    bool setLimitHint(const tipb::Executor & limit_or_topn, bool enable_topn_threshold);
+
+    const TopNThresholdPtr & getTopNThreshold() const { return tidb_table_scan.getTopNThreshold(); }
+
 private:
     void buildBlockInputStreamImpl(DAGPipeline & pipeline, Context & context, size_t max_streams) override;
     void buildProjection(DAGPipeline & pipeline, const NamesAndTypes & storage_schema);
@@ -54,5 +77,8 @@ private:
     TiDBTableScan tidb_table_scan;
 
     Block sample_block;
+
+    /// Created by `toLearnerReadEvent` and reused when building the table scan.
+    std::shared_ptr<DAGStorageInterpreter> storage_interpreter;
 };
 } // namespace DB
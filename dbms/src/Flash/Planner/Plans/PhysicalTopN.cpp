@@ -32,7 +32,8 @@ PhysicalPlanNodePtr PhysicalTopN::build(
     const String & executor_id,
     const LoggerPtr & log,
     const tipb::TopN & top_n,
-    const PhysicalPlanNodePtr & child)
+    const PhysicalPlanNodePtr & child,
+    const TopNThresholdPtr & topn_threshold)
 {
     assert(child);
 
@@ -56,7 +57,8 @@ PhysicalPlanNodePtr PhysicalTopN::build(
         child,
         order_descr,
         before_sort_actions,
-        top_n.limit());
+        top_n.limit(),
+        TopNThreshold::isSupported(order_descr) ? topn_threshold : nullptr);
     return physical_top_n;
 }
 
@@ -66,7 +68,7 @@ void PhysicalTopN::buildBlockInputStreamImpl(DAGPipeline & pipeline, Context & c
 
     executeExpression(pipeline, before_sort_actions, log, "before TopN");
 
-    orderStreams(pipeline, max_streams, order_descr, limit, false, context, log);
+    orderStreams(pipeline, max_streams, order_descr, limit, false, context, log, topn_threshold);
 }
 
 void PhysicalTopN::buildPipelineExecGroup(
@@ -82,7 +84,7 @@ void PhysicalTopN::buildPipelineExecGroup(
         });
     }
     group_builder.transform([&](auto & builder) {
-        builder.appendTransformOp(std::make_unique<TopNTransformOp>(exec_status, log->identifier(), order_descr, limit, context.getSettingsRef().max_block_size));
+        builder.appendTransformOp(std::make_unique<TopNTransformOp>(exec_status, log->identifier(), order_descr, limit, context.getSettingsRef().max_block_size, topn_threshold));
     });
 }
 
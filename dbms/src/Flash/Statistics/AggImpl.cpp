@@ -0,0 +1,35 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Statistics/AggImpl.h>
+
+namespace DB
+{
+void AggStatistics::appendExtraJson(FmtBuffer & fmt_buffer) const
+{
+    fmt_buffer.fmtAppend(R"("bypass_rows":{})", bypass_rows);
+}
+
+void AggStatistics::collectExtraRuntimeDetail()
+{
+    const auto & agg_execute_info_map = dag_context.getAggExecuteInfoMap();
+    auto it = agg_execute_info_map.find(executor_id);
+    if (it != agg_execute_info_map.end())
+        bypass_rows = it->second.bypass_rows->load(std::memory_order_relaxed);
+}
+
+AggStatistics::AggStatistics(const tipb::Executor * executor, DAGContext & dag_context_)
+    : AggStatisticsBase(executor, dag_context_)
+{}
+} // namespace DB
@@ -19,19 +19,6 @@
 
 namespace DB
 {
-struct AggImpl
-{
-    static constexpr bool has_extra_info = false;
-
-    static constexpr auto type = "Agg";
-
-    static bool isMatch(const tipb::Executor * executor)
-    {
-        return executor->has_aggregation();
-    }
-};
-using AggStatistics = ExecutorStatistics<AggImpl>;
-
 struct WindowImpl
 {
     static constexpr bool has_extra_info = false;
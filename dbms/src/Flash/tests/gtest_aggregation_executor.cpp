@@ -571,6 +571,27 @@ try
 }
 CATCH
 
+TEST_F(AggExecutorTestRunner, AggParallelMergeSingleLevel)
+try
+{
+    std::vector<String> tables{"big_table_1", "big_table_2", "big_table_3", "big_table_4"};
+    for (const auto & table : tables)
+    {
+        auto request = context.scan("test_db", table).aggregation({Max(col("value"))}, {col("key")}).build(context);
+        auto expect = executeStreams(request, 1);
+        context.context->setSetting("group_by_two_level_threshold_bytes", Field(static_cast<UInt64>(0)));
+        // The data of each thread may keep single-level while the total size exceeds the threshold,
+        // then the pipeline converts them to two-level and merges them bucket-wise in parallel.
+        std::vector<UInt64> two_level_thresholds{2, 16, 100, 1000};
+        for (auto two_level_threshold : two_level_thresholds)
+        {
+            context.context->setSetting("group_by_two_level_threshold", Field(static_cast<UInt64>(two_level_threshold)));
+            executeAndAssertColumnsEqual(request, expect);
+        }
+    }
+}
+CATCH
+
 TEST_F(AggExecutorTestRunner, SplitAggOutput)
 try
 {
@@ -730,6 +751,40 @@ try
 }
 CATCH
 
+TEST_F(AggExecutorTestRunner, AggAfterFilter)
+try
+{
+    std::vector<String> tables{"big_table_1", "big_table_2", "big_table_4"};
+    // Most rows, few rows and none of the rows are selected.
+    std::vector<Int64> filter_values{2, 180, 2000};
+    for (const auto & table : tables)
+    {
+        for (auto filter_value : filter_values)
+        {
+            std::vector<std::shared_ptr<tipb::DAGRequest>> requests{
+                context.scan("test_db", table).filter(gt(col("key"), lit(Field(filter_value)))).aggregation({Max(col("value")), Count(col("value"))}, {col("key")}).build(context),
+                context.scan("test_db", table).filter(gt(col("key"), lit(Field(filter_value)))).aggregation({Max(col("value")), Count(col("value"))}, {}).build(context),
+                context.scan("test_db", table).filter(gt(col("key"), lit(Field(filter_value)))).aggregation({}, {col("key")}).build(context),
+            };
+            for (const auto & request : requests)
+            {
+                // Larger than 1, always filter the rows before aggregation.
+                context.context->setSetting("min_selectivity_to_defer_filter", Field(static_cast<Float64>(2.0)));
+                auto expect = executeStreams(request, 1);
+                // 0: always skip the filtered out rows in aggregation
+                // 0.5: decide by the selectivity of each block
+                std::vector<Float64> min_selectivities{0.0, 0.5};
+                for (auto min_selectivity : min_selectivities)
+                {
+                    context.context->setSetting("min_selectivity_to_defer_filter", Field(min_selectivity));
+                    executeAndAssertColumnsEqual(request, expect);
+                }
+            }
+        }
+    }
+}
+CATCH
+
 TEST_F(AggExecutorTestRunner, Empty)
 try
 {
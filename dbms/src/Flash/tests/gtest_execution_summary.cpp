@@ -136,5 +136,23 @@ try
 }
 CATCH
 
+TEST_F(ExecutionSummaryTestRunner, FilterBeforeAgg)
+try
+{
+    auto request = context
+                       .scan("test_db", "test_table")
+                       .filter(eq(col("s1"), col("s2")))
+                       .aggregation({Count(col("s2"))}, {col("s2")})
+                       .build(context);
+    Expect expect{{"table_scan_0", {12, concurrency}}, {"selection_1", {4, concurrency}}, {"aggregation_2", {1, concurrency}}};
+    // The rows filtered out are not counted by the selection, whether the filter is handed to the aggregation or not.
+    for (auto min_selectivity : {0.0, 2.0})
+    {
+        context.context->setSetting("min_selectivity_to_defer_filter", Field(static_cast<Float64>(min_selectivity)));
+        testForExecutionSummary(request, expect);
+    }
+}
+CATCH
+
 } // namespace tests
 } // namespace DB
@@ -53,6 +53,11 @@ public:
                                  toNullableVec<String>("string_col", {"", "a", "1", "0", "ab", "  ", "\t", "\n"}),
                              });
 
+        context.addMockTable({"test_db", "filter_null"},
+                             {{"int32_col", TiDB::TP::TypeLong}, {"int64_col", TiDB::TP::TypeLongLong}},
+                             {toNullableVec<Int32>("int32_col", {0, {}, 2, {}, 4, 5}),
+                              toNullableVec<Int64>("int64_col", {0, 1, 2, 3, 4, 5})});
+
         // with 200 rows.
         std::vector<std::optional<TypeTraits<int>::FieldType>> key(200);
         std::vector<std::optional<String>> value(200);
@@ -197,6 +202,75 @@ try
 }
 CATCH
 
+TEST_F(FilterExecutorTestRunner, ShortCircuit)
+try
+{
+    auto test_one = [&](const ASTPtr & condition, const ColumnsWithTypeAndName & expect_columns) {
+        auto request = context.scan("test_db", "filter")
+                           .filter(condition)
+                           .project({"int32_col"})
+                           .build(context);
+        for (bool enable_short_circuit : {true, false})
+        {
+            context.context->setSetting("enable_short_circuit_evaluation", enable_short_circuit ? "true" : "false");
+            executeAndAssertColumnsEqual(request, expect_columns);
+        }
+    };
+    auto int_lit = [](Int64 value) {
+        return lit(Field(value));
+    };
+    auto str_lit = [](const String & value) {
+        return lit(Field(value));
+    };
+
+    // The second arguments are only evaluated on the rows not decided by the first ones.
+    test_one(And(gt(col("int32_col"), int_lit(3)), eq(concat(col("string_col"), str_lit("b")), str_lit("abb"))), {toNullableVec<Int32>({4})});
+    test_one(Or(lt(col("int32_col"), int_lit(2)), eq(concat(col("string_col"), str_lit("x")), str_lit("0x"))), {toNullableVec<Int32>({0, 1, 3})});
+    test_one(And(gt(col("int32_col"), int_lit(7)), eq(concat(col("string_col"), str_lit("b")), str_lit("abb"))), {});
+    test_one(Or(lt(col("int32_col"), int_lit(8)), eq(concat(col("string_col"), str_lit("x")), str_lit("0x"))), {toNullableVec<Int32>({0, 1, 2, 3, 4, 5, 6, 7})});
+
+    // nested
+    test_one(
+        And(gt(col("int32_col"), int_lit(0)), Or(eq(col("int64_col"), int_lit(2)), eq(concat(col("string_col"), str_lit("x")), str_lit("ax")))),
+        {toNullableVec<Int32>({1, 2})});
+
+    // if
+    auto if_expr = makeASTFunction("if", gt(col("int32_col"), int_lit(4)), plusInt(col("int64_col"), int_lit(10)), minusInt(col("int64_col"), int_lit(10)));
+    test_one(eq(if_expr, int_lit(15)), {toNullableVec<Int32>({5})});
+    test_one(eq(if_expr, int_lit(-9)), {toNullableVec<Int32>({1})});
+
+    auto test_null = [&](const ASTPtr & condition, const ColumnsWithTypeAndName & expect_columns) {
+        auto request = context.scan("test_db", "filter_null")
+                           .filter(condition)
+                           .project({"int64_col"})
+                           .build(context);
+        executeAndAssertColumnsEqual(request, expect_columns);
+    };
+    auto plus_10 = plusInt(col("int64_col"), int_lit(10));
+    auto minus_10 = minusInt(col("int64_col"), int_lit(10));
+
+    // The rows with null conditions go to the else branch.
+    auto nullable_if = makeASTFunction("if", gt(col("int32_col"), int_lit(1)), plus_10, minus_10);
+    test_null(eq(nullable_if, int_lit(-9)), {toNullableVec<Int64>({1})});
+    test_null(eq(nullable_if, int_lit(12)), {toNullableVec<Int64>({2})});
+    auto nullable_case_when = makeASTFunction(
+        "case_when",
+        gt(col("int32_col"), int_lit(3)),
+        plus_10,
+        lt(col("int32_col"), int_lit(3)),
+        minus_10,
+        plusInt(col("int64_col"), int_lit(100)));
+    test_null(eq(nullable_case_when, int_lit(103)), {toNullableVec<Int64>({3})});
+    test_null(eq(nullable_case_when, int_lit(-8)), {toNullableVec<Int64>({2})});
+    test_null(eq(nullable_case_when, int_lit(14)), {toNullableVec<Int64>({4})});
+
+    // only null and constant conditions
+    test_null(eq(makeASTFunction("if", lit(Field()), plus_10, minus_10), int_lit(-6)), {toNullableVec<Int64>({4})});
+    test_null(eq(makeASTFunction("if", int_lit(1), plus_10, minus_10), int_lit(15)), {toNullableVec<Int64>({5})});
+    test_null(eq(makeASTFunction("if", int_lit(0), plus_10, minus_10), int_lit(-5)), {toNullableVec<Int64>({5})});
+}
+CATCH
+
 TEST_F(FilterExecutorTestRunner, FilterWithQualifiedFormat)
 try
 {
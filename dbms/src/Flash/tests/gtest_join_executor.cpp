@@ -1501,6 +1501,60 @@ try
 }
 CATCH
 
+TEST_F(JoinExecutorTestRunner, DenseKeyJoin)
+try
+{
+    context.addMockTable("dense_test", "t1", {{"a", TiDB::TP::TypeLong}, {"b", TiDB::TP::TypeLong}}, {toNullableVec<Int32>("a", {0, 1, 3, 4, 5, 8, 100, {}, 7, -1}), toNullableVec<Int32>("b", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10})});
+    // The keys of the build side are dense, include the zero key.
+    context.addMockTable("dense_test", "t2", {{"a", TiDB::TP::TypeLong}, {"c", TiDB::TP::TypeLong}}, {toNullableVec<Int32>("a", {0, 1, 3, 5, 7, 7, {}}), toNullableVec<Int32>("c", {1, 2, 3, 4, 5, 6, 7})});
+    // The keys of the build side are not dense, the join falls back to probe by the hash map.
+    context.addMockTable("dense_test", "t3", {{"a", TiDB::TP::TypeLong}, {"c", TiDB::TP::TypeLong}}, {toNullableVec<Int32>("a", {1, 3, 1000000, -1, {}}), toNullableVec<Int32>("c", {1, 2, 3, 4, 5})});
+    // The keys of the build side are within `max_dense_join_key_range` but too sparse, the join probes by the hash map.
+    context.addMockTable("dense_test", "t4", {{"a", TiDB::TP::TypeLong}, {"c", TiDB::TP::TypeLong}}, {toNullableVec<Int32>("a", {0, 1, 1000, {}}), toNullableVec<Int32>("c", {1, 2, 3, 4})});
+
+    context.context->setSetting("max_bytes_before_external_join", Field(static_cast<UInt64>(0)));
+    for (const auto * right_table : {"t2", "t3", "t4"})
+    {
+        for (auto join_type : join_types)
+        {
+            auto request = context.scan("dense_test", "t1")
+                               .join(context.scan("dense_test", right_table), join_type, {col("a")})
+                               .build(context);
+
+            context.context->setSetting("max_dense_join_key_range", Field(static_cast<UInt64>(0)));
+            auto expect = executeStreams(request, 1);
+            context.context->setSetting("max_dense_join_key_range", Field(static_cast<UInt64>(1024)));
+            for (auto concurrency : {1, 5})
+                ASSERT_COLUMNS_EQ_UR(expect, executeStreams(request, concurrency));
+        }
+    }
+}
+CATCH
+
+TEST_F(JoinExecutorTestRunner, PartitionedBuild)
+try
+{
+    context.addMockTable("partitioned_build_test", "t1", {{"a", TiDB::TP::TypeLong}, {"s", TiDB::TP::TypeString}, {"b", TiDB::TP::TypeLong}}, {toNullableVec<Int32>("a", {0, 1, 3, 4, 5, 8, 100, {}, 7, -1, 3, 5}), toNullableVec<String>("s", {"a", "b", "c", "d", "e", "f", "g", "h", {}, "j", "c", "x"}), toNullableVec<Int32>("b", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12})});
+    context.addMockTable("partitioned_build_test", "t2", {{"a", TiDB::TP::TypeLong}, {"s", TiDB::TP::TypeString}, {"c", TiDB::TP::TypeLong}}, {toNullableVec<Int32>("a", {0, 1, 3, 5, 7, 7, {}, 3, 100, 1000, -1, 5}), toNullableVec<String>("s", {"a", "b", "c", "e", {}, "i", "h", "c", "g", "k", "j", "e"}), toNullableVec<Int32>("c", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12})});
+
+    context.context->setSetting("max_bytes_before_external_join", Field(static_cast<UInt64>(0)));
+    for (const auto & join_keys : std::vector<MockAstVec>{{col("a")}, {col("s")}, {col("a"), col("s")}})
+    {
+        for (auto join_type : join_types)
+        {
+            auto request = context.scan("partitioned_build_test", "t1")
+                               .join(context.scan("partitioned_build_test", "t2"), join_type, join_keys)
+                               .build(context);
+
+            context.context->setSetting("join_partitioned_build", "false");
+            auto expect = executeStreams(request, 1);
+            context.context->setSetting("join_partitioned_build", "true");
+            for (auto concurrency : {1, 3, 10})
+                ASSERT_COLUMNS_EQ_UR(expect, executeStreams(request, concurrency));
+        }
+    }
+}
+CATCH
 
 } // namespace tests
 } // namespace DB
@@ -44,6 +44,7 @@
 #include <cstring>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 
 #if USE_RE2_ST
 #include <re2_st/re2.h>
@@ -125,6 +126,33 @@ inline Regexps::Regexp createRegexpWithMatchType(const String & pattern, const S
     return Regexps::createRegexp<false>(final_pattern, getDefaultFlags());
 }
 
+// Caches the compiled regexps when the pattern or match type is not constant, so that
+// the rows with the same pattern do not compile the regexp again and again. The cache
+// lives in one execution of the function, because the compiled regexps are not thread
+// safe and can not be shared among the threads executing the same function.
+class RegexpCache
+{
+public:
+    static constexpr size_t MAX_SIZE = 64;
+
+    Regexps::Regexp & get(const String & pattern, const String & match_type, TiDB::TiDBCollatorPtr collator)
+    {
+        // The mode modifiers in the final pattern also identify the match type and collator
+        String final_pattern = addMatchTypeForPattern(pattern, match_type, collator);
+        if (auto iter = cache.find(final_pattern); iter != cache.end())
+            return *iter->second;
+
+        // Patterns are seldom that many in one block, simply drop all when the cache is full
+        if (cache.size() >= MAX_SIZE)
+            cache.clear();
+        auto regexp = std::make_unique<Regexps::Regexp>(final_pattern, getDefaultFlags());
+        return *cache.emplace(std::move(final_pattern), std::move(regexp)).first->second;
+    }
+
+private:
+    std::unordered_map<String, std::unique_ptr<Regexps::Regexp>> cache;
+};
+
 // Only int types used in ColumnsNumber.h can be valid
 template <typename T>
 inline constexpr bool check_int_type()
@@ -1088,6 +1116,7 @@ public:
                 StringRef expr_ref;
                 String pat;
                 String match_type;
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     if (expr_param.isNullAt(i) || pat_param.isNullAt(i) || match_type_param.isNullAt(i))
@@ -1105,7 +1134,7 @@ public:
                     if (unlikely(pat.empty()))
                         throw Exception(EMPTY_PAT_ERR_MSG);
 
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     vec_res[i] = regexp.match(expr_ref.data, expr_ref.size); // match
                 }
 
@@ -1116,6 +1145,7 @@ public:
                 StringRef expr_ref;
                 String pat;
                 String match_type;
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     expr_param.getStringRef(i, expr_ref);
@@ -1125,7 +1155,7 @@ public:
                     if (unlikely(pat.empty()))
                         throw Exception(EMPTY_PAT_ERR_MSG);
 
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     vec_res[i] = regexp.match(expr_ref.data, expr_ref.size); // match
                 }
 
@@ -1428,6 +1458,7 @@ public:
                 typename ColumnUInt8::Container & null_map = nullmap_col->getData();
                 null_map.resize(col_size);
 
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     if (expr_param.isNullAt(i) || pat_param.isNullAt(i) || pos_param.isNullAt(i) || occur_param.isNullAt(i) || ret_op_param.isNullAt(i) || match_type_param.isNullAt(i))
@@ -1445,7 +1476,7 @@ public:
                     GET_OCCUR_VALUE(i)
                     GET_RET_OP_VALUE(i)
                     match_type = match_type_param.getString(i);
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     vec_res[i] = regexp.instr(expr_ref.data, expr_ref.size, pos, occur, ret_op);
                 }
 
@@ -1454,6 +1485,7 @@ public:
             else
             {
                 // Process pure vector columns without memorized regexp
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     expr_param.getStringRef(i, expr_ref);
@@ -1465,7 +1497,7 @@ public:
                     GET_OCCUR_VALUE(i)
                     GET_RET_OP_VALUE(i)
                     match_type = match_type_param.getString(i);
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     vec_res[i] = regexp.instr(expr_ref.data, expr_ref.size, pos, occur, ret_op);
                 }
 
@@ -1756,6 +1788,7 @@ public:
         {
             if constexpr (has_nullable_col)
             {
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     if (expr_param.isNullAt(i) || pat_param.isNullAt(i) || pos_param.isNullAt(i) || occur_param.isNullAt(i) || match_type_param.isNullAt(i))
@@ -1775,12 +1808,13 @@ public:
                     match_type = match_type_param.getString(i);
                     pat = fmt::format("({})", pat);
 
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     executeAndSetResult(regexp, col_res, null_map, i, expr_ref.data, expr_ref.size, pos, occur);
                 }
             }
             else
             {
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     pat = pat_param.getString(i);
@@ -1793,7 +1827,7 @@ public:
                     match_type = match_type_param.getString(i);
                     pat = fmt::format("({})", pat);
 
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     executeAndSetResult(regexp, col_res, null_map, i, expr_ref.data, expr_ref.size, pos, occur);
                 }
             }
@@ -2140,6 +2174,7 @@ public:
                 typename ColumnUInt8::Container & null_map = null_map_col->getData();
                 null_map.resize(col_size);
 
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     if (expr_param.isNullAt(i) || pat_param.isNullAt(i) || repl_param.isNullAt(i) || pos_param.isNullAt(i) || occur_param.isNullAt(i) || match_type_param.isNullAt(i))
@@ -2163,7 +2198,7 @@ public:
                     GET_OCCUR_VALUE(i)
                     match_type = match_type_param.getString(i);
 
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     regexp.replace(expr_ref.data, expr_ref.size, res_data, res_offset, repl_ref, pos, occur);
                     res_offsets[i] = res_offset;
                 }
@@ -2171,6 +2206,7 @@ public:
             }
             else
             {
+                FunctionsRegexp::RegexpCache regexp_cache;
                 for (size_t i = 0; i < col_size; ++i)
                 {
                     pat = pat_param.getString(i);
@@ -2184,7 +2220,7 @@ public:
                     GET_OCCUR_VALUE(i)
                     match_type = match_type_param.getString(i);
 
-                    auto regexp = FunctionsRegexp::createRegexpWithMatchType(pat, match_type, collator);
+                    auto & regexp = regexp_cache.get(pat, match_type, collator);
                     regexp.replace(expr_ref.data, expr_ref.size, res_data, res_offset, repl_ref, pos, occur);
                     res_offsets[i] = res_offset;
                 }
@@ -2098,6 +2098,37 @@ TEST_F(Regexp, RegexpLike)
     ASSERT_THROW(executeFunction("regexp_like", createColumn<String>(std::vector<String>{"1"}), createConstColumn<Nullable<String>>(row_size, "")), Exception);
 }
 
+TEST_F(Regexp, RegexpLikeWithNonConstPattern)
+{
+    {
+        std::vector<String> exprs{"a", "abcd", "xyz abc", "ABC", "hello world", "hello", "b]", "中文"};
+        std::vector<String> patterns{"a中?", "abc", "abc", "abc", "hello.*world", "hello.*world", "[]a]", "中?文"};
+        std::vector<String> match_types{"", "", "", "i", "", "", "", ""};
+        ASSERT_COLUMN_EQ(createColumn<UInt8>({1, 1, 1, 0, 1, 0, 1, 1}),
+                         executeFunction("regexp_like", createColumn<String>(exprs), createColumn<String>(patterns)));
+        ASSERT_COLUMN_EQ(createColumn<UInt8>({1, 1, 1, 1, 1, 0, 1, 1}),
+                         executeFunction("regexp_like", createColumn<String>(exprs), createColumn<String>(patterns), createColumn<String>(match_types)));
+        ASSERT_COLUMN_EQ(createColumn<UInt8>({0, 1, 1, 0, 0, 0, 0, 0}),
+                         executeFunction("regexp_like", createColumn<String>(exprs), createConstColumn<String>(exprs.size(), "abc")));
+    }
+
+    {
+        // More distinct patterns than the capacity of the regexp cache
+        const size_t row_size = FunctionsRegexp::RegexpCache::MAX_SIZE * 3;
+        std::vector<String> exprs;
+        std::vector<String> patterns;
+        std::vector<UInt8> results;
+        for (size_t i = 0; i < row_size; ++i)
+        {
+            exprs.emplace_back(fmt::format("row_{}", i));
+            patterns.emplace_back(fmt::format("^row_{}$", i % 2 == 0 ? i : i + 1));
+            results.emplace_back(i % 2 == 0);
+        }
+        ASSERT_COLUMN_EQ(createColumn<UInt8>(results),
+                         executeFunction("regexp_like", createColumn<String>(exprs), createColumn<String>(patterns)));
+    }
+}
+
 TEST_F(Regexp, testRegexpCustomerCases)
 {
     String pattern = "^(53|94)[0-9]{10}$|"
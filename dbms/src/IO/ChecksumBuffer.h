@@ -234,6 +234,17 @@ public:
 
     off_t getPositionInFile() override { return (current_frame == -1ull) ? 0 : current_frame * frame_size + offset(); }
 
+    size_t prefetch(off_t offset, size_t size) override
+    {
+        if (size == 0)
+            return 0;
+        // Every frame is stored with its header, hint the whole frames that cover the range.
+        const size_t frame_size_in_file = sizeof(ChecksumFrame<Backend>) + frame_size;
+        const size_t first_frame = offset / frame_size;
+        const size_t last_frame = (offset + size - 1) / frame_size;
+        return ReadBufferFromFileDescriptor::prefetch(first_frame * frame_size_in_file, (last_frame - first_frame + 1) * frame_size_in_file);
+    }
+
     size_t readBig(char * buffer, size_t size) override
     {
         const auto expected = size;
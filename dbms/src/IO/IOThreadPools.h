@@ -38,6 +38,18 @@ struct RNPreparerTrait
 {
 };
 
+struct RestoreSegmentTrait
+{
+};
+
+struct BlobReadTrait
+{
+};
+
+struct WNFetchPagesTrait
+{
+};
+
 } // namespace io_pool_details
 
 // TODO: Move these out.
@@ -45,6 +57,9 @@ using DataStoreS3Pool = IOThreadPool<io_pool_details::DataStoreS3Trait>;
 using S3FileCachePool = IOThreadPool<io_pool_details::S3FileCacheTrait>;
 using RNRemoteReadTaskPool = IOThreadPool<io_pool_details::RemoteReadTaskTrait>;
 using RNPagePreparerPool = IOThreadPool<io_pool_details::RNPreparerTrait>;
+using RestoreSegmentPool = IOThreadPool<io_pool_details::RestoreSegmentTrait>;
+using BlobReadPool = IOThreadPool<io_pool_details::BlobReadTrait>;
+using WNFetchPagesPool = IOThreadPool<io_pool_details::WNFetchPagesTrait>;
 
 
 } // namespace DB
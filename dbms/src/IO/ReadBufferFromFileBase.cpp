@@ -30,4 +30,19 @@ off_t ReadBufferFromFileBase::seek(off_t off, int whence)
     return doSeek(off, whence);
 }
 
+size_t ReadBufferFromFileBase::prefetch([[maybe_unused]] off_t offset, [[maybe_unused]] size_t size)
+{
+#ifdef __APPLE__
+    return 0;
+#else
+    // The file on remote storage has no file descriptor.
+    const int fd = getFD();
+    if (fd < 0 || size == 0)
+        return 0;
+    if (::posix_fadvise(fd, offset, size, POSIX_FADV_WILLNEED) != 0)
+        return 0;
+    return size;
+#endif
+}
+
 } // namespace DB
@@ -39,6 +39,10 @@ public:
     virtual std::string getFileName() const = 0;
     virtual int getFD() const = 0;
 
+    /// Hint the OS to read the range [offset, offset + size) of the file in background.
+    /// Return the number of bytes hinted, 0 if it is not supported by the file.
+    virtual size_t prefetch(off_t offset, size_t size);
+
     /// It is possible to get information about the time of each reading.
     struct ProfileInfo
     {
@@ -14,6 +14,7 @@
 
 #include <AggregateFunctions/AggregateFunctionArray.h>
 #include <AggregateFunctions/AggregateFunctionState.h>
+#include <Columns/ColumnsCommon.h>
 #include <Common/FailPoint.h>
 #include <Common/Stopwatch.h>
 #include <Common/ThresholdUtils.h>
@@ -135,6 +136,9 @@ size_t AggregatedDataVariants::getBucketNumberForTwoLevelHashTable(Type type)
 
 void AggregatedDataVariants::convertToTwoLevel()
 {
+    if (isDense())
+        convertDenseToHash();
+
     switch (type)
     {
 #define M(NAME)                                                                           \
@@ -163,6 +167,110 @@ void AggregatedDataVariants::convertToTwoLevel()
     aggregator->useTwoLevelHashTable();
 }
 
+namespace
+{
+template <typename FieldType>
+bool getKeyRange(const IColumn * key_column, size_t rows, const IColumn::Filter * filter, FieldType & min_key, FieldType & max_key)
+{
+    /// Read the key column as unsigned integers of the same width, like `ColumnsHashing::HashMethodOneNumber`.
+    const auto * keys = static_cast<const ColumnVector<FieldType> *>(key_column)->getData().data();
+    min_key = std::numeric_limits<FieldType>::max();
+    max_key = 0;
+    bool has_key = false;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (filter && !(*filter)[i])
+            continue;
+        min_key = std::min(min_key, keys[i]);
+        max_key = std::max(max_key, keys[i]);
+        has_key = true;
+    }
+    return has_key;
+}
+} // namespace
+
+bool AggregatedDataVariants::tryExtendDenseRange(const IColumn * key_column, size_t rows, const IColumn::Filter * filter, size_t range_limit)
+{
+    switch (type)
+    {
+#define M(NAME, HASH_NAME)                                                     \
+    case AggregationMethodType(NAME):                                          \
+    {                                                                          \
+        auto * method = ToAggregationMethodPtr(NAME, aggregation_method_impl); \
+        decltype(method->min_key) min_key, max_key;                            \
+        if (!getKeyRange(key_column, rows, filter, min_key, max_key))          \
+            return true;                                                       \
+        return method->tryExtendRange(min_key, max_key, range_limit);          \
+    }
+
+        APPLY_FOR_VARIANTS_DENSE(M)
+
+#undef M
+
+    default:
+        throw Exception("Wrong data variant passed.", ErrorCodes::LOGICAL_ERROR);
+    }
+}
+
+bool AggregatedDataVariants::tryExtendDenseRange(const AggregatedDataVariants & other, size_t range_limit)
+{
+    RUNTIME_CHECK(type == other.type);
+    switch (type)
+    {
+#define M(NAME, HASH_NAME)                                                                        \
+    case AggregationMethodType(NAME):                                                             \
+    {                                                                                             \
+        const auto * other_method = ToAggregationMethodPtr(NAME, other.aggregation_method_impl);  \
+        if (other_method->min_key > other_method->max_key)                                        \
+            return true;                                                                          \
+        auto * method = ToAggregationMethodPtr(NAME, aggregation_method_impl);                    \
+        return method->tryExtendRange(other_method->min_key, other_method->max_key, range_limit); \
+    }
+
+        APPLY_FOR_VARIANTS_DENSE(M)
+
+#undef M
+
+    default:
+        throw Exception("Wrong data variant passed.", ErrorCodes::LOGICAL_ERROR);
+    }
+}
+
+void AggregatedDataVariants::convertDenseToHash()
+{
+    switch (type)
+    {
+#define M(NAME, HASH_NAME)                                                    \
+    case AggregationMethodType(NAME):                                         \
+    {                                                                         \
+        if (aggregator)                                                       \
+            LOG_TRACE(aggregator->log,                                        \
+                      "Converting aggregation data type `{}` to `{}`.",       \
+                      getMethodName(AggregationMethodType(NAME)),             \
+                      getMethodName(AggregationMethodType(HASH_NAME)));       \
+        auto * dense = ToAggregationMethodPtr(NAME, aggregation_method_impl); \
+        auto hash = std::make_unique<AggregationMethodName(HASH_NAME)>();     \
+        dense->data.forEachValue([&](const auto & key, auto & mapped) {       \
+            AggregationMethodName(HASH_NAME)::Data::LookupResult it;          \
+            bool inserted;                                                    \
+            hash->data.emplace(dense->restoreKey(key), it, inserted);         \
+            it->getMapped() = mapped;                                         \
+        });                                                                   \
+        delete dense;                                                         \
+        aggregation_method_impl = hash.release();                             \
+        type = AggregationMethodType(HASH_NAME);                              \
+        break;                                                                \
+    }
+
+        APPLY_FOR_VARIANTS_DENSE(M)
+
+#undef M
+
+    default:
+        throw Exception("Wrong data variant passed.", ErrorCodes::LOGICAL_ERROR);
+    }
+}
+
 
 Block Aggregator::getHeader(bool final) const
 {
@@ -264,6 +372,14 @@ Aggregator::Aggregator(const Params & params_, const String & req_id)
 
     method_chosen = chooseAggregationMethod();
     RUNTIME_CHECK_MSG(method_chosen != AggregatedDataVariants::Type::EMPTY, "Invalid aggregation method");
+    method_to_init = method_chosen;
+    if (params.max_dense_key_range > 0 && params.src_header)
+    {
+        if (method_chosen == AggregatedDataVariants::Type::key32)
+            method_to_init = AggregatedDataVariants::Type::key32_dense;
+        else if (method_chosen == AggregatedDataVariants::Type::key64)
+            method_to_init = AggregatedDataVariants::Type::key64_dense;
+    }
     if (AggregatedDataVariants::isConvertibleToTwoLevel(method_chosen))
     {
         /// for aggregation, the input block is sorted by bucket number
@@ -566,11 +682,12 @@ void NO_INLINE Aggregator::executeImpl(
     size_t rows,
     ColumnRawPtrs & key_columns,
     TiDB::TiDBCollators & collators,
-    AggregateFunctionInstruction * aggregate_instructions) const
+    AggregateFunctionInstruction * aggregate_instructions,
+    const IColumn::Filter * filter) const
 {
     typename Method::State state(key_columns, key_sizes, collators);
 
-    executeImplBatch(method, state, aggregates_pool, rows, aggregate_instructions);
+    executeImplBatch(method, state, aggregates_pool, rows, aggregate_instructions, filter);
 }
 
 template <typename Method>
@@ -579,7 +696,8 @@ ALWAYS_INLINE void Aggregator::executeImplBatch(
     typename Method::State & state,
     Arena * aggregates_pool,
     size_t rows,
-    AggregateFunctionInstruction * aggregate_instructions) const
+    AggregateFunctionInstruction * aggregate_instructions,
+    const IColumn::Filter * filter) const
 {
     std::vector<std::string> sort_key_containers;
     sort_key_containers.resize(params.keys_size, "");
@@ -587,31 +705,39 @@ ALWAYS_INLINE void Aggregator::executeImplBatch(
     /// Optimization for special case when there are no aggregate functions.
     if (params.aggregates_size == 0)
     {
-        /// For all rows.
+        /// For all selected rows.
         AggregateDataPtr place = aggregates_pool->alloc(0);
         for (size_t i = 0; i < rows; ++i)
+        {
+            if (filter && !(*filter)[i])
+                continue;
             state.emplaceKey(method.data, i, *aggregates_pool, sort_key_containers).setMapped(place);
+        }
         return;
     }
 
     /// Optimization for special case when aggregating by 8bit key.
+    /// The lookup table is indexed by the keys of all rows, so it is not used for a filtered block.
     if constexpr (std::is_same_v<Method, AggregatedDataVariants::AggregationMethod_key8>)
     {
-        for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
+        if (!filter)
         {
-            inst->batch_that->addBatchLookupTable8(
-                rows,
-                reinterpret_cast<AggregateDataPtr *>(method.data.data()),
-                inst->state_offset,
-                [&](AggregateDataPtr & aggregate_data) {
-                    aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
-                    createAggregateStates(aggregate_data);
-                },
-                state.getKeyData(),
-                inst->batch_arguments,
-                aggregates_pool);
+            for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
+            {
+                inst->batch_that->addBatchLookupTable8(
+                    rows,
+                    reinterpret_cast<AggregateDataPtr *>(method.data.data()),
+                    inst->state_offset,
+                    [&](AggregateDataPtr & aggregate_data) {
+                        aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+                        createAggregateStates(aggregate_data);
+                    },
+                    state.getKeyData(),
+                    inst->batch_arguments,
+                    aggregates_pool);
+            }
+            return;
         }
-        return;
     }
 
     /// Generic case.
@@ -620,6 +746,13 @@ ALWAYS_INLINE void Aggregator::executeImplBatch(
 
     for (size_t i = 0; i < rows; ++i)
     {
+        /// The aggregate functions skip the rows with null place.
+        if (filter && !(*filter)[i])
+        {
+            places[i] = nullptr;
+            continue;
+        }
+
         AggregateDataPtr aggregate_data = nullptr;
 
         auto emplace_result = state.emplaceKey(method.data, i, *aggregates_pool, sort_key_containers);
@@ -717,18 +850,31 @@ bool Aggregator::executeOnBlock(
     const Block & block,
     AggregatedDataVariants & result,
     ColumnRawPtrs & key_columns,
-    AggregateColumns & aggregate_columns)
+    AggregateColumns & aggregate_columns,
+    const IColumn::Filter * filter)
 {
     if (is_cancelled())
         return true;
 
+    size_t num_rows = block.rows();
+    size_t selected_rows = num_rows;
+    if (filter)
+    {
+        selected_rows = countBytesInFilter(*filter);
+        /// Nothing selected, just like the block is filtered out before aggregation.
+        if (selected_rows == 0)
+            return true;
+        if (selected_rows == num_rows)
+            filter = nullptr;
+    }
+
     /// `result` will destroy the states of aggregate functions in the destructor
     result.aggregator = this;
 
     /// How to perform the aggregation?
     if (!result.inited())
     {
-        result.init(method_chosen);
+        result.init(method_to_init);
         result.keys_size = params.keys_size;
         result.key_sizes = key_sizes;
         LOG_TRACE(log, "Aggregation method: `{}`", result.getMethodName());
@@ -741,6 +887,25 @@ bool Aggregator::executeOnBlock(
     Columns materialized_columns;
     materialized_columns.reserve(params.keys_size);
 
+    /// There is no place per row to skip when aggregating without key, so just filter the arguments,
+    /// which are usually much fewer than the columns of the block.
+    if (filter && result.type == AggregatedDataVariants::Type::without_key)
+    {
+        num_rows = selected_rows;
+        std::vector<bool> filtered(columns.size(), false);
+        for (const auto & aggregate : params.aggregates)
+        {
+            for (auto pos : aggregate.arguments)
+            {
+                if (filtered[pos])
+                    continue;
+                columns[pos] = columns[pos]->filter(*filter, num_rows);
+                filtered[pos] = true;
+            }
+        }
+        filter = nullptr;
+    }
+
     /// Remember the columns we will work with
     for (size_t i = 0; i < params.keys_size; ++i)
     {
@@ -756,11 +921,13 @@ bool Aggregator::executeOnBlock(
     AggregateFunctionInstructions aggregate_functions_instructions;
     prepareAggregateInstructions(columns, aggregate_columns, materialized_columns, aggregate_functions_instructions);
 
+    /// The dense variants can only hold the keys in a small range, fall back to the hash table once the keys exceed it.
+    if (result.isDense() && !result.tryExtendDenseRange(key_columns[0], num_rows, filter, params.max_dense_key_range))
+        result.convertDenseToHash();
+
     if (is_cancelled())
         return true;
 
-    size_t num_rows = block.rows();
-
     if (result.type == AggregatedDataVariants::Type::without_key && !result.without_key)
     {
         AggregateDataPtr place = result.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
@@ -777,11 +944,11 @@ bool Aggregator::executeOnBlock(
     }
     else
     {
-#define M(NAME, IS_TWO_LEVEL)                                                                                                                                                                 \
-    case AggregationMethodType(NAME):                                                                                                                                                         \
-    {                                                                                                                                                                                         \
-        executeImpl(*ToAggregationMethodPtr(NAME, result.aggregation_method_impl), result.aggregates_pool, num_rows, key_columns, params.collators, aggregate_functions_instructions.data()); \
-        break;                                                                                                                                                                                \
+#define M(NAME, IS_TWO_LEVEL)                                                                                                                                                                         \
+    case AggregationMethodType(NAME):                                                                                                                                                                 \
+    {                                                                                                                                                                                                 \
+        executeImpl(*ToAggregationMethodPtr(NAME, result.aggregation_method_impl), result.aggregates_pool, num_rows, key_columns, params.collators, aggregate_functions_instructions.data(), filter); \
+        break;                                                                                                                                                                                        \
     }
 
         switch (result.type)
@@ -947,10 +1114,101 @@ void Aggregator::spillImpl(
 }
 
 
-void Aggregator::execute(const BlockInputStreamPtr & stream, AggregatedDataVariants & result)
+bool Aggregator::checkBypass(const AggregatedDataVariants & data_variants, size_t src_rows) const
+{
+    if (params.bypass_check_rows == 0 || params.keys_size == 0 || src_rows < params.bypass_check_rows)
+        return false;
+    return static_cast<double>(data_variants.size()) >= params.bypass_groups_ratio * src_rows;
+}
+
+Block Aggregator::convertToBypassBlock(const Block & block, const IColumn::Filter * filter) const
+{
+    Columns columns = block.getColumns();
+    size_t rows = block.rows();
+    if (filter)
+    {
+        rows = countBytesInFilter(*filter);
+        for (auto & column : columns)
+            column = column->filter(*filter, rows);
+    }
+
+    Block res = getHeader(/*final=*/true);
+    if (rows == 0)
+        return res;
+
+    for (size_t i = 0; i < params.keys_size; ++i)
+    {
+        auto & key_column = res.getByPosition(i).column;
+        key_column = columns.at(params.keys[i]);
+        if (ColumnPtr converted = key_column->convertToFullColumnIfConst())
+            key_column = converted;
+    }
+
+    MutableColumns final_aggregate_columns(params.aggregates_size);
+    for (size_t i = 0; i < params.aggregates_size; ++i)
+    {
+        final_aggregate_columns[i] = res.getByPosition(params.keys_size + i).type->createColumn();
+        final_aggregate_columns[i]->reserve(rows);
+    }
+
+    /// Every row has its own states of aggregate functions, which are placed one by one in the arena.
+    Arena arena;
+    const size_t states_stride = (total_size_of_aggregate_states + align_aggregate_states - 1) / align_aggregate_states * align_aggregate_states;
+    char * states = arena.alignedAlloc(rows * states_stride, align_aggregate_states);
+    PODArray<AggregateDataPtr> places(rows);
+    size_t created_rows = 0;
+    try
+    {
+        for (; created_rows < rows; ++created_rows)
+        {
+            places[created_rows] = states + created_rows * states_stride;
+            createAggregateStates(places[created_rows]);
+        }
+
+        Columns materialized_columns;
+        for (size_t i = 0; i < params.aggregates_size; ++i)
+        {
+            ColumnRawPtrs arguments(params.aggregates[i].arguments.size());
+            for (size_t j = 0; j < arguments.size(); ++j)
+            {
+                arguments[j] = columns.at(params.aggregates[i].arguments[j]).get();
+                if (ColumnPtr converted = arguments[j]->convertToFullColumnIfConst())
+                {
+                    materialized_columns.push_back(converted);
+                    arguments[j] = materialized_columns.back().get();
+                }
+            }
+            aggregate_functions[i]->addBatch(rows, places.data(), offsets_of_aggregate_states[i], arguments.data(), &arena);
+        }
+
+        /// The states are destroyed and reset to nullptr after inserted.
+        for (size_t row = 0; row < rows; ++row)
+            insertAggregatesIntoColumns(places[row], final_aggregate_columns, &arena);
+    }
+    catch (...)
+    {
+        for (size_t row = 0; row < created_rows; ++row)
+        {
+            if (!places[row])
+                continue;
+            for (size_t i = 0; i < params.aggregates_size; ++i)
+                aggregate_functions[i]->destroy(places[row] + offsets_of_aggregate_states[i]);
+        }
+        throw;
+    }
+
+    for (size_t i = 0; i < params.aggregates_size; ++i)
+        res.getByPosition(params.keys_size + i).column = std::move(final_aggregate_columns[i]);
+
+    if (params.bypass_rows)
+        params.bypass_rows->fetch_add(rows, std::memory_order_relaxed);
+    return res;
+}
+
+bool Aggregator::execute(const BlockInputStreamPtr & stream, AggregatedDataVariants & result)
 {
     if (is_cancelled())
-        return;
+        return false;
 
     ColumnRawPtrs key_columns(params.keys_size);
     AggregateColumns aggregate_columns(params.aggregates_size);
@@ -962,17 +1220,28 @@ void Aggregator::execute(const BlockInputStreamPtr & stream, AggregatedDataVaria
     size_t src_rows = 0;
     size_t src_bytes = 0;
 
-    /// Read all the data
-    while (Block block = stream->read())
+    /// Read all the data, the rows filtered out by the upstream may be skipped here instead of being copied.
+    while (true)
     {
+        FilterPtr filter = nullptr;
+        Block block = stream->read(filter, /*return_filter=*/true);
+        if (!block)
+            break;
+
         if (is_cancelled())
-            return;
+            return false;
 
-        src_rows += block.rows();
+        src_rows += filter ? countBytesInFilter(*filter) : block.rows();
         src_bytes += block.bytes();
 
-        if (!executeOnBlock(block, result, key_columns, aggregate_columns))
+        if (!executeOnBlock(block, result, key_columns, aggregate_columns, filter))
             break;
+
+        if (checkBypass(result, src_rows))
+        {
+            LOG_DEBUG(log, "Aggregation is bypassed after aggregating {} rows to {} rows", src_rows, result.size());
+            return true;
+        }
     }
 
     /// If there was no data, and we aggregate without keys, and we must return single row with the result of empty aggregation.
@@ -991,6 +1260,7 @@ void Aggregator::execute(const BlockInputStreamPtr & stream, AggregatedDataVaria
         elapsed_seconds,
         src_rows / elapsed_seconds,
         src_bytes / elapsed_seconds / 1048576.0);
+    return false;
 }
 
 template <typename Method, typename Table>
@@ -1705,6 +1975,24 @@ MergingBucketsPtr Aggregator::mergeAndConvertToBlocks(
         });
     }
 
+    /// The dense variants can be merged only if all of them are dense and the union of their key ranges is still small,
+    /// otherwise convert them to the hash variants.
+    bool has_dense = std::any_of(non_empty_data.begin(), non_empty_data.end(), [](const auto & variant) { return variant->isDense(); });
+    if (has_dense)
+    {
+        AggregatedDataVariantsPtr & first = non_empty_data[0];
+        bool mergeable = first->isDense();
+        for (size_t i = 1; mergeable && i < non_empty_data.size(); ++i)
+        {
+            mergeable = first->type == non_empty_data[i]->type
+                && first->tryExtendDenseRange(*non_empty_data[i], params.max_dense_key_range);
+        }
+        if (!mergeable)
+            for (auto & variant : non_empty_data)
+                if (variant->isDense())
+                    variant->convertDenseToHash();
+    }
+
     /// If at least one of the options is two-level, then convert all the options into two-level ones, if there are not such.
     /// Note - perhaps it would be more optimal not to convert single-level versions before the merge, but merge them separately, at the end.
 
@@ -2296,6 +2584,8 @@ void MergingBuckets::doLevelMerge(Int32 bucket_num, size_t concurrency_index)
     /// Select Arena to avoid race conditions
     Arena * arena = merged_data.aggregates_pools.at(concurrency_index).get();
 
+    /// If final, the aggregate states are destroyed after converted to the final values,
+    /// so the merged bucket can be released before the following buckets are merged.
 #define M(NAME)                                                                           \
     case AggregationMethodType(NAME):                                                     \
     {                                                                                     \
@@ -2306,6 +2596,10 @@ void MergingBuckets::doLevelMerge(Int32 bucket_num, size_t concurrency_index)
             arena,                                                                        \
             final,                                                                        \
             bucket_num);                                                                  \
+        if (final)                                                                        \
+            ToAggregationMethodPtr(NAME, merged_data.aggregation_method_impl)             \
+                ->data.impls[bucket_num]                                                  \
+                .clearAndShrink();                                                        \
         break;                                                                            \
     }
     switch (method)
@@ -144,6 +144,59 @@ struct AggregationMethodOneNumber
     }
 };
 
+/// For the case where there is one numeric key and all the keys fall into a small range, e.g. the surrogate keys
+/// of a dimension table. The keys in a range of at most 65536 values are distinct in their low 16 bits, so the
+/// low 16 bits index an array directly and no hashing or collision is involved.
+/// The range of the inserted keys is maintained by `AggregatedDataVariants::tryExtendDenseRange`, the data is
+/// converted to `AggregationMethodOneNumber` by `AggregatedDataVariants::convertDenseToHash` once it is too large.
+/// FieldType is UInt32/64 for any type with corresponding bit width.
+template <typename FieldType>
+struct AggregationMethodOneNumberDense
+{
+    using Data = AggregatedDataWithUInt16Key;
+    using Key = typename Data::key_type;
+    using Mapped = typename Data::mapped_type;
+
+    static constexpr size_t max_range = 1 << 16;
+
+    Data data;
+    /// The range of the keys, min_key > max_key means no key is inserted.
+    FieldType min_key = std::numeric_limits<FieldType>::max();
+    FieldType max_key = 0;
+
+    AggregationMethodOneNumberDense() = default;
+
+    using State = ColumnsHashing::HashMethodOneNumberLowBits<typename Data::value_type, Mapped, FieldType>;
+
+    std::optional<Sizes> shuffleKeyColumns(std::vector<IColumn *> &, const Sizes &) { return {}; }
+
+    /// Extend the range to cover [new_min, new_max], return false and keep the range unchanged if the range
+    /// would contain more than `range_limit` values.
+    bool tryExtendRange(FieldType new_min, FieldType new_max, size_t range_limit)
+    {
+        new_min = std::min(new_min, min_key);
+        new_max = std::max(new_max, max_key);
+        if (new_max - new_min >= std::min(range_limit, max_range))
+            return false;
+        min_key = new_min;
+        max_key = new_max;
+        return true;
+    }
+
+    /// Restore the key from its low 16 bits.
+    FieldType restoreKey(Key key) const
+    {
+        return min_key + static_cast<UInt16>(key - static_cast<UInt16>(min_key));
+    }
+
+    void insertKeyIntoColumns(const Key & key, std::vector<IColumn *> & key_columns, const Sizes & /*key_sizes*/, const TiDB::TiDBCollators &) const
+    {
+        FieldType value = restoreKey(key);
+        auto * column = static_cast<ColumnVectorHelper *>(key_columns[0]);
+        column->insertRawData<sizeof(FieldType)>(reinterpret_cast<const char *>(&value));
+    }
+};
+
 /// For the case where there is one string key.
 template <typename TData>
 struct AggregationMethodString
@@ -554,6 +607,8 @@ struct AggregatedDataVariants : private boost::noncopyable
     using AggregationMethod_key16 = AggregationMethodOneNumber<UInt16, AggregatedDataWithUInt16Key, false>;
     using AggregationMethod_key32 = AggregationMethodOneNumber<UInt32, AggregatedDataWithUInt64Key>;
     using AggregationMethod_key64 = AggregationMethodOneNumber<UInt64, AggregatedDataWithUInt64Key>;
+    using AggregationMethod_key32_dense = AggregationMethodOneNumberDense<UInt32>;
+    using AggregationMethod_key64_dense = AggregationMethodOneNumberDense<UInt64>;
     using AggregationMethod_key_int256 = AggregationMethodOneNumber<Int256, AggregatedDataWithInt256Key>;
     using AggregationMethod_key_string = AggregationMethodStringNoCache<AggregatedDataWithShortStringKey>;
     using AggregationMethod_one_key_strbin = AggregationMethodOneKeyStringNoCache<false, AggregatedDataWithShortStringKey>;
@@ -614,6 +669,8 @@ struct AggregatedDataVariants : private boost::noncopyable
     M(key16, false)                                         \
     M(key32, false)                                         \
     M(key64, false)                                         \
+    M(key32_dense, false)                                   \
+    M(key64_dense, false)                                   \
     M(key_string, false)                                    \
     M(key_fixed_string, false)                              \
     M(keys16, false)                                        \
@@ -818,6 +875,8 @@ struct AggregatedDataVariants : private boost::noncopyable
 #define APPLY_FOR_VARIANTS_NOT_CONVERTIBLE_TO_TWO_LEVEL(M) \
     M(key8)                                                \
     M(key16)                                               \
+    M(key32_dense)                                         \
+    M(key64_dense)                                         \
     M(keys16)                                              \
     M(key64_hash64)                                        \
     M(key_fixed_string_hash64)                             \
@@ -830,6 +889,11 @@ struct AggregatedDataVariants : private boost::noncopyable
     APPLY_FOR_VARIANTS_NOT_CONVERTIBLE_TO_TWO_LEVEL(M) \
     APPLY_FOR_VARIANTS_CONVERTIBLE_TO_TWO_LEVEL(M)
 
+/// The dense variants and the hash variants of the same key, which they are converted to when the keys are not dense.
+#define APPLY_FOR_VARIANTS_DENSE(M) \
+    M(key32_dense, key32)           \
+    M(key64_dense, key64)
+
     bool isConvertibleToTwoLevel() const
     {
         return isConvertibleToTwoLevel(type);
@@ -847,6 +911,15 @@ struct AggregatedDataVariants : private boost::noncopyable
 
             APPLY_FOR_VARIANTS_CONVERTIBLE_TO_TWO_LEVEL(M)
 
+#undef M
+
+/// The dense variants are converted to the hash variants first.
+#define M(NAME, HASH_NAME) \
+    case Type::NAME:       \
+        return true;
+
+            APPLY_FOR_VARIANTS_DENSE(M)
+
 #undef M
         default:
             return false;
@@ -855,6 +928,36 @@ struct AggregatedDataVariants : private boost::noncopyable
 
     void convertToTwoLevel();
 
+    bool isDense() const
+    {
+        return isDense(type);
+    }
+
+    static bool isDense(Type type)
+    {
+        switch (type)
+        {
+#define M(NAME, HASH_NAME) \
+    case Type::NAME:       \
+        return true;
+
+            APPLY_FOR_VARIANTS_DENSE(M)
+
+#undef M
+        default:
+            return false;
+        }
+    }
+
+    /// Extend the key range of a dense variant to cover the keys of `key_column`, only the rows selected by `filter` are considered.
+    /// Return false if the range would contain more than `range_limit` values, the variant should be converted by `convertDenseToHash` then.
+    bool tryExtendDenseRange(const IColumn * key_column, size_t rows, const IColumn::Filter * filter, size_t range_limit);
+
+    /// Extend the key range of a dense variant to cover the key range of `other`, which is of the same type, so that `other` can be merged into it.
+    bool tryExtendDenseRange(const AggregatedDataVariants & other, size_t range_limit);
+
+    void convertDenseToHash();
+
 #define APPLY_FOR_VARIANTS_TWO_LEVEL(M)               \
     M(key32_two_level)                                \
     M(key64_two_level)                                \
@@ -948,6 +1051,21 @@ public:
         UInt64 max_block_size;
         TiDB::TiDBCollators collators;
 
+        /// For the partial aggregation whose results are merged by a final aggregation later.
+        /// After aggregating `bypass_check_rows` rows in a thread, if the number of groups / the number of rows
+        /// reaches `bypass_groups_ratio`, the following rows are passed through without being aggregated.
+        /// 0 means the aggregation is never bypassed. See `Aggregator::checkBypass`.
+        /// The bypassed rows are converted to final results, so it can be enabled only if the final results are output.
+        size_t bypass_check_rows = 0;
+        double bypass_groups_ratio = 0;
+        /// Count the bypassed rows of all the aggregators of an executor, can be nullptr.
+        std::shared_ptr<std::atomic<size_t>> bypass_rows;
+
+        /// If there is a single 32/64 bits numeric key, aggregate by a direct-addressed table while the keys fall
+        /// into a range of at most this number of values, which is capped at 65536. 0 means never.
+        /// See `AggregationMethodOneNumberDense`.
+        size_t max_dense_key_range = 0;
+
         Params(
             const Block & src_header_,
             const ColumnNumbers & keys_,
@@ -1017,7 +1135,9 @@ public:
     Aggregator(const Params & params_, const String & req_id);
 
     /// Aggregate the source. Get the result in the form of one of the data structures.
-    void execute(const BlockInputStreamPtr & stream, AggregatedDataVariants & result);
+    /// Return true if the aggregation is bypassed, the remaining blocks of the source should be converted
+    /// by `convertToBypassBlock`.
+    bool execute(const BlockInputStreamPtr & stream, AggregatedDataVariants & result);
 
     using AggregateColumns = std::vector<ColumnRawPtrs>;
     using AggregateColumnsData = std::vector<ColumnAggregateFunction::Container *>;
@@ -1025,12 +1145,13 @@ public:
     using AggregateFunctionsPlainPtrs = std::vector<IAggregateFunction *>;
 
     /// Process one block. Return false if the processing should be aborted.
+    /// If `filter` is not null, only the selected rows of the block are aggregated.
     bool executeOnBlock(
         const Block & block,
         AggregatedDataVariants & result,
         ColumnRawPtrs & key_columns,
-        AggregateColumns & aggregate_columns /// Passed to not create them anew for each block
-    );
+        AggregateColumns & aggregate_columns, /// Passed to not create them anew for each block
+        const IColumn::Filter * filter = nullptr);
 
     /** Merge several aggregation data structures and output the MergingBucketsPtr used to merge.
       * Return nullptr if there are no non empty data_variant.
@@ -1045,6 +1166,17 @@ public:
       */
     Blocks convertBlockToTwoLevel(const Block & block);
 
+    /** Return true if the partial aggregation should not aggregate the following rows but pass them through
+      *  by `convertToBypassBlock`, because the rows can not be reduced effectively.
+      * `src_rows` is the number of rows that have been aggregated into `data_variants`.
+      */
+    bool checkBypass(const AggregatedDataVariants & data_variants, size_t src_rows) const;
+
+    /** Convert every row of the block to a row of the final result, as if every row is a group of its own.
+      * If `filter` is not null, only the selected rows are converted.
+      */
+    Block convertToBypassBlock(const Block & block, const IColumn::Filter * filter = nullptr) const;
+
     using CancellationHook = std::function<bool()>;
 
     /** Set a function that checks whether the current task can be aborted.
@@ -1069,7 +1201,9 @@ protected:
     Params params;
 
     AggregatedDataVariants::Type method_chosen;
-
+    /// The method to init the data variants with, it is the dense variant of `method_chosen` if the keys may be dense.
+    /// The data variants are converted to `method_chosen` if the keys turn out not dense.
+    AggregatedDataVariants::Type method_to_init;
 
     Sizes key_sizes;
 
@@ -1143,7 +1277,8 @@ protected:
         size_t rows,
         ColumnRawPtrs & key_columns,
         TiDB::TiDBCollators & collators,
-        AggregateFunctionInstruction * aggregate_instructions) const;
+        AggregateFunctionInstruction * aggregate_instructions,
+        const IColumn::Filter * filter) const;
 
     template <typename Method>
     void executeImplBatch(
@@ -1151,7 +1286,8 @@ protected:
         typename Method::State & state,
         Arena * aggregates_pool,
         size_t rows,
-        AggregateFunctionInstruction * aggregate_instructions) const;
+        AggregateFunctionInstruction * aggregate_instructions,
+        const IColumn::Filter * filter) const;
 
     /// For case when there are no keys (all aggregate into one row).
     static void executeWithoutKeyImpl(
@@ -31,6 +31,7 @@
 #include <Encryption/DataKeyManager.h>
 #include <Encryption/FileProvider.h>
 #include <Encryption/RateLimiter.h>
+#include <Flash/Coprocessor/CopResultCache.h>
 #include <Flash/Coprocessor/DAGContext.h>
 #include <IO/ReadBufferFromFile.h>
 #include <IO/UncompressedCache.h>
@@ -54,6 +55,7 @@
 #include <Server/RaftConfigParser.h>
 #include <Server/ServerInfo.h>
 #include <Storages/BackgroundProcessingPool.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileSchema.h>
 #include <Storages/DeltaMerge/DeltaIndexManager.h>
 #include <Storages/DeltaMerge/Index/MinMaxIndex.h>
@@ -147,6 +149,8 @@ struct ContextShared
     mutable DBGInvoker dbg_invoker; /// Execute inner functions, debug only.
     mutable MarkCachePtr mark_cache; /// Cache of marks in compressed files.
     mutable DM::MinMaxIndexCachePtr minmax_index_cache; /// Cache of minmax index in compressed files.
+    mutable DM::BitmapFilterCachePtr bitmap_filter_cache; /// Cache of bitmap filters of segments.
+    mutable CopResultCachePtr cop_result_cache; /// Cache of coprocessor responses.
     mutable DM::DeltaIndexManagerPtr delta_index_manager; /// Manage the Delta Indies of Segments.
     ProcessList process_list; /// Executing queries at the moment.
     ViewDependencies view_dependencies; /// Current dependencies
@@ -1365,6 +1369,45 @@ void Context::dropMinMaxIndexCache() const
         shared->minmax_index_cache->reset();
 }
 
+void Context::setBitmapFilterCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->bitmap_filter_cache)
+        throw Exception("Bitmap filter cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->bitmap_filter_cache = std::make_shared<DM::BitmapFilterCache>(cache_size_in_bytes);
+}
+
+DM::BitmapFilterCachePtr Context::getBitmapFilterCache() const
+{
+    auto lock = getLock();
+    return shared->bitmap_filter_cache;
+}
+
+void Context::setCopResultCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->cop_result_cache)
+        throw Exception("Coprocessor result cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->cop_result_cache = std::make_shared<CopResultCache>(cache_size_in_bytes);
+}
+
+CopResultCachePtr Context::getCopResultCache() const
+{
+    auto lock = getLock();
+    return shared->cop_result_cache;
+}
+
+void Context::dropCopResultCache() const
+{
+    auto lock = getLock();
+    if (shared->cop_result_cache)
+        shared->cop_result_cache->reset();
+}
+
 bool Context::isDeltaIndexLimited() const
 {
     // Don't need to use a lock here, as delta_index_manager should be set at starting up.
@@ -103,11 +103,13 @@ using MockMPPServerInfo = DB::tests::MockMPPServerInfo;
 class TiFlashSecurityConfig;
 using TiFlashSecurityConfigPtr = std::shared_ptr<TiFlashSecurityConfig>;
 class MockStorage;
+class CopResultCache;
 
 enum class PageStorageRunMode : UInt8;
 namespace DM
 {
 class MinMaxIndexCache;
+class BitmapFilterCache;
 class DeltaIndexManager;
 class GlobalStoragePool;
 class SharedBlockSchemas;
@@ -376,6 +378,14 @@ public:
     std::shared_ptr<DM::MinMaxIndexCache> getMinMaxIndexCache() const;
     void dropMinMaxIndexCache() const;
 
+    void setBitmapFilterCache(size_t cache_size_in_bytes);
+    std::shared_ptr<DM::BitmapFilterCache> getBitmapFilterCache() const;
+
+    /// Create a cache of coprocessor responses of specified size. This can be done only once.
+    void setCopResultCache(size_t cache_size_in_bytes);
+    std::shared_ptr<CopResultCache> getCopResultCache() const;
+    void dropCopResultCache() const;
+
     bool isDeltaIndexLimited() const;
     void setDeltaIndexManager(size_t cache_size_in_bytes);
     std::shared_ptr<DM::DeltaIndexManager> getDeltaIndexManager() const;
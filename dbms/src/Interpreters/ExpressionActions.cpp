@@ -13,9 +13,12 @@
 // limitations under the License.
 
 #include <Columns/ColumnArray.h>
+#include <Columns/ColumnConst.h>
 #include <Columns/ColumnNullable.h>
+#include <Columns/ColumnsCommon.h>
 #include <Columns/ColumnsNumber.h>
 #include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
 #include <Common/typeid_cast.h>
 #include <DataTypes/DataTypeArray.h>
 #include <DataTypes/DataTypeNullable.h>
@@ -24,6 +27,7 @@
 #include <Interpreters/ExpressionActions.h>
 #include <Interpreters/Join.h>
 
+#include <algorithm>
 #include <optional>
 #include <set>
 
@@ -43,7 +47,22 @@ extern const int TOO_MANY_TEMPORARY_NON_CONST_COLUMNS;
 
 Names ExpressionAction::getNeededColumns() const
 {
-    Names res = argument_names;
+    Names res;
+    if (short_circuit)
+    {
+        /// The lazy arguments are computed from their own inputs when the function is applied.
+        for (size_t i = 0; i < argument_names.size(); ++i)
+        {
+            if (!short_circuit->getArgument(i))
+                res.push_back(argument_names[i]);
+        }
+        for (const auto & argument : short_circuit->arguments)
+            res.insert(res.end(), argument->input_names.begin(), argument->input_names.end());
+    }
+    else
+    {
+        res = argument_names;
+    }
 
     for (const auto & column : projections)
         res.push_back(column.first);
@@ -318,6 +337,9 @@ void ExpressionAction::execute(Block & block) const
     {
     case APPLY_FUNCTION:
     {
+        if (short_circuit)
+            executeShortCircuitArguments(block);
+
         ColumnNumbers arguments(argument_names.size());
         for (size_t i = 0; i < argument_names.size(); ++i)
         {
@@ -385,6 +407,296 @@ void ExpressionAction::execute(Block & block) const
     }
 }
 
+namespace
+{
+/// Clear the mask of the rows where `column` is not null and equal to `value` in boolean context.
+/// Only the UInt8 based columns are inspected, for other columns the mask is kept, which is always safe.
+void clearRowsOfValue(IColumn::Filter & mask, const IColumn & column, bool value)
+{
+    if (const auto * column_const = typeid_cast<const ColumnConst *>(&column))
+    {
+        const IColumn * data_column = &column_const->getDataColumn();
+        if (data_column->isNullAt(0))
+            return;
+        if (const auto * nullable = typeid_cast<const ColumnNullable *>(data_column))
+            data_column = &nullable->getNestedColumn();
+        const auto * uint8_column = typeid_cast<const ColumnUInt8 *>(data_column);
+        if (uint8_column && (uint8_column->getData()[0] != 0) == value)
+            std::fill(mask.begin(), mask.end(), 0);
+        return;
+    }
+
+    const IColumn * nested_column = &column;
+    const UInt8 * null_map = nullptr;
+    if (const auto * nullable = typeid_cast<const ColumnNullable *>(&column))
+    {
+        nested_column = &nullable->getNestedColumn();
+        null_map = nullable->getNullMapData().data();
+    }
+    const auto * uint8_column = typeid_cast<const ColumnUInt8 *>(nested_column);
+    if (!uint8_column)
+        return;
+
+    const auto & data = uint8_column->getData();
+    for (size_t i = 0; i < mask.size(); ++i)
+    {
+        if ((data[i] != 0) == value && !(null_map && null_map[i]))
+            mask[i] = 0;
+    }
+}
+
+/// Set `true_rows` to the rows where `column` is not null and true in boolean context.
+/// Return false if the column can not be inspected, i.e. it is not based on UInt8.
+bool getTrueRows(const IColumn & column, IColumn::Filter & true_rows)
+{
+    if (column.onlyNull())
+    {
+        true_rows.assign(column.size(), static_cast<UInt8>(0));
+        return true;
+    }
+
+    if (const auto * column_const = typeid_cast<const ColumnConst *>(&column))
+    {
+        const IColumn * data_column = &column_const->getDataColumn();
+        if (const auto * nullable = typeid_cast<const ColumnNullable *>(data_column))
+            data_column = &nullable->getNestedColumn();
+        const auto * uint8_column = typeid_cast<const ColumnUInt8 *>(data_column);
+        if (!uint8_column)
+            return false;
+        const bool is_true = !column_const->isNullAt(0) && uint8_column->getData()[0] != 0;
+        true_rows.assign(column.size(), static_cast<UInt8>(is_true));
+        return true;
+    }
+
+    const IColumn * nested_column = &column;
+    const UInt8 * null_map = nullptr;
+    if (const auto * nullable = typeid_cast<const ColumnNullable *>(&column))
+    {
+        nested_column = &nullable->getNestedColumn();
+        null_map = nullable->getNullMapData().data();
+    }
+    const auto * uint8_column = typeid_cast<const ColumnUInt8 *>(nested_column);
+    if (!uint8_column)
+        return false;
+
+    const auto & data = uint8_column->getData();
+    true_rows.resize(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+        true_rows[i] = data[i] != 0 && !(null_map && null_map[i]);
+    return true;
+}
+
+/// The rows of `mask` where `condition` is true are moved into `matched`, a null condition is not matched.
+/// If the condition can not be inspected, all the rows of `mask` are kept in both of them, so that both
+/// branches are evaluated over these rows.
+void splitRowsByCondition(IColumn::Filter & mask, const IColumn & condition, IColumn::Filter & matched)
+{
+    if (!getTrueRows(condition, matched))
+    {
+        matched.assign(mask.begin(), mask.end());
+        return;
+    }
+    for (size_t i = 0; i < mask.size(); ++i)
+    {
+        matched[i] &= mask[i];
+        mask[i] &= !matched[i];
+    }
+}
+
+void getNullRows(const IColumn & column, IColumn::Filter & mask)
+{
+    if (column.isColumnConst())
+    {
+        mask.assign(column.size(), static_cast<UInt8>(column.isNullAt(0)));
+    }
+    else if (const auto * nullable = typeid_cast<const ColumnNullable *>(&column))
+    {
+        const auto & null_map = nullable->getNullMapData();
+        mask.assign(null_map.begin(), null_map.end());
+    }
+    else
+    {
+        mask.assign(column.size(), static_cast<UInt8>(0));
+    }
+}
+
+/// Put the rows of `column` back to the positions selected by `mask`, the other positions are filled with default values.
+ColumnPtr expandColumn(const ColumnPtr & column, const IColumn::Filter & mask)
+{
+    ColumnPtr src = column->convertToFullColumnIfConst();
+    if (!src)
+        src = column;
+
+    auto res = src->cloneEmpty();
+    res->reserve(mask.size());
+    size_t src_pos = 0;
+    for (size_t begin = 0; begin < mask.size();)
+    {
+        size_t end = begin + 1;
+        while (end < mask.size() && static_cast<bool>(mask[end]) == static_cast<bool>(mask[begin]))
+            ++end;
+        if (mask[begin])
+        {
+            res->insertRangeFrom(*src, src_pos, end - begin);
+            src_pos += end - begin;
+        }
+        else
+        {
+            res->insertManyDefaults(end - begin);
+        }
+        begin = end;
+    }
+    return res;
+}
+
+/// Evaluate the lazy argument on the rows selected by `mask` and insert it into the block.
+/// Return the number of the selected rows.
+size_t evaluateShortCircuitArgument(
+    Block & block,
+    const String & name,
+    const ShortCircuitArguments::Argument & argument,
+    const IColumn::Filter & mask)
+{
+    size_t rows = block.rows();
+    size_t selected_rows = countBytesInFilter(mask);
+    if (selected_rows == 0 && rows != 0)
+    {
+        block.insert({argument.type->createColumnConstWithDefaultValue(rows)->convertToFullColumnIfConst(), argument.type, name});
+        return 0;
+    }
+
+    Stopwatch watch;
+    Block sub_block;
+    for (const auto & input_name : argument.input_names)
+    {
+        auto input = block.getByName(input_name);
+        if (selected_rows != rows)
+            input.column = input.column->filter(mask, selected_rows);
+        sub_block.insert(std::move(input));
+    }
+    for (const auto & action : argument.actions)
+        action.execute(sub_block);
+
+    auto result = sub_block.getByName(name);
+    if (selected_rows != rows)
+        result.column = expandColumn(result.column, mask);
+    block.insert(std::move(result));
+
+    argument.evaluated_rows.fetch_add(selected_rows, std::memory_order_relaxed);
+    argument.elapsed_ns.fetch_add(watch.elapsed(), std::memory_order_relaxed);
+    return selected_rows;
+}
+
+/// The expected cost to decide one row by the argument, the arguments not evaluated yet come first.
+double getShortCircuitRank(const ShortCircuitArguments::Argument & argument)
+{
+    auto evaluated_rows = argument.evaluated_rows.load(std::memory_order_relaxed);
+    if (evaluated_rows == 0)
+        return 0;
+    double cost_per_row = static_cast<double>(argument.elapsed_ns.load(std::memory_order_relaxed)) / evaluated_rows;
+    double decided_ratio = static_cast<double>(argument.decided_rows.load(std::memory_order_relaxed)) / evaluated_rows;
+    return cost_per_row / std::max(decided_ratio, 0.001);
+}
+} // namespace
+
+void ExpressionAction::executeShortCircuitArguments(Block & block) const
+{
+    size_t rows = block.rows();
+    if (rows == 0)
+    {
+        /// Just like the eager evaluation, e.g. for getting the header.
+        IColumn::Filter all_rows;
+        for (const auto & argument : short_circuit->arguments)
+            evaluateShortCircuitArgument(block, argument_names[argument->position], *argument, all_rows);
+        return;
+    }
+
+    auto get_column = [&](size_t position) -> const IColumn & {
+        return *block.getByName(argument_names[position]).column;
+    };
+
+    switch (short_circuit->kind)
+    {
+    case ShortCircuitArguments::AND:
+    case ShortCircuitArguments::OR:
+    {
+        /// `and` is decided by a false argument and `or` by a true one.
+        const bool decided_value = short_circuit->kind == ShortCircuitArguments::OR;
+        IColumn::Filter undecided(rows, 1);
+        for (size_t i = 0; i < argument_names.size(); ++i)
+        {
+            if (!short_circuit->getArgument(i))
+                clearRowsOfValue(undecided, get_column(i), decided_value);
+        }
+
+        std::vector<std::pair<double, const ShortCircuitArguments::Argument *>> order;
+        order.reserve(short_circuit->arguments.size());
+        for (const auto & argument : short_circuit->arguments)
+            order.emplace_back(getShortCircuitRank(*argument), argument.get());
+        std::stable_sort(order.begin(), order.end(), [](const auto & lhs, const auto & rhs) { return lhs.first < rhs.first; });
+
+        for (const auto & ranked_argument : order)
+        {
+            const auto * argument = ranked_argument.second;
+            size_t selected_rows = evaluateShortCircuitArgument(block, argument_names[argument->position], *argument, undecided);
+            clearRowsOfValue(undecided, get_column(argument->position), decided_value);
+            if (selected_rows != 0)
+                argument->decided_rows.fetch_add(selected_rows - countBytesInFilter(undecided), std::memory_order_relaxed);
+        }
+        break;
+    }
+    case ShortCircuitArguments::MULTI_IF:
+    {
+        /// multiIf(cond_1, then_1, cond_2, then_2, ..., else)
+        IColumn::Filter remaining(rows, 1);
+        IColumn::Filter matched;
+        for (size_t i = 0; i < argument_names.size(); ++i)
+        {
+            const bool is_then = i % 2 == 1;
+            const bool is_condition = !is_then && i + 1 < argument_names.size();
+            if (const auto * argument = short_circuit->getArgument(i))
+                evaluateShortCircuitArgument(block, argument_names[i], *argument, is_then ? matched : remaining);
+            if (is_condition)
+                splitRowsByCondition(remaining, get_column(i), matched);
+        }
+        break;
+    }
+    case ShortCircuitArguments::IF_NULL:
+    {
+        /// ifNull(expr, alt_expr)
+        if (const auto * argument = short_circuit->getArgument(1))
+        {
+            IColumn::Filter null_rows;
+            getNullRows(get_column(0), null_rows);
+            evaluateShortCircuitArgument(block, argument_names[1], *argument, null_rows);
+        }
+        break;
+    }
+    }
+}
+
+const ShortCircuitArguments::Argument * ShortCircuitArguments::getArgument(size_t position) const
+{
+    for (const auto & argument : arguments)
+    {
+        if (argument->position == position)
+            return argument.get();
+    }
+    return nullptr;
+}
+
+std::optional<ShortCircuitArguments::Kind> ShortCircuitArguments::getKind(const String & function_name)
+{
+    if (function_name == "and")
+        return AND;
+    if (function_name == "or")
+        return OR;
+    if (function_name == "multiIf" || function_name == "if")
+        return MULTI_IF;
+    if (function_name == "ifNull")
+        return IF_NULL;
+    return std::nullopt;
+}
 
 String ExpressionAction::toString() const
 {
@@ -416,6 +728,20 @@ String ExpressionAction::toString() const
             ss << argument_names[i];
         }
         ss << ")";
+        if (short_circuit)
+        {
+            for (const auto & argument : short_circuit->arguments)
+            {
+                ss << " LAZY " << argument_names[argument->position] << " [";
+                for (size_t i = 0; i < argument->actions.size(); ++i)
+                {
+                    if (i)
+                        ss << "; ";
+                    ss << argument->actions[i].toString();
+                }
+                ss << "]";
+            }
+        }
         break;
 
     case JOIN:
@@ -505,6 +831,22 @@ void ExpressionActions::execute(Block & block) const
         action.execute(block);
 }
 
+bool ExpressionActions::isProjectionOnly() const
+{
+    return std::all_of(actions.begin(), actions.end(), [](const ExpressionAction & action) {
+        switch (action.type)
+        {
+        case ExpressionAction::ADD_COLUMN:
+        case ExpressionAction::REMOVE_COLUMN:
+        case ExpressionAction::COPY_COLUMN:
+        case ExpressionAction::PROJECT:
+            return true;
+        default:
+            return false;
+        }
+    });
+}
+
 std::string ExpressionActions::getSmallestColumn(const NamesAndTypesList & columns)
 {
     std::optional<size_t> min_size;
@@ -528,7 +870,7 @@ std::string ExpressionActions::getSmallestColumn(const NamesAndTypesList & colum
     return res;
 }
 
-void ExpressionActions::finalize(const Names & output_columns)
+void ExpressionActions::finalize(const Names & output_columns, bool enable_short_circuit_evaluation)
 {
     NameSet final_columns;
     for (const auto & name : output_columns)
@@ -680,6 +1022,170 @@ void ExpressionActions::finalize(const Names & output_columns)
     }
 
     actions.swap(new_actions);
+
+    if (enable_short_circuit_evaluation)
+        prepareShortCircuitEvaluation();
+}
+
+void ExpressionActions::prepareShortCircuitEvaluation()
+{
+    /// The analysis relies on that every column is produced by exactly one action,
+    /// and that the rows of the block are kept during the execution.
+    NameSet produced_names;
+    for (const auto & action : actions)
+    {
+        if (action.type == ExpressionAction::JOIN || action.type == ExpressionAction::EXPAND)
+            return;
+        if (!action.result_name.empty() && !produced_names.insert(action.result_name).second)
+            return;
+    }
+
+    NameSet output_names;
+    for (const auto & column : sample_block)
+        output_names.insert(column.name);
+
+    auto is_used_by = [&](size_t index, const String & name) {
+        const auto & action = actions[index];
+        if (action.type == ExpressionAction::REMOVE_COLUMN)
+            return false;
+        auto needed_columns = action.getNeededColumns();
+        return std::find(needed_columns.begin(), needed_columns.end(), name) != needed_columns.end();
+    };
+
+    for (size_t function_index = 0; function_index < actions.size(); ++function_index)
+    {
+        const auto & function_action = actions[function_index];
+        if (function_action.type != ExpressionAction::APPLY_FUNCTION || !function_action.function || function_action.short_circuit
+            || function_action.argument_names.size() < 2)
+            continue;
+        auto kind = ShortCircuitArguments::getKind(function_action.function->getName());
+        if (!kind)
+            continue;
+
+        /// The actions before a projection may see different columns.
+        size_t first_movable = 0;
+        for (size_t i = function_index; i > 0; --i)
+        {
+            if (actions[i - 1].type == ExpressionAction::PROJECT)
+            {
+                first_movable = i;
+                break;
+            }
+        }
+
+        auto short_circuit = std::make_shared<ShortCircuitArguments>();
+        short_circuit->kind = *kind;
+        std::vector<bool> moved(actions.size(), false);
+        NameSet moved_results;
+        NameSet moved_inputs;
+
+        /// The first argument is always evaluated on all the rows.
+        const auto & argument_names = function_action.argument_names;
+        for (size_t position = 1; position < argument_names.size(); ++position)
+        {
+            const auto & name = argument_names[position];
+            if (std::count(argument_names.begin(), argument_names.end(), name) != 1 || output_names.count(name))
+                continue;
+
+            /// Collect the actions whose results are only used to compute this argument, from back to front.
+            std::set<size_t> argument_actions;
+            NameSet argument_results;
+            bool has_function = false;
+            for (size_t i = function_index; i-- > first_movable;)
+            {
+                const auto & action = actions[i];
+                if (moved[i] || (action.type != ExpressionAction::APPLY_FUNCTION && action.type != ExpressionAction::ADD_COLUMN))
+                    continue;
+                if (action.type == ExpressionAction::APPLY_FUNCTION && !action.function->isDeterministic())
+                    continue;
+                if (output_names.count(action.result_name))
+                    continue;
+
+                bool used = false;
+                bool only_used_by_argument = true;
+                for (size_t j = i + 1; j < actions.size() && only_used_by_argument; ++j)
+                {
+                    if (!is_used_by(j, action.result_name))
+                        continue;
+                    used = true;
+                    if (j == function_index)
+                        only_used_by_argument = action.result_name == name;
+                    else
+                        only_used_by_argument = argument_actions.count(j) > 0;
+                }
+                if (!used || !only_used_by_argument)
+                    continue;
+
+                argument_actions.insert(i);
+                argument_results.insert(action.result_name);
+                has_function |= action.type == ExpressionAction::APPLY_FUNCTION;
+            }
+            if (!argument_results.count(name) || !has_function)
+                continue;
+
+            auto argument = std::make_unique<ShortCircuitArguments::Argument>();
+            argument->position = position;
+            NameSet input_names;
+            for (auto i : argument_actions)
+            {
+                const auto & action = actions[i];
+                for (const auto & needed_column : action.getNeededColumns())
+                {
+                    if (!argument_results.count(needed_column) && input_names.insert(needed_column).second)
+                        argument->input_names.push_back(needed_column);
+                }
+                if (action.result_name == name)
+                    argument->type = action.result_type;
+                argument->actions.push_back(action);
+            }
+            /// Need some input to know the number of rows.
+            if (argument->input_names.empty())
+                continue;
+
+            for (auto i : argument_actions)
+                moved[i] = true;
+            argument_results.erase(name);
+            moved_results.insert(argument_results.begin(), argument_results.end());
+            moved_inputs.insert(input_names.begin(), input_names.end());
+            short_circuit->arguments.push_back(std::move(argument));
+        }
+
+        if (short_circuit->arguments.empty())
+            continue;
+
+        /// Remove the moved actions, together with the removal of their intermediate results. The removal
+        /// of their inputs is postponed until the function is applied.
+        Actions new_actions;
+        Actions postponed_removals;
+        size_t new_function_index = 0;
+        new_actions.reserve(actions.size());
+        for (size_t i = 0; i < actions.size(); ++i)
+        {
+            const auto & action = actions[i];
+            if (moved[i])
+                continue;
+            if (action.type == ExpressionAction::REMOVE_COLUMN)
+            {
+                if (moved_results.count(action.source_name))
+                    continue;
+                if (i < function_index && moved_inputs.count(action.source_name))
+                {
+                    postponed_removals.push_back(action);
+                    continue;
+                }
+            }
+
+            new_actions.push_back(action);
+            if (i == function_index)
+            {
+                new_actions.back().short_circuit = short_circuit;
+                new_function_index = new_actions.size() - 1;
+                new_actions.insert(new_actions.end(), postponed_removals.begin(), postponed_removals.end());
+            }
+        }
+        actions.swap(new_actions);
+        function_index = new_function_index + postponed_removals.size();
+    }
 }
 
 
@@ -732,7 +1238,7 @@ void ExpressionActionsChain::finalize()
             for (const auto & it : steps[i + 1].actions->getRequiredColumnsWithTypes())
                 required_output.push_back(it.name);
         }
-        steps[i].actions->finalize(required_output);
+        steps[i].actions->finalize(required_output, enable_short_circuit_evaluation);
     }
 
     /// Adding the ejection of unnecessary columns to the beginning of each step.
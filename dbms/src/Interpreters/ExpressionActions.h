@@ -20,6 +20,8 @@
 #include <Interpreters/Expand.h>
 #include <Storages/Transaction/Collator.h>
 
+#include <atomic>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -49,6 +51,8 @@ using DataTypePtr = std::shared_ptr<const IDataType>;
 class IBlockInputStream;
 using BlockInputStreamPtr = std::shared_ptr<IBlockInputStream>;
 
+struct ShortCircuitArguments;
+
 
 /** Action on the block.
   */
@@ -86,6 +90,8 @@ public:
     FunctionBasePtr function;
     Names argument_names;
     TiDB::TiDBCollatorPtr collator = nullptr;
+    /// The arguments only evaluated on the rows still undecided by the former arguments, see ShortCircuitArguments.
+    std::shared_ptr<const ShortCircuitArguments> short_circuit;
 
     /// For JOIN
     std::shared_ptr<const Join> join;
@@ -122,6 +128,50 @@ private:
 
     void prepare(Block & sample_block);
     void execute(Block & block) const;
+    void executeShortCircuitArguments(Block & block) const;
+};
+
+
+/** Short-circuit evaluation for `and`, `or`, `if`, `multiIf` and `ifNull`.
+  * The actions only used to compute one argument (except the first one) are moved out of the action list
+  * and evaluated when the function is applied, only on the rows whose result is not decided yet, e.g.
+  *   and(a, b): b is evaluated on the rows where a is not false.
+  *   multiIf(c1, t1, c2, t2, e): t1 where c1 is true, c2 where c1 is not true, and so on.
+  *   ifNull(a, b): b where a is null.
+  * The other rows of the argument are filled with default values, which never affect the result.
+  * The lazy arguments of `and`/`or` are evaluated in the order of their cost per decided row observed so far.
+  */
+struct ShortCircuitArguments
+{
+    enum Kind
+    {
+        AND,
+        OR,
+        MULTI_IF,
+        IF_NULL,
+    };
+
+    struct Argument
+    {
+        /// The position in the argument list of the function.
+        size_t position = 0;
+        DataTypePtr type;
+        std::vector<ExpressionAction> actions;
+        /// The columns needed by `actions` but not produced by them.
+        Names input_names;
+
+        /// Runtime statistics for reordering, shared by all the threads executing this expression.
+        mutable std::atomic<UInt64> evaluated_rows{0};
+        mutable std::atomic<UInt64> decided_rows{0};
+        mutable std::atomic<UInt64> elapsed_ns{0};
+    };
+
+    Kind kind;
+    std::vector<std::unique_ptr<Argument>> arguments;
+
+    const Argument * getArgument(size_t position) const;
+
+    static std::optional<Kind> getKind(const String & function_name);
 };
 
 
@@ -176,7 +226,8 @@ public:
     /// - Does not reorder the columns.
     /// - Does not remove "unexpected" columns (for example, added by functions).
     /// - If output_columns is empty, leaves one arbitrary column (so that the number of rows in the block is not lost).
-    void finalize(const Names & output_columns);
+    /// - If enable_short_circuit_evaluation, the arguments of and/or/if/multiIf/ifNull are evaluated lazily.
+    void finalize(const Names & output_columns, bool enable_short_circuit_evaluation = false);
 
     const Actions & getActions() const { return actions; }
 
@@ -194,6 +245,10 @@ public:
     /// Execute the expression on the block. The block must contain all the columns returned by getRequiredColumns.
     void execute(Block & block) const;
 
+    /// Whether the expression only adds, removes, copies or renames columns. Such an expression keeps the rows
+    /// one-to-one and never fails on any row, so it can be executed before a pending filter is applied.
+    bool isProjectionOnly() const;
+
     /// Obtain a sample block that contains the names and types of result columns.
     const Block & getSampleBlock() const { return sample_block; }
 
@@ -209,6 +264,9 @@ private:
     Block sample_block;
 
     void addImpl(ExpressionAction action, Names & new_names);
+
+    /// Move the actions only used by one argument of the short-circuit functions into them, see ShortCircuitArguments.
+    void prepareShortCircuitEvaluation();
 };
 
 using ExpressionActionsPtr = std::shared_ptr<ExpressionActions>;
@@ -240,6 +298,9 @@ struct ExpressionActionsChain
 
     Steps steps;
 
+    /// Passed to `ExpressionActions::finalize` of every step.
+    bool enable_short_circuit_evaluation = false;
+
     void addStep();
 
     void finalize();
@@ -18,6 +18,7 @@
 #include <Columns/ColumnString.h>
 #include <Common/ColumnsHashing.h>
 #include <Common/FailPoint.h>
+#include <Common/Stopwatch.h>
 #include <Common/typeid_cast.h>
 #include <Core/ColumnNumbers.h>
 #include <DataStreams/HashJoinBuildBlockInputStream.h>
@@ -372,6 +373,56 @@ static size_t getTotalRowCountImpl(const Maps & maps, Join::Type type)
     }
 }
 
+/// The dense key index is only built if it has at most this many slots per key of the hash map, so that its memory
+/// is bounded by that of the hash map, e.g. two keys at the ends of the allowed range do not get a huge index.
+static constexpr size_t dense_key_index_max_slots_per_key = 4;
+
+template <typename Map>
+static void buildDenseKeyIndexForMap(const Map & map, size_t max_range, DenseJoinKeyIndex & index)
+{
+    UInt64 min_key = std::numeric_limits<UInt64>::max();
+    UInt64 max_key = 0;
+    size_t key_count = 0;
+    for (size_t i = 0; i < map.getSegmentSize(); ++i)
+    {
+        for (const auto & cell : map.getSegmentTable(i))
+        {
+            min_key = std::min<UInt64>(min_key, cell.getKey());
+            max_key = std::max<UInt64>(max_key, cell.getKey());
+            ++key_count;
+        }
+    }
+    if (min_key > max_key || max_key - min_key >= max_range || max_key - min_key >= dense_key_index_max_slots_per_key * key_count)
+        return;
+
+    index.min_key = min_key;
+    index.cells.assign(max_key - min_key + 1, nullptr);
+    for (size_t i = 0; i < map.getSegmentSize(); ++i)
+    {
+        for (const auto & cell : map.getSegmentTable(i))
+            index.cells[cell.getKey() - min_key] = &cell;
+    }
+}
+
+template <typename Maps>
+static void buildDenseKeyIndexImpl(const Maps & maps, Join::Type type, size_t max_range, DenseJoinKeyIndex & index)
+{
+    switch (type)
+    {
+    case Join::Type::key32:
+        if (maps.key32)
+            buildDenseKeyIndexForMap(*maps.key32, max_range, index);
+        break;
+    case Join::Type::key64:
+        if (maps.key64)
+            buildDenseKeyIndexForMap(*maps.key64, max_range, index);
+        break;
+    default:
+        /// key8 and key16 are already direct-addressed, the other keys are not integers.
+        break;
+    }
+}
+
 template <typename Maps>
 static size_t getTotalByteCountImpl(const Maps & maps, Join::Type type)
 {
@@ -594,6 +645,7 @@ size_t Join::getTotalByteCount()
                 /// note the return value might not be accurate since it does not use lock, but should be enough for current usage
                 res += partition->pool->size();
             }
+            res += partitioned_build_bytes.load(std::memory_order_relaxed);
         }
     }
     if (peak_build_bytes_usage)
@@ -623,6 +675,7 @@ void Join::setBuildConcurrencyAndInitJoinPartition(size_t build_concurrency_)
         partitions.push_back(std::make_unique<JoinPartition>());
         partitions.back()->pool = std::make_shared<Arena>();
     }
+    partitioned_build_blocks.resize(build_concurrency);
 
     // init for non-joined-streams.
     if (getFullness(kind) || isNullAwareSemiFamily(kind))
@@ -823,38 +876,22 @@ void NO_INLINE insertFromBlockImplTypeCase(
     }
 }
 
-template <ASTTableJoin::Strictness STRICTNESS, typename KeyGetter, typename Map, bool has_null_map>
-void NO_INLINE insertFromBlockImplTypeCaseWithLock(
-    ASTTableJoin::Kind kind,
+/// Scatter the rows of the block by the segment of their keys in the map. If `with_null_rows` is true, there is
+/// an extra segment at the end for the rows with null key, otherwise these rows are ignored.
+template <typename KeyGetter, typename Map, bool has_null_map>
+std::vector<std::vector<size_t>> scatterRowsBySegment(
     Map & map,
+    KeyGetter & key_getter,
     size_t rows,
-    const ColumnRawPtrs & key_columns,
-    const Sizes & key_sizes,
-    const TiDB::TiDBCollators & collators,
-    Block * stored_block,
     ConstNullMapPtr null_map,
-    Join::RowsNotInsertToMap * rows_not_inserted_to_map,
-    size_t stream_index,
-    Arena & pool)
+    bool with_null_rows,
+    Arena & pool,
+    std::vector<std::string> & sort_key_containers)
 {
-    KeyGetter key_getter(key_columns, key_sizes, collators);
-    std::vector<std::string> sort_key_containers(key_columns.size());
     size_t segment_size = map.getSegmentSize();
-    /// when inserting with lock, first calculate and save the segment index for each row, then
-    /// insert the rows segment by segment to avoid too much conflict. This will introduce some overheads:
-    /// 1. key_getter.getKey will be called twice, here we do not cache key because it can not be cached
+    /// note key_getter.getKey will be called again when inserting the rows, here we do not cache key because it can not be cached
     /// with relatively low cost(if key is stringRef, just cache a stringRef is meaningless, we need to cache the whole `sort_key_containers`)
-    /// 2. hash value is calculated twice, maybe we can refine the code to cache the hash value
-    /// 3. extra memory to store the segment index info
-    std::vector<std::vector<size_t>> segment_index_info;
-    if (has_null_map && rows_not_inserted_to_map)
-    {
-        segment_index_info.resize(segment_size + 1);
-    }
-    else
-    {
-        segment_index_info.resize(segment_size);
-    }
+    std::vector<std::vector<size_t>> segment_index_info(with_null_rows ? segment_size + 1 : segment_size);
     size_t rows_per_seg = rows / segment_index_info.size();
     for (auto & segment_index : segment_index_info)
     {
@@ -864,7 +901,7 @@ void NO_INLINE insertFromBlockImplTypeCaseWithLock(
     {
         if (has_null_map && (*null_map)[i])
         {
-            if (rows_not_inserted_to_map)
+            if (with_null_rows)
                 segment_index_info[segment_index_info.size() - 1].push_back(i);
             continue;
         }
@@ -881,6 +918,39 @@ void NO_INLINE insertFromBlockImplTypeCaseWithLock(
         }
         segment_index_info[segment_index].push_back(i);
     }
+    return segment_index_info;
+}
+
+template <ASTTableJoin::Strictness STRICTNESS, typename KeyGetter, typename Map, bool has_null_map>
+void NO_INLINE insertFromBlockImplTypeCaseWithLock(
+    ASTTableJoin::Kind kind,
+    Map & map,
+    size_t rows,
+    const ColumnRawPtrs & key_columns,
+    const Sizes & key_sizes,
+    const TiDB::TiDBCollators & collators,
+    Block * stored_block,
+    ConstNullMapPtr null_map,
+    Join::RowsNotInsertToMap * rows_not_inserted_to_map,
+    size_t stream_index,
+    Arena & pool)
+{
+    KeyGetter key_getter(key_columns, key_sizes, collators);
+    std::vector<std::string> sort_key_containers(key_columns.size());
+    size_t segment_size = map.getSegmentSize();
+    /// when inserting with lock, first calculate and save the segment index for each row, then
+    /// insert the rows segment by segment to avoid too much conflict. This will introduce some overheads:
+    /// 1. key_getter.getKey will be called twice
+    /// 2. hash value is calculated twice, maybe we can refine the code to cache the hash value
+    /// 3. extra memory to store the segment index info
+    auto segment_index_info = scatterRowsBySegment<KeyGetter, Map, has_null_map>(
+        map,
+        key_getter,
+        rows,
+        null_map,
+        has_null_map && rows_not_inserted_to_map,
+        pool,
+        sort_key_containers);
 
     bool null_need_materialize = isNullAwareSemiFamily(kind);
     for (size_t insert_index = 0; insert_index < segment_index_info.size(); insert_index++)
@@ -909,6 +979,73 @@ void NO_INLINE insertFromBlockImplTypeCaseWithLock(
     }
 }
 
+/// Only scatter the rows by segment, the rows are inserted into the map by `insertFromPartitionedBuildBlocksImplType` after
+/// all the build threads finish. The rows with null key are handled here since `rows_not_inserted_to_map` is owned by the stream.
+template <typename KeyGetter, typename Map, bool has_null_map>
+void NO_INLINE scatterFromBlockImplTypeCase(
+    ASTTableJoin::Kind kind,
+    Map & map,
+    size_t rows,
+    const ColumnRawPtrs & key_columns,
+    const Sizes & key_sizes,
+    const TiDB::TiDBCollators & collators,
+    Block * stored_block,
+    ConstNullMapPtr null_map,
+    Join::RowsNotInsertToMap * rows_not_inserted_to_map,
+    Join::PartitionedBuildBlock & partitioned_block,
+    Arena & pool)
+{
+    KeyGetter key_getter(key_columns, key_sizes, collators);
+    std::vector<std::string> sort_key_containers(key_columns.size());
+    bool with_null_rows = has_null_map && rows_not_inserted_to_map;
+    partitioned_block.segment_rows = scatterRowsBySegment<KeyGetter, Map, has_null_map>(
+        map,
+        key_getter,
+        rows,
+        null_map,
+        with_null_rows,
+        pool,
+        sort_key_containers);
+
+    if (with_null_rows)
+    {
+        bool null_need_materialize = isNullAwareSemiFamily(kind);
+        for (auto index : partitioned_block.segment_rows.back())
+        {
+            /// for right/full out join or null-aware semi join, need to insert into rows_not_inserted_to_map
+            rows_not_inserted_to_map->insertRow(stored_block, index, null_need_materialize, pool);
+        }
+        partitioned_block.segment_rows.pop_back();
+    }
+}
+
+template <ASTTableJoin::Strictness STRICTNESS, typename KeyGetter, typename Map>
+void NO_INLINE insertFromPartitionedBuildBlocksImplType(
+    Map & map,
+    size_t segment_index,
+    const std::vector<std::vector<Join::PartitionedBuildBlock>> & partitioned_build_blocks,
+    const Sizes & key_sizes,
+    const TiDB::TiDBCollators & collators,
+    Arena & pool)
+{
+    /// The segment is only built by the current thread, no need to acquire the segment lock.
+    auto & segment_table = map.getSegmentTable(segment_index);
+    std::vector<std::string> sort_key_containers;
+    for (const auto & stream_blocks : partitioned_build_blocks)
+    {
+        for (const auto & partitioned_block : stream_blocks)
+        {
+            const auto & rows = partitioned_block.segment_rows[segment_index];
+            if (rows.empty())
+                continue;
+            KeyGetter key_getter(partitioned_block.key_columns, key_sizes, collators);
+            sort_key_containers.resize(partitioned_block.key_columns.size());
+            for (auto row : rows)
+                Inserter<STRICTNESS, typename Map::SegmentType::HashTable, KeyGetter>::insert(segment_table, key_getter, partitioned_block.stored_block, row, pool, sort_key_containers);
+        }
+    }
+}
+
 template <ASTTableJoin::Strictness STRICTNESS, typename KeyGetter, typename Map>
 void insertFromBlockImplType(
     ASTTableJoin::Kind kind,
@@ -924,7 +1061,8 @@ void insertFromBlockImplType(
     size_t insert_concurrency,
     Arena & pool,
     bool enable_fine_grained_shuffle,
-    bool enable_join_spill)
+    bool enable_join_spill,
+    Join::PartitionedBuildBlock * partitioned_block)
 {
     if (enable_join_spill)
     {
@@ -943,9 +1081,17 @@ void insertFromBlockImplType(
         else
             insertFromBlockImplTypeCase<STRICTNESS, KeyGetter, Map, false>(kind, map, rows, key_columns, key_sizes, collators, stored_block, null_map, rows_not_inserted_to_map, stream_index, pool);
     }
+    else if (partitioned_block)
+    {
+        /// case 3, partitioned build, only scatter the rows here, no need to acquire any lock
+        if (null_map)
+            scatterFromBlockImplTypeCase<KeyGetter, Map, true>(kind, map, rows, key_columns, key_sizes, collators, stored_block, null_map, rows_not_inserted_to_map, *partitioned_block, pool);
+        else
+            scatterFromBlockImplTypeCase<KeyGetter, Map, false>(kind, map, rows, key_columns, key_sizes, collators, stored_block, null_map, rows_not_inserted_to_map, *partitioned_block, pool);
+    }
     else if (insert_concurrency > 1)
     {
-        /// case 3, normal join with concurrency > 1, will acquire lock in `insertFromBlockImplTypeCaseWithLock`
+        /// case 4, normal join with concurrency > 1, will acquire lock in `insertFromBlockImplTypeCaseWithLock`
         if (null_map)
             insertFromBlockImplTypeCaseWithLock<STRICTNESS, KeyGetter, Map, true>(kind, map, rows, key_columns, key_sizes, collators, stored_block, null_map, rows_not_inserted_to_map, stream_index, pool);
         else
@@ -953,7 +1099,7 @@ void insertFromBlockImplType(
     }
     else
     {
-        /// case 4, normal join with concurrency == 1, no need to acquire any lock
+        /// case 5, normal join with concurrency == 1, no need to acquire any lock
         RUNTIME_CHECK(stream_index == 0);
         if (null_map)
             insertFromBlockImplTypeCase<STRICTNESS, KeyGetter, Map, true>(kind, map, rows, key_columns, key_sizes, collators, stored_block, null_map, rows_not_inserted_to_map, stream_index, pool);
@@ -978,7 +1124,8 @@ void insertFromBlockImpl(
     size_t insert_concurrency,
     Arena & pool,
     bool enable_fine_grained_shuffle,
-    bool enable_join_spill)
+    bool enable_join_spill,
+    Join::PartitionedBuildBlock * partitioned_block)
 {
     switch (type)
     {
@@ -1003,7 +1150,38 @@ void insertFromBlockImpl(
             insert_concurrency,                                                                                                                \
             pool,                                                                                                                              \
             enable_fine_grained_shuffle,                                                                                                       \
-            enable_join_spill);                                                                                                                \
+            enable_join_spill,                                                                                                                 \
+            partitioned_block);                                                                                                                \
+        break;
+        APPLY_FOR_JOIN_VARIANTS(M)
+#undef M
+
+    default:
+        throw Exception("Unknown JOIN keys variant.", ErrorCodes::UNKNOWN_SET_DATA_VARIANT);
+    }
+}
+
+template <ASTTableJoin::Strictness STRICTNESS, typename Maps>
+void insertFromPartitionedBuildBlocksImpl(
+    Join::Type type,
+    Maps & maps,
+    size_t segment_index,
+    const std::vector<std::vector<Join::PartitionedBuildBlock>> & partitioned_build_blocks,
+    const Sizes & key_sizes,
+    const TiDB::TiDBCollators & collators,
+    Arena & pool)
+{
+    switch (type)
+    {
+#define M(TYPE)                                                                                                                                                 \
+    case Join::Type::TYPE:                                                                                                                                      \
+        insertFromPartitionedBuildBlocksImplType<STRICTNESS, typename KeyGetterForType<Join::Type::TYPE, std::remove_reference_t<decltype(*maps.TYPE)>>::Type>( \
+            *maps.TYPE,                                                                                                                                         \
+            segment_index,                                                                                                                                      \
+            partitioned_build_blocks,                                                                                                                           \
+            key_sizes,                                                                                                                                          \
+            collators,                                                                                                                                          \
+            pool);                                                                                                                                              \
         break;
         APPLY_FOR_JOIN_VARIANTS(M)
 #undef M
@@ -1267,31 +1445,52 @@ void Join::insertFromBlockInternal(Block * stored_block, size_t stream_index)
     if (!isCrossJoin(kind))
     {
         assert(partitions[stream_index]->pool != nullptr);
+        PartitionedBuildBlock * partitioned_block = nullptr;
+        if (isPartitionedBuild())
+        {
+            /// The rows are inserted into the map after all the build threads finish, so keep the key columns alive until then.
+            partitioned_block = &partitioned_build_blocks[stream_index].emplace_back();
+            partitioned_block->stored_block = stored_block;
+            partitioned_block->key_columns = key_columns;
+            partitioned_block->materialized_columns = std::move(materialized_columns);
+        }
         /// Fill the hash table.
         if (isNullAwareSemiFamily(kind))
         {
             if (strictness == ASTTableJoin::Strictness::Any)
-                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(kind, type, maps_any, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill);
+                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(kind, type, maps_any, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill, partitioned_block);
             else
-                insertFromBlockImpl<ASTTableJoin::Strictness::All>(kind, type, maps_all, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill);
+                insertFromBlockImpl<ASTTableJoin::Strictness::All>(kind, type, maps_all, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill, partitioned_block);
         }
         else if (getFullness(kind))
         {
             if (strictness == ASTTableJoin::Strictness::Any)
-                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(kind, type, maps_any_full, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill);
+                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(kind, type, maps_any_full, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill, partitioned_block);
             else
-                insertFromBlockImpl<ASTTableJoin::Strictness::All>(kind, type, maps_all_full, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill);
+                insertFromBlockImpl<ASTTableJoin::Strictness::All>(kind, type, maps_all_full, rows, key_columns, key_sizes, collators, stored_block, null_map, &rows_not_inserted_to_map[stream_index], stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill, partitioned_block);
         }
         else
         {
             if (strictness == ASTTableJoin::Strictness::Any)
-                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(kind, type, maps_any, rows, key_columns, key_sizes, collators, stored_block, null_map, nullptr, stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill);
+                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(kind, type, maps_any, rows, key_columns, key_sizes, collators, stored_block, null_map, nullptr, stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill, partitioned_block);
             else
-                insertFromBlockImpl<ASTTableJoin::Strictness::All>(kind, type, maps_all, rows, key_columns, key_sizes, collators, stored_block, null_map, nullptr, stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill);
+                insertFromBlockImpl<ASTTableJoin::Strictness::All>(kind, type, maps_all, rows, key_columns, key_sizes, collators, stored_block, null_map, nullptr, stream_index, getBuildConcurrency(), *partitions[stream_index]->pool, enable_fine_grained_shuffle, enable_join_spill, partitioned_block);
         }
+        if (partitioned_block)
+            partitioned_build_bytes.fetch_add(partitioned_block->allocatedBytes(), std::memory_order_relaxed);
     }
 }
 
+size_t Join::PartitionedBuildBlock::allocatedBytes() const
+{
+    size_t res = key_columns.capacity() * sizeof(const IColumn *) + segment_rows.capacity() * sizeof(std::vector<size_t>);
+    for (const auto & column : materialized_columns)
+        res += column->allocatedBytes();
+    for (const auto & rows : segment_rows)
+        res += rows.capacity() * sizeof(size_t);
+    return res;
+}
+
 
 namespace
 {
@@ -1476,6 +1675,7 @@ void NO_INLINE joinBlockImplTypeCase(
     const std::vector<size_t> & right_indexes,
     const TiDB::TiDBCollators & collators,
     const JoinBuildInfo & join_build_info,
+    const DenseJoinKeyIndex & dense_key_index,
     ProbeProcessInfo & probe_process_info)
 {
     if (rows == 0)
@@ -1488,12 +1688,16 @@ void NO_INLINE joinBlockImplTypeCase(
 
     size_t num_columns_to_add = right_indexes.size();
 
+    constexpr bool is_integer_key = std::is_same_v<typename Map::key_type, UInt32> || std::is_same_v<typename Map::key_type, UInt64>;
+    /// The index has the cells of all the segments, so no hash value or segment index is needed.
+    bool use_dense_key_index = is_integer_key && !dense_key_index.empty();
+
     KeyGetter key_getter(key_columns, key_sizes, collators);
     std::vector<std::string> sort_key_containers;
     sort_key_containers.resize(key_columns.size());
     Arena pool;
     WeakHash32 build_hash(0); /// reproduce hash values according to build stage
-    if (join_build_info.needVirtualDispatchForProbeBlock())
+    if (join_build_info.needVirtualDispatchForProbeBlock() && !use_dense_key_index)
     {
         assert(!(join_build_info.restore_round > 0 && join_build_info.enable_fine_grained_shuffle));
         /// TODO: consider adding a virtual column in Sender side to avoid computing cost and potential inconsistency by heterogeneous envs(AMD64, ARM64)
@@ -1527,48 +1731,62 @@ void NO_INLINE joinBlockImplTypeCase(
             SCOPE_EXIT(keyHolderDiscardKey(key_holder));
             auto key = keyHolderGetKey(key_holder);
 
-            size_t hash_value = 0;
-            bool zero_flag = ZeroTraits::check(key);
-            if (!zero_flag)
-            {
-                hash_value = map.hash(key);
-            }
-
-            size_t segment_index = 0;
-            if (join_build_info.is_spilled)
+            typename Map::SegmentType::HashTable::ConstLookupResult it = nullptr;
+            if constexpr (is_integer_key)
             {
-                segment_index = probe_process_info.partition_index;
+                if (use_dense_key_index)
+                {
+                    /// The keys out of the range of the index do not exist.
+                    UInt64 offset = static_cast<UInt64>(key) - dense_key_index.min_key;
+                    if (offset < dense_key_index.cells.size())
+                        it = static_cast<decltype(it)>(dense_key_index.cells[offset]);
+                }
             }
-            else if (join_build_info.needVirtualDispatchForProbeBlock())
+            if (!use_dense_key_index)
             {
-                /// Need to calculate the correct segment_index so that rows with same key will map to the same segment_index both in Build and Prob
-                /// The "reproduce" of segment_index generated in Build phase relies on the facts that:
-                /// Possible pipelines(FineGrainedShuffleWriter => ExchangeReceiver => HashBuild)
-                /// 1. In FineGrainedShuffleWriter, selector value finally maps to packet_stream_id by '% fine_grained_shuffle_count'
-                /// 2. In ExchangeReceiver, build_stream_id = packet_stream_id % build_stream_count;
-                /// 3. In HashBuild, build_concurrency decides map's segment size, and build_steam_id decides the segment index
-                if (join_build_info.enable_fine_grained_shuffle)
+                size_t hash_value = 0;
+                bool zero_flag = ZeroTraits::check(key);
+                if (!zero_flag)
+                {
+                    hash_value = map.hash(key);
+                }
+
+                size_t segment_index = 0;
+                if (join_build_info.is_spilled)
+                {
+                    segment_index = probe_process_info.partition_index;
+                }
+                else if (join_build_info.needVirtualDispatchForProbeBlock())
                 {
-                    auto packet_stream_id = build_hash_data[i] % join_build_info.fine_grained_shuffle_count;
-                    if likely (join_build_info.fine_grained_shuffle_count == segment_size)
-                        segment_index = packet_stream_id;
+                    /// Need to calculate the correct segment_index so that rows with same key will map to the same segment_index both in Build and Prob
+                    /// The "reproduce" of segment_index generated in Build phase relies on the facts that:
+                    /// Possible pipelines(FineGrainedShuffleWriter => ExchangeReceiver => HashBuild)
+                    /// 1. In FineGrainedShuffleWriter, selector value finally maps to packet_stream_id by '% fine_grained_shuffle_count'
+                    /// 2. In ExchangeReceiver, build_stream_id = packet_stream_id % build_stream_count;
+                    /// 3. In HashBuild, build_concurrency decides map's segment size, and build_steam_id decides the segment index
+                    if (join_build_info.enable_fine_grained_shuffle)
+                    {
+                        auto packet_stream_id = build_hash_data[i] % join_build_info.fine_grained_shuffle_count;
+                        if likely (join_build_info.fine_grained_shuffle_count == segment_size)
+                            segment_index = packet_stream_id;
+                        else
+                            segment_index = packet_stream_id % segment_size;
+                    }
                     else
-                        segment_index = packet_stream_id % segment_size;
+                    {
+                        segment_index = build_hash_data[i] % join_build_info.build_concurrency;
+                    }
                 }
                 else
                 {
-                    segment_index = build_hash_data[i] % join_build_info.build_concurrency;
+                    segment_index = hash_value % segment_size;
                 }
-            }
-            else
-            {
-                segment_index = hash_value % segment_size;
-            }
 
-            auto & internal_map = map.getSegmentTable(segment_index);
-            /// do not require segment lock because in join, the hash table can not be changed in probe stage.
-            auto it = internal_map.find(key, hash_value);
-            if (it != internal_map.end())
+                auto & internal_map = map.getSegmentTable(segment_index);
+                /// do not require segment lock because in join, the hash table can not be changed in probe stage.
+                it = internal_map.find(key, hash_value);
+            }
+            if (it != nullptr)
             {
                 it->getMapped().setUsed();
                 block_full = Adder<KIND, STRICTNESS, Map>::addFound(
@@ -1619,6 +1837,7 @@ void joinBlockImplType(
     const std::vector<size_t> & right_indexes,
     const TiDB::TiDBCollators & collators,
     const JoinBuildInfo & join_build_info,
+    const DenseJoinKeyIndex & dense_key_index,
     ProbeProcessInfo & probe_process_info)
 {
     if (null_map)
@@ -1635,6 +1854,7 @@ void joinBlockImplType(
             right_indexes,
             collators,
             join_build_info,
+            dense_key_index,
             probe_process_info);
     else
         joinBlockImplTypeCase<KIND, STRICTNESS, KeyGetter, Map, false>(
@@ -1650,6 +1870,7 @@ void joinBlockImplType(
             right_indexes,
             collators,
             join_build_info,
+            dense_key_index,
             probe_process_info);
 }
 } // namespace
@@ -1985,6 +2206,7 @@ void Join::joinBlockImpl(Block & block, const Maps & maps, ProbeProcessInfo & pr
             right_indexes,                                                                                                                     \
             collators,                                                                                                                         \
             join_build_info,                                                                                                                   \
+            dense_key_index,                                                                                                                   \
             probe_process_info);                                                                                                               \
         break;
         APPLY_FOR_JOIN_VARIANTS(M)
@@ -2769,6 +2991,16 @@ void Join::workAfterBuildFinish()
             null_key_check_all_blocks_directly = static_cast<double>(null_rows_size) > static_cast<double>(total_input_build_rows) / 3.0;
     }
 
+    if (isPartitionedBuild())
+    {
+        /// The hash map is built by the threads waiting for the build to finish, see `buildPartitionedHashTables`.
+        partitioned_build_watch.restart();
+    }
+    else
+    {
+        buildDenseKeyIndex();
+    }
+
     if (isEnableSpill())
     {
         if (hasPartitionSpilled())
@@ -2779,6 +3011,21 @@ void Join::workAfterBuildFinish()
     }
 }
 
+void Join::buildDenseKeyIndex()
+{
+    /// The index refers to the cells of the hash map, so it can not be used if the hash map may be released by spilling.
+    if (max_dense_key_range == 0 || isEnableSpill() || (type != Type::key32 && type != Type::key64))
+        return;
+
+    Stopwatch watch;
+    buildDenseKeyIndexImpl(maps_any, type, max_dense_key_range, dense_key_index);
+    buildDenseKeyIndexImpl(maps_all, type, max_dense_key_range, dense_key_index);
+    buildDenseKeyIndexImpl(maps_any_full, type, max_dense_key_range, dense_key_index);
+    buildDenseKeyIndexImpl(maps_all_full, type, max_dense_key_range, dense_key_index);
+    if (!dense_key_index.empty())
+        LOG_DEBUG(log, "Build dense key index, min key {}, range {}, cost {} ms", dense_key_index.min_key, dense_key_index.cells.size(), watch.elapsedMilliseconds());
+}
+
 void Join::workAfterProbeFinish()
 {
     if (isEnableSpill())
@@ -2795,7 +3042,7 @@ void Join::workAfterProbeFinish()
     }
 }
 
-void Join::waitUntilAllBuildFinished() const
+void Join::waitUntilAllBuildFinished()
 {
     std::unique_lock lock(build_probe_mutex);
     build_cv.wait(lock, [&]() {
@@ -2803,6 +3050,72 @@ void Join::waitUntilAllBuildFinished() const
     });
     if (meet_error)
         throw Exception(error_message);
+    if (isPartitionedBuild() && !is_canceled && built_partition_count < build_concurrency)
+    {
+        lock.unlock();
+        buildPartitionedHashTables();
+        lock.lock();
+        /// Only wait for the segments being built by other threads, so it won't hang even if some probe threads never come here.
+        build_cv.wait(lock, [&]() {
+            return built_partition_count == build_concurrency || meet_error || is_canceled;
+        });
+        if (meet_error)
+            throw Exception(error_message);
+    }
+}
+
+bool Join::isPartitionedBuild() const
+{
+    return enable_partitioned_build && build_concurrency > 1 && !isEnableSpill() && !enable_fine_grained_shuffle
+        && !isCrossJoin(kind) && type != Type::EMPTY && type != Type::CROSS;
+}
+
+void Join::buildPartitionedHashTables()
+{
+    while (true)
+    {
+        size_t partition_index = next_partition_to_build.fetch_add(1);
+        if (partition_index >= build_concurrency)
+            return;
+        insertFromPartitionedBuildBlocks(partition_index);
+
+        std::unique_lock lock(build_probe_mutex);
+        ++built_partition_count;
+        if (built_partition_count == build_concurrency)
+        {
+            LOG_DEBUG(
+                log,
+                "Finish building {} partitions of the hash table with {} entries, cost {} ms",
+                build_concurrency,
+                getTotalRowCount(),
+                partitioned_build_watch.elapsedMilliseconds());
+            /// The materialized key columns are not needed any more.
+            partitioned_build_blocks.clear();
+            partitioned_build_bytes.store(0, std::memory_order_relaxed);
+            buildDenseKeyIndex();
+            build_cv.notify_all();
+        }
+    }
+}
+
+void Join::insertFromPartitionedBuildBlocks(size_t partition_index)
+{
+    FAIL_POINT_TRIGGER_EXCEPTION(FailPoints::random_join_build_failpoint);
+    auto & pool = *partitions[partition_index]->pool;
+    if (isNullAwareSemiFamily(kind) || !getFullness(kind))
+    {
+        if (strictness == ASTTableJoin::Strictness::Any)
+            insertFromPartitionedBuildBlocksImpl<ASTTableJoin::Strictness::Any>(type, maps_any, partition_index, partitioned_build_blocks, key_sizes, collators, pool);
+        else
+            insertFromPartitionedBuildBlocksImpl<ASTTableJoin::Strictness::All>(type, maps_all, partition_index, partitioned_build_blocks, key_sizes, collators, pool);
+    }
+    else
+    {
+        if (strictness == ASTTableJoin::Strictness::Any)
+            insertFromPartitionedBuildBlocksImpl<ASTTableJoin::Strictness::Any>(type, maps_any_full, partition_index, partitioned_build_blocks, key_sizes, collators, pool);
+        else
+            insertFromPartitionedBuildBlocksImpl<ASTTableJoin::Strictness::All>(type, maps_all_full, partition_index, partitioned_build_blocks, key_sizes, collators, pool);
+    }
 }
 
 void Join::finishOneProbe()
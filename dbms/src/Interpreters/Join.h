@@ -20,6 +20,7 @@
 #include <Common/Arena.h>
 #include <Common/HashTable/HashMap.h>
 #include <Common/Logger.h>
+#include <Common/Stopwatch.h>
 #include <Core/Spiller.h>
 #include <DataStreams/IBlockInputStream.h>
 #include <Flash/Coprocessor/JoinInterpreterHelper.h>
@@ -92,6 +93,19 @@ struct RestoreInfo;
 using JoinPtr = std::shared_ptr<Join>;
 using Joins = std::vector<JoinPtr>;
 
+/// The direct-addressed index of the join hash map with a single 32/64 bits integer key.
+/// It is built after the build side is finished if the keys fall into a small range, so that the probe side finds the
+/// cell of a key by `cells[key - min_key]` instead of hashing it and walking the collision chain.
+struct DenseJoinKeyIndex
+{
+    /// The key is in the unsigned representation of the same width.
+    UInt64 min_key = 0;
+    /// The cells of the hash map indexed by `key - min_key`, nullptr if the key does not exist.
+    std::vector<const void *> cells;
+
+    bool empty() const { return cells.empty(); }
+};
+
 class Join
 {
 public:
@@ -187,6 +201,14 @@ public:
         std::unique_lock lock(build_probe_mutex);
         return probe_concurrency;
     }
+    /// Probe by a direct-addressed index if the keys of the build side fall into a range of at most this number of values.
+    /// 0 means never. Only used by the join with a single 32/64 bits integer key and without spill.
+    void setMaxDenseKeyRange(size_t max_dense_key_range_) { max_dense_key_range = max_dense_key_range_; }
+    /// Build the hash table in two phases if there are multiple build threads and neither spill nor fine grained shuffle is used:
+    /// each build thread only scatters its rows by the segment of the hash map, then every segment is built by a single thread
+    /// without lock. See `buildPartitionedHashTables`.
+    void setPartitionedBuild(bool enable_partitioned_build_) { enable_partitioned_build = enable_partitioned_build_; }
+
     void setProbeConcurrency(size_t concurrency)
     {
         std::unique_lock lock(build_probe_mutex);
@@ -203,7 +225,7 @@ public:
     }
 
     void finishOneBuild();
-    void waitUntilAllBuildFinished() const;
+    void waitUntilAllBuildFinished();
 
     void finishOneProbe();
     void waitUntilAllProbeFinished() const;
@@ -401,6 +423,19 @@ public:
         void insertRow(Block * stored_block, size_t index, bool need_materialize, Arena & pool);
     };
 
+    /// A build block whose rows are scattered by the segment of the hash map but not inserted yet.
+    struct PartitionedBuildBlock
+    {
+        Block * stored_block = nullptr;
+        ColumnRawPtrs key_columns;
+        /// Hold the materialized key columns referred by `key_columns`.
+        Columns materialized_columns;
+        /// Rows of each segment.
+        std::vector<std::vector<size_t>> segment_rows;
+
+        size_t allocatedBytes() const;
+    };
+
 private:
     friend class NonJoinedBlockInputStream;
 
@@ -466,6 +501,21 @@ private:
     MapsAnyFull maps_any_full; /// For ANY RIGHT|FULL JOIN
     MapsAllFull maps_all_full; /// For ALL RIGHT|FULL JOIN
 
+    size_t max_dense_key_range = 0;
+    /// Built by `buildDenseKeyIndex` after the build side is finished, empty if the keys are not dense.
+    DenseJoinKeyIndex dense_key_index;
+
+    bool enable_partitioned_build = false;
+    /// Blocks scattered by each build thread, only used if `isPartitionedBuild()`.
+    std::vector<std::vector<PartitionedBuildBlock>> partitioned_build_blocks;
+    /// The next segment to be built, segments are claimed by the threads waiting for the build to finish.
+    std::atomic<size_t> next_partition_to_build{0};
+    /// Number of the built segments, protected by `build_probe_mutex`.
+    size_t built_partition_count = 0;
+    /// The bytes of `partitioned_build_blocks` besides the stored blocks, counted in `getTotalByteCount`.
+    std::atomic<size_t> partitioned_build_bytes{0};
+    Stopwatch partitioned_build_watch;
+
     /// For right/full join, including
     /// 1. Rows with NULL join keys
     /// 2. Rows that are filtered by right join conditions
@@ -568,6 +618,12 @@ private:
 
     void workAfterBuildFinish();
     void workAfterProbeFinish();
+    void buildDenseKeyIndex();
+
+    bool isPartitionedBuild() const;
+    /// Build the segments of the hash map from `partitioned_build_blocks` until no segment is left to claim.
+    void buildPartitionedHashTables();
+    void insertFromPartitionedBuildBlocks(size_t partition_index);
 
     template <ASTTableJoin::Kind KIND, ASTTableJoin::Strictness STRICTNESS, typename Maps>
     void joinBlockImplNullAware(Block & block, const Maps & maps) const;
@@ -232,6 +232,13 @@ struct Settings
     M(SettingDouble, dt_page_gc_threshold, 0.5, "Max valid rate of deciding to do a GC in PageStorage")                                                                                                                                 \
     M(SettingBool, dt_enable_read_thread, true, "Enable storage read thread or not")                                                                                                                                                    \
     M(SettingBool, dt_enable_bitmap_filter, true, "Use bitmap filter to read data or not")                                                                                                                                              \
+    M(SettingBool, dt_enable_read_limit_pushdown, true, "Stop reading from storage once enough rows are read for the LIMIT/TopN above the table scan without any filter")                                                               \
+    M(SettingUInt64, dt_max_read_limit_in_handle_order, 65536, "Read segments one by one in the order of handle for a TopN ordered by the int handle if its limit does not exceed this value")                                          \
+    M(SettingBool, dt_enable_topn_threshold, true, "Filter the rows before sorting and skip the packs in table scan by the current k-th value of the TopN ordered by a single column")                                                  \
+    M(SettingUInt64, dt_read_ahead_packs, 4, "The number of packs to read ahead in background when reading a DTFile. 0 means disable read ahead")                                                                                       \
+    M(SettingUInt64, dt_max_read_ahead_bytes, 16 * 1024 * 1024, "The maximum bytes of the packs that are read ahead but not read yet for each DTFile reader")                                                                           \
+    M(SettingUInt64, dt_raft_write_combine_max_rows, 65536, "Combine the raft data written into a table by different regions at the same time into one write of at most this rows. 0 means disable combining")                          \
+    M(SettingUInt64, dt_raft_write_combine_wait_us, 0, "The time in microseconds to wait for more raft data before writing the combined data into a table")                                                                             \
     M(SettingDouble, dt_read_thread_count_scale, 1.0, "Number of read thread = number of logical cpu cores * dt_read_thread_count_scale.  Only has meaning at server startup.")                                                         \
     M(SettingDouble, dt_filecache_max_downloading_count_scale, 1.0, "Max downloading task count of FileCache = io thread count * dt_filecache_max_downloading_count_scale.")                                                            \
     M(SettingUInt64, dt_filecache_min_age_seconds, 1800, "Files of the same priority can only be evicted from files that were not accessed within `dt_filecache_min_age_seconds` seconds.")                                             \
@@ -247,7 +254,10 @@ struct Settings
     M(SettingInt64, remote_gc_interval_seconds, 3600, "The interval of running GC task on the remote store. Unit is second.")                                                                                                           \
     M(SettingDouble, remote_gc_ratio, 0.5, "The files with valid rate less than this threshold will be compacted")                                                                                                                      \
     M(SettingInt64, remote_gc_small_size, 128 * 1024, "The files with total size less than this threshold will be compacted")                                                                                                           \
+    M(SettingCompressionMethod, remote_checkpoint_compression_method, CompressionMethod::NONE, "The method of compressing the page data in the checkpoint data files. Only enable it after all nodes are upgraded.")                    \
     M(SettingDouble, disagg_read_concurrency_scale, 20.0, "Scale * logical cpu cores = disaggregated read IO concurrency.")                                                                                                             \
+    M(SettingUInt64, disagg_fetch_pages_packet_limit_size, 512 * 1024, "The max size of the page data packed into one packet when the write node sends pages to the compute node.")                                                     \
+    M(SettingCompressionMethod, disagg_fetch_pages_compression_method, CompressionMethod::NONE, "The method of compressing the pages sent to the compute node. Only enable it after all compute nodes are upgraded.")                   \
     \
     M(SettingInt64, fap_wait_checkpoint_timeout_seconds, 60, "The max time wait for a usable checkpoint for FAP. Unit is second.")                                                                                                      \
     \
@@ -280,6 +290,8 @@ struct Settings
     M(SettingUInt64, task_scheduler_thread_soft_limit, 5000, "The soft limit of threads for min_tso task scheduler.")                                                                                                                   \
     M(SettingUInt64, task_scheduler_thread_hard_limit, 10000, "The hard limit of threads for min_tso task scheduler.")                                                                                                                  \
     M(SettingUInt64, task_scheduler_active_set_soft_limit, 0, "The soft limit of count of active query set for min_tso task scheduler.")                                                                                                \
+    M(SettingUInt64, task_scheduler_memory_limit, 0, "The limit of estimated memory usage of running tasks for min_tso task scheduler. 0 means the memory usage is not limited.")                                                       \
+    M(SettingUInt64, task_scheduler_estimated_memory_per_operator, 128 * 1024 * 1024, "The estimated memory of each join/aggregation/sort if neither its spill threshold nor max_memory_usage is set, for min_tso scheduler.")          \
     M(SettingUInt64, max_grpc_pollers, 200, "The maximum number of grpc thread pool's non-temporary threads, better tune it up to avoid frequent creation/destruction of threads.")                                                     \
     M(SettingBool, enable_elastic_threadpool, true, "Enable elastic thread pool for thread create usages.")                                                                                                                             \
     M(SettingUInt64, elastic_threadpool_init_cap, 400, "The size of elastic thread pool.")                                                                                                                                              \
@@ -301,8 +313,17 @@ struct Settings
     M(SettingUInt64, max_spilled_bytes_per_file, 0, "Max spilled data bytes per spill file, 0 as the default value, 0 means no limit.")                                                                                                 \
     M(SettingBool, enable_planner, true, "Enable planner")                                                                                                                                                                              \
     M(SettingBool, enable_pipeline, false, "Enable pipeline model")                                                                                                                                                                     \
+    M(SettingBool, enable_async_learner_read, true, "Do the learner read of table scans without blocking the task threads in the pipeline model")                                                                                       \
+    M(SettingBool, enable_short_circuit_evaluation, true, "Evaluate the non-first arguments of and/or/if/multiIf/ifNull only on the rows not decided by the previous ones")                                                             \
     M(SettingUInt64, pipeline_task_thread_pool_size, 0, "The size of task thread pool. 0 means using number_of_logical_cpu_cores.")                                                                                                     \
-    M(SettingUInt64, local_tunnel_version, 1, "1: not refined, 2: refined")
+    M(SettingString, pipeline_trace_path, "", "The directory to dump the Chrome trace of each query executed by the pipeline model. Empty means disabled.")                                                                             \
+    M(SettingUInt64, local_tunnel_version, 1, "1: not refined, 2: refined")                                                                                                                                                             \
+    M(SettingFloat, min_selectivity_to_defer_filter, 0.5, "Hand the filter of a selection to the aggregation instead of filtering every column when at least this ratio of rows is selected. Values larger than 1 disable it.")         \
+    M(SettingUInt64, agg_bypass_check_rows, 65536, "The partial aggregation in MPP checks its reduction ratio after aggregating this number of rows in each thread. 0 means the partial aggregation is never bypassed.")                \
+    M(SettingFloat, agg_bypass_groups_ratio, 0.9, "The partial aggregation in MPP passes the following rows through without aggregating them if the number of groups / the number of input rows reaches this ratio.")                   \
+    M(SettingUInt64, max_dense_group_by_key_range, 65536, "Group by a direct-addressed table while the values of a single integer key fall into a range of this size, at most 65536. 0 means disabled.")                                \
+    M(SettingUInt64, max_dense_join_key_range, 1048576, "Probe the join by a direct-addressed table if the values of a single integer join key fall into a range of this size. 0 means disabled.")                                      \
+    M(SettingBool, join_partitioned_build, true, "Scatter the build rows of join by partition in each build thread, then build each partition of the hash table by one thread without lock.")
 // clang-format on
 #define DECLARE(TYPE, NAME, DEFAULT, DESCRIPTION) TYPE NAME{DEFAULT};
 
@@ -0,0 +1,195 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DataStreams/AggregatingBlockInputStream.h>
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataStreams/ParallelAggregatingBlockInputStream.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Interpreters/Aggregator.h>
+#include <Operators/AggregateContext.h>
+#include <TestUtils/AggregationTestUtils.h>
+#include <TestUtils/FunctionTestUtils.h>
+
+namespace DB
+{
+namespace tests
+{
+class AggregatorBypassTest : public AggregationTest
+{
+protected:
+    // select key, count(), sum(value) group by key
+    static Aggregator::Params buildParams(size_t bypass_check_rows, double bypass_groups_ratio)
+    {
+        Block header{toVec<Int64>("key", {}), toVec<Int64>("value", {})};
+
+        AggregateDescriptions aggregates(2);
+        aggregates[0].function = AggregateFunctionFactory::instance().get("count", {});
+        aggregates[0].column_name = "count";
+        aggregates[1].function = AggregateFunctionFactory::instance().get("sum", {std::make_shared<DataTypeInt64>()});
+        aggregates[1].arguments = {1};
+        aggregates[1].column_name = "sum";
+
+        SpillConfig spill_config(TiFlashTestEnv::getTemporaryPath("AggregatorBypassTest"), "test", 0, 0, 0, nullptr);
+        Aggregator::Params params(header, {0}, aggregates, 0, 0, 0, false, spill_config, 8192);
+        params.bypass_check_rows = bypass_check_rows;
+        params.bypass_groups_ratio = bypass_groups_ratio;
+        params.bypass_rows = std::make_shared<std::atomic<size_t>>(0);
+        return params;
+    }
+
+    static Block readAll(const Aggregator::Params & params, BlocksList && blocks)
+    {
+        auto input = std::make_shared<BlocksListBlockInputStream>(std::move(blocks));
+        AggregatingBlockInputStream stream(input, params, true, "AggregatorBypassTest");
+        Blocks res;
+        stream.readPrefix();
+        while (Block block = stream.read())
+            res.push_back(std::move(block));
+        stream.readSuffix();
+        return vstackBlocks(std::move(res));
+    }
+
+    static BlocksList makeBlocks(const std::vector<Int64> & keys)
+    {
+        BlocksList blocks;
+        for (auto key : keys)
+            blocks.push_back(Block{toVec<Int64>("key", {key}), toVec<Int64>("value", {key * 10})});
+        return blocks;
+    }
+
+    static void assertAggregated(const Block & res, size_t expect_rows, UInt64 expect_count, Int64 expect_sum)
+    {
+        ASSERT_EQ(res.rows(), expect_rows);
+        UInt64 count = 0;
+        Int64 sum = 0;
+        for (size_t i = 0; i < res.rows(); ++i)
+        {
+            count += res.getByName("count").column->getUInt(i);
+            sum += res.getByName("sum").column->getInt(i);
+        }
+        ASSERT_EQ(count, expect_count);
+        ASSERT_EQ(sum, expect_sum);
+    }
+};
+
+TEST_F(AggregatorBypassTest, ConvertToBypassBlock)
+try
+{
+    auto params = buildParams(1, 0.5);
+    Aggregator aggregator(params, "AggregatorBypassTest");
+
+    Block block{toVec<Int64>("key", {1, 2, 1, 3}), toVec<Int64>("value", {10, 20, 30, 40})};
+    auto res = aggregator.convertToBypassBlock(block);
+    ASSERT_COLUMN_EQ(toVec<Int64>({1, 2, 1, 3}), res.getByName("key"));
+    ASSERT_COLUMN_EQ(toVec<UInt64>({1, 1, 1, 1}), res.getByName("count"));
+    ASSERT_COLUMN_EQ(toVec<Int64>({10, 20, 30, 40}), res.getByName("sum"));
+    ASSERT_EQ(params.bypass_rows->load(), 4);
+
+    // Only the selected rows are converted.
+    IColumn::Filter filter{0, 1, 1, 0};
+    res = aggregator.convertToBypassBlock(block, &filter);
+    ASSERT_COLUMN_EQ(toVec<Int64>({2, 1}), res.getByName("key"));
+    ASSERT_COLUMN_EQ(toVec<UInt64>({1, 1}), res.getByName("count"));
+    ASSERT_COLUMN_EQ(toVec<Int64>({20, 30}), res.getByName("sum"));
+    ASSERT_EQ(params.bypass_rows->load(), 6);
+}
+CATCH
+
+TEST_F(AggregatorBypassTest, AggregatingStream)
+try
+{
+    auto make_blocks = [](const std::vector<Int64> & keys) {
+        BlocksList blocks;
+        for (auto key : keys)
+            blocks.push_back(Block{toVec<Int64>("key", {key}), toVec<Int64>("value", {key * 10})});
+        return blocks;
+    };
+
+    {
+        // All keys are unique, the aggregation is bypassed after aggregating 2 rows.
+        auto params = buildParams(2, 0.9);
+        auto res = readAll(params, make_blocks({1, 2, 3, 4, 5}));
+        ASSERT_EQ(res.rows(), 5);
+        ASSERT_EQ(params.bypass_rows->load(), 3);
+        Int64 sum = 0;
+        for (size_t i = 0; i < res.rows(); ++i)
+            sum += res.getByName("sum").column->getInt(i);
+        ASSERT_EQ(sum, 150);
+    }
+    {
+        // The rows are reduced effectively, never bypassed.
+        auto params = buildParams(2, 0.9);
+        auto res = readAll(params, make_blocks({1, 1, 1, 2, 2}));
+        ASSERT_EQ(res.rows(), 2);
+        ASSERT_EQ(params.bypass_rows->load(), 0);
+    }
+    {
+        // Bypass is disabled.
+        auto params = buildParams(0, 0.9);
+        auto res = readAll(params, make_blocks({1, 2, 3, 4, 5}));
+        ASSERT_EQ(res.rows(), 5);
+        ASSERT_EQ(params.bypass_rows->load(), 0);
+    }
+}
+CATCH
+
+TEST_F(AggregatorBypassTest, ParallelAggregatingStream)
+try
+{
+    // The parallel aggregation can not output rows before all the threads finish, it never bypasses
+    // to not hold the bypassed rows in memory.
+    auto params = buildParams(2, 0.9);
+    BlockInputStreams inputs{
+        std::make_shared<BlocksListBlockInputStream>(makeBlocks({1, 2, 3, 4})),
+        std::make_shared<BlocksListBlockInputStream>(makeBlocks({1, 2, 3, 4}))};
+    ParallelAggregatingBlockInputStream stream(inputs, {}, params, true, 2, 2, "AggregatorBypassTest");
+    Blocks res;
+    stream.readPrefix();
+    while (Block block = stream.read())
+        res.push_back(std::move(block));
+    stream.readSuffix();
+    assertAggregated(vstackBlocks(std::move(res)), 4, 8, 200);
+    ASSERT_EQ(params.bypass_rows->load(), 0);
+}
+CATCH
+
+TEST_F(AggregatorBypassTest, AggregateContext)
+try
+{
+    // The same as the parallel aggregation, the pipeline aggregation never bypasses.
+    auto params = buildParams(2, 0.9);
+    AggregateContext context("AggregatorBypassTest");
+    context.initBuild(params, 2);
+    for (size_t task_index = 0; task_index < 2; ++task_index)
+    {
+        for (const auto & block : makeBlocks({1, 2, 3, 4}))
+            context.buildOnBlock(task_index, block);
+    }
+    context.initConvergent();
+    ASSERT_TRUE(context.tryConvertToTwoLevel());
+    ASSERT_FALSE(context.useNullSource());
+
+    Blocks res;
+    for (size_t i = 0; i < context.getConvergentConcurrency(); ++i)
+    {
+        while (Block block = context.readForConvergent(i))
+            res.push_back(std::move(block));
+    }
+    assertAggregated(vstackBlocks(std::move(res)), 4, 8, 200);
+    ASSERT_EQ(params.bypass_rows->load(), 0);
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -0,0 +1,158 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Interpreters/Aggregator.h>
+#include <TestUtils/AggregationTestUtils.h>
+#include <TestUtils/FunctionTestUtils.h>
+
+#include <map>
+
+namespace DB
+{
+namespace tests
+{
+class AggregatorDenseKeyTest : public AggregationTest
+{
+protected:
+    // select key, sum(value) group by key
+    static Aggregator::Params buildParams(size_t max_dense_key_range)
+    {
+        Block header{toVec<Int64>("key", {}), toVec<Int64>("value", {})};
+
+        AggregateDescriptions aggregates(1);
+        aggregates[0].function = AggregateFunctionFactory::instance().get("sum", {std::make_shared<DataTypeInt64>()});
+        aggregates[0].arguments = {1};
+        aggregates[0].column_name = "sum";
+
+        SpillConfig spill_config(TiFlashTestEnv::getTemporaryPath("AggregatorDenseKeyTest"), "test", 0, 0, 0, nullptr);
+        Aggregator::Params params(header, {0}, aggregates, 0, 0, 0, false, spill_config, 8192);
+        params.max_dense_key_range = max_dense_key_range;
+        return params;
+    }
+
+    static BlockInputStreamPtr makeStream(const std::vector<std::vector<Int64>> & blocks_keys)
+    {
+        BlocksList blocks;
+        for (const auto & keys : blocks_keys)
+        {
+            std::vector<Int64> values;
+            for (auto key : keys)
+                values.push_back(key * 10);
+            blocks.push_back(Block{toVec<Int64>("key", keys), toVec<Int64>("value", values)});
+        }
+        return std::make_shared<BlocksListBlockInputStream>(std::move(blocks));
+    }
+
+    // Merge the data variants and return the sum of each key.
+    static std::map<Int64, Int64> mergeAll(const Aggregator & aggregator, ManyAggregatedDataVariants & data_variants)
+    {
+        std::map<Int64, Int64> res;
+        auto merging_buckets = aggregator.mergeAndConvertToBlocks(data_variants, true, 1);
+        while (Block block = merging_buckets->getData(0))
+        {
+            const auto & keys = block.getByName("key").column;
+            const auto & sums = block.getByName("sum").column;
+            for (size_t i = 0; i < block.rows(); ++i)
+                res[keys->getInt(i)] += sums->getInt(i);
+        }
+        return res;
+    }
+};
+
+TEST_F(AggregatorDenseKeyTest, DenseKeys)
+try
+{
+    auto params = buildParams(1024);
+    Aggregator aggregator(params, "AggregatorDenseKeyTest");
+
+    auto data = std::make_shared<AggregatedDataVariants>();
+    aggregator.execute(makeStream({{100, 101, 100}, {102, 0x10064, 101}}), *data);
+    // 0x10064 has the same low 16 bits as 100, but out of the range.
+    ASSERT_EQ(data->type, AggregatedDataVariants::Type::key64);
+
+    data = std::make_shared<AggregatedDataVariants>();
+    aggregator.execute(makeStream({{100, 101, 100}, {102, 1000, 101}}), *data);
+    ASSERT_EQ(data->type, AggregatedDataVariants::Type::key64_dense);
+    ManyAggregatedDataVariants data_variants{data};
+    auto res = mergeAll(aggregator, data_variants);
+    std::map<Int64, Int64> expect{{100, 2000}, {101, 2020}, {102, 1020}, {1000, 10000}};
+    ASSERT_EQ(res, expect);
+}
+CATCH
+
+TEST_F(AggregatorDenseKeyTest, NotDenseKeys)
+try
+{
+    {
+        // Disabled.
+        auto params = buildParams(0);
+        Aggregator aggregator(params, "AggregatorDenseKeyTest");
+        AggregatedDataVariants data;
+        aggregator.execute(makeStream({{1, 2, 3}}), data);
+        ASSERT_EQ(data.type, AggregatedDataVariants::Type::key64);
+    }
+    {
+        // The negative keys are far from the positive keys in the unsigned representation.
+        auto params = buildParams(1024);
+        Aggregator aggregator(params, "AggregatorDenseKeyTest");
+        auto data = std::make_shared<AggregatedDataVariants>();
+        aggregator.execute(makeStream({{-1, -2}, {0, 1}}), *data);
+        ASSERT_EQ(data->type, AggregatedDataVariants::Type::key64);
+        ManyAggregatedDataVariants data_variants{data};
+        auto res = mergeAll(aggregator, data_variants);
+        std::map<Int64, Int64> expect{{-2, -20}, {-1, -10}, {0, 0}, {1, 10}};
+        ASSERT_EQ(res, expect);
+    }
+}
+CATCH
+
+TEST_F(AggregatorDenseKeyTest, Merge)
+try
+{
+    auto params = buildParams(1024);
+    Aggregator aggregator(params, "AggregatorDenseKeyTest");
+
+    {
+        // The union of the ranges is still dense.
+        ManyAggregatedDataVariants data_variants;
+        for (const auto & keys : std::vector<std::vector<Int64>>{{1, 2, 3}, {500, 3}, {1000}})
+        {
+            data_variants.push_back(std::make_shared<AggregatedDataVariants>());
+            aggregator.execute(makeStream({keys}), *data_variants.back());
+            ASSERT_EQ(data_variants.back()->type, AggregatedDataVariants::Type::key64_dense);
+        }
+        auto res = mergeAll(aggregator, data_variants);
+        std::map<Int64, Int64> expect{{1, 10}, {2, 20}, {3, 60}, {500, 5000}, {1000, 10000}};
+        ASSERT_EQ(res, expect);
+    }
+    {
+        // The union of the ranges is too large, or some data is not dense.
+        ManyAggregatedDataVariants data_variants;
+        for (const auto & keys : std::vector<std::vector<Int64>>{{1, 2, 3}, {2000, 3}, {1, 5000}})
+        {
+            data_variants.push_back(std::make_shared<AggregatedDataVariants>());
+            aggregator.execute(makeStream({keys}), *data_variants.back());
+        }
+        ASSERT_EQ(data_variants.back()->type, AggregatedDataVariants::Type::key64);
+        auto res = mergeAll(aggregator, data_variants);
+        std::map<Int64, Int64> expect{{1, 20}, {2, 20}, {3, 60}, {2000, 20000}, {5000, 50000}};
+        ASSERT_EQ(res, expect);
+    }
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -22,6 +22,7 @@ void AggregateContext::initBuild(const Aggregator::Params & params, size_t max_t
     max_threads = max_threads_;
     empty_result_for_aggregation_by_empty_set = params.empty_result_for_aggregation_by_empty_set;
     keys_size = params.keys_size;
+    group_by_two_level_threshold = params.getGroupByTwoLevelThreshold();
     many_data.reserve(max_threads);
     threads_data.reserve(max_threads);
     for (size_t i = 0; i < max_threads; ++i)
@@ -81,34 +82,93 @@ void AggregateContext::initConvergent()
 
     initConvergentPrefix();
 
-    merging_buckets = aggregator->mergeAndConvertToBlocks(many_data, true, max_threads);
+    if (needConvertToTwoLevel())
+    {
+        for (const auto & data : many_data)
+        {
+            if (!data->empty() && !data->isTwoLevel())
+                data_to_convert.push_back(data);
+        }
+        LOG_DEBUG(log, "Convert {} single-level aggregated data to two-level to merge them in parallel", data_to_convert.size());
+    }
+    else
+    {
+        merging_buckets = aggregator->mergeAndConvertToBlocks(many_data, true, max_threads);
+        RUNTIME_CHECK(!merging_buckets || merging_buckets->getConcurrency() > 0);
+    }
     inited_convergent = true;
-    RUNTIME_CHECK(!merging_buckets || merging_buckets->getConcurrency() > 0);
+}
+
+bool AggregateContext::needConvertToTwoLevel() const
+{
+    if (max_threads <= 1 || group_by_two_level_threshold == 0)
+        return false;
+
+    size_t non_empty_count = 0;
+    size_t total_size = 0;
+    for (const auto & data : many_data)
+    {
+        if (data->empty())
+            continue;
+        /// The data are merged bucket-wise anyway if any of them is two-level. The dense variants are cheap to merge directly.
+        if (data->isTwoLevel() || data->isDense() || !data->isConvertibleToTwoLevel())
+            return false;
+        ++non_empty_count;
+        total_size += data->size();
+    }
+    return non_empty_count > 1 && total_size >= group_by_two_level_threshold;
 }
 
 size_t AggregateContext::getConvergentConcurrency()
 {
     RUNTIME_CHECK(inited_convergent);
 
-    return isTwoLevel() ? merging_buckets->getConcurrency() : 1;
+    /// The converted data are two-level, which are merged by `max_threads` concurrency.
+    if (!data_to_convert.empty())
+        return max_threads;
+    return merging_buckets ? merging_buckets->getConcurrency() : 1;
 }
 
-Block AggregateContext::getHeader() const
+bool AggregateContext::tryConvertToTwoLevel()
 {
-    RUNTIME_CHECK(inited_build);
-    return aggregator->getHeader(true);
+    RUNTIME_CHECK(inited_convergent);
+    if (data_to_convert.empty())
+        return true;
+
+    while (true)
+    {
+        size_t index = next_data_to_convert.fetch_add(1);
+        if (index >= data_to_convert.size())
+            break;
+        data_to_convert[index]->convertToTwoLevel();
+        converted_data_count.fetch_add(1);
+    }
+    if (converted_data_count.load() < data_to_convert.size())
+        return false;
+
+    std::call_once(merge_once_flag, [&]() {
+        merging_buckets = aggregator->mergeAndConvertToBlocks(many_data, true, max_threads);
+        RUNTIME_CHECK(merging_buckets && merging_buckets->getConcurrency() == max_threads);
+    });
+    return true;
 }
 
-bool AggregateContext::isTwoLevel()
+bool AggregateContext::isAllConvertedToTwoLevel() const
+{
+    RUNTIME_CHECK(inited_convergent);
+    return converted_data_count.load() >= data_to_convert.size();
+}
+
+Block AggregateContext::getHeader() const
 {
     RUNTIME_CHECK(inited_build);
-    return many_data[0]->isTwoLevel();
+    return aggregator->getHeader(true);
 }
 
 bool AggregateContext::useNullSource()
 {
     RUNTIME_CHECK(inited_convergent);
-    return !merging_buckets;
+    return !merging_buckets && data_to_convert.empty();
 }
 
 Block AggregateContext::readForConvergent(size_t index)
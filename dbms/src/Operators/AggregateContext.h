@@ -18,6 +18,8 @@
 #include <Interpreters/Aggregator.h>
 #include <Operators/Operator.h>
 
+#include <mutex>
+
 namespace DB
 {
 struct ThreadData
@@ -56,6 +58,13 @@ public:
 
     size_t getConvergentConcurrency();
 
+    /// Convert the single-level data to two-level by the convergent tasks together if `initConvergent` decides to merge them bucket-wise.
+    /// Return false if some data are still being converted by other tasks, and the caller should wait.
+    bool tryConvertToTwoLevel();
+
+    /// Only check whether all the data are converted, used by the waiting tasks.
+    bool isAllConvertedToTwoLevel() const;
+
     Block readForConvergent(size_t index);
 
     Block getHeader() const;
@@ -63,7 +72,8 @@ public:
     bool useNullSource();
 
 private:
-    bool isTwoLevel();
+    /// Whether to convert the single-level data to two-level before merge, so they can be merged bucket-wise in parallel.
+    bool needConvertToTwoLevel() const;
 
 private:
     std::unique_ptr<Aggregator> aggregator;
@@ -73,6 +83,14 @@ private:
     std::atomic_bool inited_build = false;
     std::atomic_bool inited_convergent = false;
 
+    size_t group_by_two_level_threshold = 0;
+
+    /// The single-level data to be converted by `tryConvertToTwoLevel`, `merging_buckets` is created after all of them are converted.
+    ManyAggregatedDataVariants data_to_convert;
+    std::atomic<size_t> next_data_to_convert = 0;
+    std::atomic<size_t> converted_data_count = 0;
+    std::once_flag merge_once_flag;
+
     MergingBucketsPtr merging_buckets;
     ManyAggregatedDataVariants many_data;
     std::vector<ThreadData> threads_data;
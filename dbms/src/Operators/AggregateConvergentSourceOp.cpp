@@ -17,11 +17,18 @@ namespace DB
 {
 OperatorStatus AggregateConvergentSourceOp::readImpl(Block & block)
 {
+    if (!agg_context->tryConvertToTwoLevel())
+        return OperatorStatus::WAITING;
     block = agg_context->readForConvergent(index);
     total_rows += block.rows();
     return OperatorStatus::HAS_OUTPUT;
 }
 
+OperatorStatus AggregateConvergentSourceOp::awaitImpl()
+{
+    return agg_context->isAllConvertedToTwoLevel() ? OperatorStatus::HAS_OUTPUT : OperatorStatus::WAITING;
+}
+
 void AggregateConvergentSourceOp::operateSuffix()
 {
     LOG_INFO(log, "finish read {} rows from aggregate context", total_rows);
@@ -44,6 +44,8 @@ public:
 protected:
     OperatorStatus readImpl(Block & block) override;
 
+    OperatorStatus awaitImpl() override;
+
 private:
     AggregateContextPtr agg_context;
     uint64_t total_rows{};
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/FailPoint.h>
+#include <Common/Stopwatch.h>
 #include <Flash/Executor/PipelineExecutorStatus.h>
 #include <Flash/Pipeline/Exec/PipelineExec.h>
 #include <Operators/Operator.h>
@@ -34,8 +35,9 @@ extern const char random_pipeline_model_cancel_failpoint[];
 OperatorStatus Operator::await()
 {
     CHECK_IS_CANCELLED
-    // TODO collect operator profile info here.
+    Stopwatch stopwatch;
     auto op_status = awaitImpl();
+    profile_info->execution_time += stopwatch.elapsed();
 #ifndef NDEBUG
     assertOperatorStatus(op_status, {OperatorStatus::NEED_INPUT, OperatorStatus::HAS_OUTPUT});
 #endif
@@ -46,9 +48,12 @@ OperatorStatus Operator::await()
 OperatorStatus SourceOp::read(Block & block)
 {
     CHECK_IS_CANCELLED
-    // TODO collect operator profile info here.
+    Stopwatch stopwatch;
     assert(!block);
     auto op_status = readImpl(block);
+    profile_info->execution_time += stopwatch.elapsed();
+    if (op_status == OperatorStatus::HAS_OUTPUT && block)
+        profile_info->update(block);
 #ifndef NDEBUG
     if (block)
     {
@@ -64,8 +69,11 @@ OperatorStatus SourceOp::read(Block & block)
 OperatorStatus TransformOp::transform(Block & block)
 {
     CHECK_IS_CANCELLED
-    // TODO collect operator profile info here.
+    Stopwatch stopwatch;
     auto op_status = transformImpl(block);
+    profile_info->execution_time += stopwatch.elapsed();
+    if (op_status == OperatorStatus::HAS_OUTPUT && block)
+        profile_info->update(block);
 #ifndef NDEBUG
     if (block)
     {
@@ -81,9 +89,12 @@ OperatorStatus TransformOp::transform(Block & block)
 OperatorStatus TransformOp::tryOutput(Block & block)
 {
     CHECK_IS_CANCELLED
-    // TODO collect operator profile info here.
+    Stopwatch stopwatch;
     assert(!block);
     auto op_status = tryOutputImpl(block);
+    profile_info->execution_time += stopwatch.elapsed();
+    if (op_status == OperatorStatus::HAS_OUTPUT && block)
+        profile_info->update(block);
 #ifndef NDEBUG
     if (block)
     {
@@ -99,8 +110,9 @@ OperatorStatus TransformOp::tryOutput(Block & block)
 OperatorStatus SinkOp::prepare()
 {
     CHECK_IS_CANCELLED
-    // TODO collect operator profile info here.
+    Stopwatch stopwatch;
     auto op_status = prepareImpl();
+    profile_info->execution_time += stopwatch.elapsed();
 #ifndef NDEBUG
     assertOperatorStatus(op_status, {OperatorStatus::NEED_INPUT});
 #endif
@@ -118,8 +130,11 @@ OperatorStatus SinkOp::write(Block && block)
         assertBlocksHaveEqualStructure(block, header, getName());
     }
 #endif
-    // TODO collect operator profile info here.
+    Stopwatch stopwatch;
+    if (block)
+        profile_info->update(block);
     auto op_status = writeImpl(std::move(block));
+    profile_info->execution_time += stopwatch.elapsed();
 #ifndef NDEBUG
     assertOperatorStatus(op_status, {OperatorStatus::FINISHED, OperatorStatus::NEED_INPUT});
 #endif
@@ -16,6 +16,7 @@
 
 #include <Common/Logger.h>
 #include <Core/Block.h>
+#include <Operators/OperatorProfileInfo.h>
 
 #include <memory>
 
@@ -42,8 +43,6 @@ enum class OperatorStatus
     HAS_OUTPUT,
 };
 
-// TODO support operator profile info like `BlockStreamProfileInfo`.
-
 class PipelineExecutorStatus;
 
 class Operator
@@ -80,10 +79,14 @@ public:
         header = header_;
     }
 
+    const OperatorProfileInfoPtr & getProfileInfo() const { return profile_info; }
+
 protected:
     PipelineExecutorStatus & exec_status;
     const LoggerPtr log;
     Block header;
+
+    OperatorProfileInfoPtr profile_info = std::make_shared<OperatorProfileInfo>();
 };
 
 // The running status returned by Source can only be `HAS_OUTPUT`.
@@ -0,0 +1,47 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Core/Block.h>
+#include <common/types.h>
+
+#include <memory>
+#include <vector>
+
+namespace DB
+{
+/// Like `BlockStreamProfileInfo`, but for the operators of the pipeline model.
+/// An operator is only called by one pipeline task at the same time, so the info needs no synchronization.
+struct OperatorProfileInfo
+{
+    /// The blocks output by the operator, or written to the sink operator.
+    size_t rows = 0;
+    size_t blocks = 0;
+    size_t bytes = 0;
+
+    /// The time spent in the operator itself.
+    /// Different from `BlockStreamProfileInfo`, it does not include the time spent in the upstream operators.
+    UInt64 execution_time = 0;
+
+    void update(const Block & block)
+    {
+        ++blocks;
+        rows += block.rows();
+        bytes += block.bytes();
+    }
+};
+using OperatorProfileInfoPtr = std::shared_ptr<OperatorProfileInfo>;
+using OperatorProfileInfos = std::vector<OperatorProfileInfoPtr>;
+} // namespace DB
@@ -36,7 +36,19 @@ OperatorStatus TopNTransformOp::transformImpl(Block & block)
     }
     RUNTIME_CHECK_MSG(!impl, "Impl must be nullptr here.");
 
-    sortBlock(block, order_desc, limit);
+    if (topn_threshold)
+    {
+        const auto & column_name = order_desc[0].column_name;
+        topn_threshold->filterBlock(block, column_name);
+        if (block.rows() == 0)
+            return OperatorStatus::NEED_INPUT;
+        sortBlock(block, order_desc, limit);
+        topn_threshold->update(*block.getByName(column_name).column);
+    }
+    else
+    {
+        sortBlock(block, order_desc, limit);
+    }
     blocks.emplace_back(std::move(block));
     return OperatorStatus::NEED_INPUT;
 }
@@ -17,6 +17,7 @@
 #include <Common/Logger.h>
 #include <Core/SortDescription.h>
 #include <DataStreams/IBlockInputStream.h>
+#include <DataStreams/TopNThreshold.h>
 #include <Operators/Operator.h>
 
 namespace DB
@@ -29,12 +30,14 @@ public:
         const String & req_id_,
         const SortDescription & order_desc_,
         size_t limit_,
-        size_t max_block_size_)
+        size_t max_block_size_,
+        const TopNThresholdPtr & topn_threshold_ = nullptr)
         : TransformOp(exec_status_, req_id_)
         , order_desc(order_desc_)
         , limit(limit_)
         , max_block_size(max_block_size_)
         , req_id(req_id_)
+        , topn_threshold(topn_threshold_)
     {}
 
     String getName() const override
@@ -54,6 +57,8 @@ private:
     size_t limit;
     size_t max_block_size;
     String req_id;
+    // If not null, the rows after the threshold are filtered out before sorting.
+    TopNThresholdPtr topn_threshold;
     Blocks blocks;
     std::unique_ptr<IBlockInputStream> impl;
 };
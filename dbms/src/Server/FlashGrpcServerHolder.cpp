@@ -14,6 +14,7 @@
 
 #include <Debug/MockExecutor/AstToPBUtils.h>
 #include <Flash/EstablishCall.h>
+#include <Flash/FetchDisaggPagesCall.h>
 #include <Interpreters/Context.h>
 #include <Server/FlashGrpcServerHolder.h>
 
@@ -31,6 +32,7 @@ extern const int IP_ADDRESS_NOT_ALLOWED;
 } // namespace ErrorCodes
 namespace
 {
+template <typename CallData>
 void handleRpcs(grpc::ServerCompletionQueue * curcq, const LoggerPtr & log)
 {
     GET_METRIC(tiflash_thread_count, type_total_rpc_async_worker).Increment();
@@ -46,7 +48,7 @@ void handleRpcs(grpc::ServerCompletionQueue * curcq, const LoggerPtr & log)
         {
             // Block waiting to read the next event from the completion queue. The
             // event is uniquely identified by its tag, which in this case is the
-            // memory address of a EstablishCallData instance.
+            // memory address of a CallData instance.
             // The return value of Next should always be checked. This return value
             // tells us whether there is any kind of event or cq is shutting down.
             if (!curcq->Next(&tag, &ok))
@@ -60,7 +62,7 @@ void handleRpcs(grpc::ServerCompletionQueue * curcq, const LoggerPtr & log)
             });
             // If ok is false, it means server is shutdown.
             // We need not log all not ok events, since the volumn is large which will pollute the content of log.
-            static_cast<EstablishCallData *>(tag)->proceed(ok);
+            static_cast<CallData *>(tag)->proceed(ok);
         }
         catch (Exception & e)
         {
@@ -173,6 +175,13 @@ FlashGrpcServerHolder::FlashGrpcServerHolder(Context & context, Poco::Util::Laye
             cqs.emplace_back(builder.AddCompletionQueue());
             notify_cqs.emplace_back(builder.AddCompletionQueue());
         }
+        // FetchDisaggPages is much less frequent than EstablishMPPConnection, and its packets are
+        // produced in background threads, so a few completion queues are enough.
+        for (int i = 0; i < std::max(1, async_cq_num / 4); ++i)
+        {
+            fetch_pages_cqs.emplace_back(builder.AddCompletionQueue());
+            fetch_pages_notify_cqs.emplace_back(builder.AddCompletionQueue());
+        }
     }
     flash_grpc_server = builder.BuildAndStart();
     if (!flash_grpc_server)
@@ -194,8 +203,20 @@ FlashGrpcServerHolder::FlashGrpcServerHolder(Context & context, Poco::Util::Laye
                 // EstablishCallData will handle its lifecycle by itself.
                 EstablishCallData::spawn(assert_cast<AsyncFlashService *>(flash_service.get()), cq, notify_cq, is_shutdown);
             }
-            cq_workers.emplace_back(ThreadFactory::newThread(false, "async_poller", [cq, this] { handleRpcs(cq, log); }));
-            notify_cq_workers.emplace_back(ThreadFactory::newThread(false, "async_poller", [notify_cq, this] { handleRpcs(notify_cq, log); }));
+            cq_workers.emplace_back(ThreadFactory::newThread(false, "async_poller", [cq, this] { handleRpcs<EstablishCallData>(cq, log); }));
+            notify_cq_workers.emplace_back(ThreadFactory::newThread(false, "async_poller", [notify_cq, this] { handleRpcs<EstablishCallData>(notify_cq, log); }));
+        }
+        for (size_t i = 0; i < fetch_pages_cqs.size(); ++i)
+        {
+            auto * cq = fetch_pages_cqs[i].get();
+            auto * notify_cq = fetch_pages_notify_cqs[i].get();
+            for (int j = 0; j < preallocated_request_count_per_poller; ++j)
+            {
+                // FetchDisaggPagesCallData will handle its lifecycle by itself.
+                FetchDisaggPagesCallData::spawn(assert_cast<AsyncFlashService *>(flash_service.get()), cq, notify_cq, is_shutdown);
+            }
+            fetch_pages_cq_workers.emplace_back(ThreadFactory::newThread(false, "async_poller", [cq, this] { handleRpcs<FetchDisaggPagesCallData>(cq, log); }));
+            fetch_pages_cq_workers.emplace_back(ThreadFactory::newThread(false, "async_poller", [notify_cq, this] { handleRpcs<FetchDisaggPagesCallData>(notify_cq, log); }));
         }
     }
 }
@@ -214,16 +235,30 @@ FlashGrpcServerHolder::~FlashGrpcServerHolder()
         int wait_cnt = 0;
         while (GET_METRIC(tiflash_object_count, type_count_of_mpptunnel).Value() >= 1 && (wait_cnt++ < max_wait_cnt))
             std::this_thread::sleep_for(std::chrono::seconds(1));
+        // Wait all processing FetchDisaggPages done, the packets being produced in background
+        // will push the call data into the completion queues.
+        wait_cnt = 0;
+        while (GET_METRIC(tiflash_object_count, type_count_of_fetch_pages_calldata).Value() >= 1 && (wait_cnt++ < max_wait_cnt))
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        // The processing calls may be still waiting after timeout, make sure no alarm is set after the
+        // completion queues are shut down.
+        FetchDisaggPagesCallData::waitForProducingPackets();
 
         for (auto & cq : cqs)
             cq->Shutdown();
         for (auto & cq : notify_cqs)
             cq->Shutdown();
+        for (auto & cq : fetch_pages_cqs)
+            cq->Shutdown();
+        for (auto & cq : fetch_pages_notify_cqs)
+            cq->Shutdown();
 
         for (auto & worker : cq_workers)
             worker.join();
         for (auto & worker : notify_cq_workers)
             worker.join();
+        for (auto & worker : fetch_pages_cq_workers)
+            worker.join();
 
         flash_grpc_server->Wait();
         flash_grpc_server.reset();
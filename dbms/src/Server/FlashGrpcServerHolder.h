@@ -55,6 +55,10 @@ private:
     std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> notify_cqs;
     std::vector<std::thread> cq_workers;
     std::vector<std::thread> notify_cq_workers;
+    // fetch_pages_cqs and fetch_pages_notify_cqs are used for processing async FetchDisaggPages events.
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> fetch_pages_cqs;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> fetch_pages_notify_cqs;
+    std::vector<std::thread> fetch_pages_cq_workers;
     CollectProcInfoBackgroundTask background_task;
 };
 
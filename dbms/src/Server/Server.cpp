@@ -822,6 +822,15 @@ void initThreadPool(Poco::Util::LayeredConfiguration & config)
             /*queue_size*/ default_num_threads * 2);
     }
 
+    if (disaggregated_mode == DisaggregatedMode::Storage)
+    {
+        // Used for reading and compressing the pages responded by the async FetchDisaggPages
+        WNFetchPagesPool::initialize(
+            /*max_threads*/ default_num_threads,
+            /*max_free_threads*/ default_num_threads / 2,
+            /*queue_size*/ default_num_threads * 8);
+    }
+
     if (disaggregated_mode == DisaggregatedMode::Compute || disaggregated_mode == DisaggregatedMode::Storage)
     {
         DataStoreS3Pool::initialize(
@@ -833,6 +842,18 @@ void initThreadPool(Poco::Util::LayeredConfiguration & config)
             /*max_free_threads*/ default_num_threads / 2,
             /*queue_size*/ default_num_threads * 2);
     }
+
+    // Used for restoring the segments of DeltaMergeStores concurrently at startup
+    RestoreSegmentPool::initialize(
+        /*max_threads*/ default_num_threads,
+        /*max_free_threads*/ default_num_threads / 2,
+        /*queue_size*/ default_num_threads * 8);
+
+    // Used for issuing the merged reads of a multi-page read in BlobStore concurrently
+    BlobReadPool::initialize(
+        /*max_threads*/ default_num_threads,
+        /*max_free_threads*/ default_num_threads / 2,
+        /*queue_size*/ default_num_threads * 8);
 }
 
 void adjustThreadPoolSize(const Settings & settings, size_t logical_cores)
@@ -869,6 +890,24 @@ void adjustThreadPoolSize(const Settings & settings, size_t logical_cores)
         S3FileCachePool::instance->setMaxFreeThreads(max_io_thread_count / 2);
         S3FileCachePool::instance->setQueueSize(max_io_thread_count * 2);
     }
+    if (RestoreSegmentPool::instance)
+    {
+        RestoreSegmentPool::instance->setMaxThreads(max_io_thread_count);
+        RestoreSegmentPool::instance->setMaxFreeThreads(max_io_thread_count / 2);
+        RestoreSegmentPool::instance->setQueueSize(max_io_thread_count * 8);
+    }
+    if (BlobReadPool::instance)
+    {
+        BlobReadPool::instance->setMaxThreads(max_io_thread_count);
+        BlobReadPool::instance->setMaxFreeThreads(max_io_thread_count / 2);
+        BlobReadPool::instance->setQueueSize(max_io_thread_count * 8);
+    }
+    if (WNFetchPagesPool::instance)
+    {
+        WNFetchPagesPool::instance->setMaxThreads(max_io_thread_count);
+        WNFetchPagesPool::instance->setMaxFreeThreads(max_io_thread_count / 2);
+        WNFetchPagesPool::instance->setQueueSize(max_io_thread_count * 8);
+    }
 }
 
 void syncSchemaWithTiDB(
@@ -1398,6 +1437,11 @@ int Server::main(const std::vector<std::string> & /*args*/)
     if (minmax_index_cache_size)
         global_context->setMinMaxIndexCache(minmax_index_cache_size);
 
+    /// Size of cache for the responses of cop requests. Zero means disabled.
+    size_t cop_result_cache_size = config().getUInt64("cop_result_cache_size", 0);
+    if (cop_result_cache_size)
+        global_context->setCopResultCache(cop_result_cache_size);
+
     /// Size of max memory usage of DeltaIndex, used by DeltaMerge engine.
     /// This setting is currently a bit tricky:
     /// - In non-disaggregated mode, its default value is 0, means unlimited, and it
@@ -1421,6 +1465,12 @@ int Server::main(const std::vector<std::string> & /*args*/)
     {
         size_t n = config().getUInt64("delta_index_cache_size", 0);
         global_context->setDeltaIndexManager(n);
+
+        /// Size of cache for the bitmap filters of segments. Zero means disabled.
+        /// Only enabled on the nodes that own the segments, as the segment ids from different write nodes may be the same.
+        size_t bitmap_filter_cache_size = config().getUInt64("bitmap_filter_cache_size", 0);
+        if (bitmap_filter_cache_size)
+            global_context->setBitmapFilterCache(bitmap_filter_cache_size);
     }
 
     /// Set path for format schema files
@@ -38,6 +38,7 @@ public:
 
     String toDebugString() const;
     size_t count() const;
+    size_t byteSize() const { return filter.capacity() / 8; }
 
 private:
     std::vector<bool> filter;
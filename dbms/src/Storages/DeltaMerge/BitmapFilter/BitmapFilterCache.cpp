@@ -0,0 +1,73 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/SipHash.h>
+#include <Common/TiFlashMetrics.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
+
+namespace DB::DM
+{
+UInt128 BitmapFilterCache::getKey(
+    TableID physical_table_id,
+    PageIdU64 segment_id,
+    UInt64 segment_epoch,
+    size_t delta_rows,
+    size_t delta_deletes,
+    bool read_stable_only,
+    const RowKeyRanges & read_ranges)
+{
+    SipHash hash;
+    hash.update(physical_table_id);
+    hash.update(segment_id);
+    hash.update(segment_epoch);
+    hash.update(delta_rows);
+    hash.update(delta_deletes);
+    hash.update(read_stable_only);
+    hash.update(read_ranges.size());
+    for (const auto & range : read_ranges)
+    {
+        hash.update(range.is_common_handle);
+        hash.update(range.start.value->size());
+        hash.update(*range.start.value);
+        hash.update(range.end.value->size());
+        hash.update(*range.end.value);
+    }
+
+    UInt128 key;
+    hash.get128(key.low, key.high);
+    return key;
+}
+
+BitmapFilterPtr BitmapFilterCache::tryGet(const UInt128 & key, const DeltaValueSpacePtr & delta)
+{
+    auto entry = get(key);
+    if (!entry || entry->delta.lock() != delta)
+    {
+        GET_METRIC(tiflash_storage_bitmap_filter_cache, type_miss).Increment();
+        return nullptr;
+    }
+    GET_METRIC(tiflash_storage_bitmap_filter_cache, type_hit).Increment();
+    return entry->bitmap_filter;
+}
+
+void BitmapFilterCache::put(const UInt128 & key, const DeltaValueSpacePtr & delta, const BitmapFilterPtr & bitmap_filter)
+{
+    auto entry = std::make_shared<BitmapFilterCacheEntry>();
+    entry->bitmap_filter = bitmap_filter;
+    entry->delta = delta;
+    set(key, entry);
+    GET_METRIC(tiflash_storage_bitmap_filter_cache, type_put).Increment();
+}
+
+} // namespace DB::DM
@@ -0,0 +1,81 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilter.h>
+#include <Storages/DeltaMerge/RowKeyRange.h>
+#include <Storages/Page/PageDefinesBase.h>
+#include <common/UInt128.h>
+#include <common/types.h>
+
+namespace DB::DM
+{
+class DeltaValueSpace;
+using DeltaValueSpacePtr = std::shared_ptr<DeltaValueSpace>;
+
+struct BitmapFilterCacheEntry
+{
+    BitmapFilterPtr bitmap_filter;
+    // The delta of the segment when `bitmap_filter` is built. The key does not identify the
+    // table uniquely (e.g. tables of different keyspaces may have the same id), so the delta
+    // is checked when looking up. It is a weak pointer to not keep the abandoned delta alive.
+    std::weak_ptr<DeltaValueSpace> delta;
+};
+
+struct BitmapFilterCacheWeightFunction
+{
+    size_t operator()(const BitmapFilterCacheEntry & entry) const
+    {
+        return sizeof(BitmapFilterCacheEntry) + (entry.bitmap_filter ? entry.bitmap_filter->byteSize() : 0);
+    }
+};
+
+/// Cache the bitmap filters of segments, so that the hot segments are not merged again by every read.
+///
+/// The key is the hash of the segment (id and epoch), the rows and deletes of the delta snapshot
+/// and the read ranges. The epoch changes when the stable is changed, and the delta only grows
+/// within an epoch, so they identify the data of the snapshot. The max version of the read is
+/// excluded from the key, so the caller must only put and get the bitmap filters of the reads
+/// that all the data in the snapshot are visible to, i.e. the max version of the read is not
+/// less than the max commit version of the data in the segment.
+class BitmapFilterCache : public LRUCache<UInt128, BitmapFilterCacheEntry, std::hash<UInt128>, BitmapFilterCacheWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, BitmapFilterCacheEntry, std::hash<UInt128>, BitmapFilterCacheWeightFunction>;
+
+public:
+    explicit BitmapFilterCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {}
+
+    static UInt128 getKey(
+        TableID physical_table_id,
+        PageIdU64 segment_id,
+        UInt64 segment_epoch,
+        size_t delta_rows,
+        size_t delta_deletes,
+        bool read_stable_only,
+        const RowKeyRanges & read_ranges);
+
+    /// Return nullptr if there is no entry of `key` built with `delta`.
+    BitmapFilterPtr tryGet(const UInt128 & key, const DeltaValueSpacePtr & delta);
+
+    void put(const UInt128 & key, const DeltaValueSpacePtr & delta, const BitmapFilterPtr & bitmap_filter);
+};
+
+using BitmapFilterCachePtr = std::shared_ptr<BitmapFilterCache>;
+
+} // namespace DB::DM
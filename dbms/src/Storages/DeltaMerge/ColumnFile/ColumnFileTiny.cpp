@@ -199,7 +199,8 @@ std::tuple<ColumnFilePersistedPtr, BlockPtr> ColumnFileTiny::createFromCheckpoin
     PS::V3::CheckpointLocation new_remote_data_location{
         .data_file_id = std::make_shared<String>(remote_data_file_key),
         .offset_in_file = remote_data_location->offset_in_file,
-        .size_in_file = remote_data_location->size_in_file};
+        .size_in_file = remote_data_location->size_in_file,
+        .is_compressed = remote_data_location->is_compressed};
     auto entry = temp_ps->getEntry(remote_page_id);
     LOG_DEBUG(Logger::get(), "Write remote page[page_id={} remote_location={}] using local page id {}", remote_page_id, new_remote_data_location.toDebugString(), new_cf_id);
     wbs.log.putRemotePage(new_cf_id, 0, entry.size, new_remote_data_location, std::move(entry.field_offsets));
@@ -89,6 +89,12 @@ protected:
             return {};
         while (true)
         {
+            if (cur_stream && task_pool->isLimitReached() && task_pool->canStopReadingSegment())
+            {
+                LOG_TRACE(log, "Stop reading segment because the limit is reached, segment={}", cur_segment->simpleInfo());
+                cur_segment = {};
+                cur_stream = {};
+            }
             while (!cur_stream)
             {
                 auto task = task_pool->nextTask();
@@ -101,7 +107,7 @@ protected:
                 cur_segment = task->segment;
 
                 auto block_size = std::max(expected_block_size, static_cast<size_t>(dm_context->db_context.getSettingsRef().dt_segment_stable_pack_rows));
-                cur_stream = task->segment->getInputStream(read_mode, *dm_context, columns_to_read, task->read_snapshot, task->ranges, filter, max_version, block_size);
+                cur_stream = task->segment->getInputStream(read_mode, *dm_context, columns_to_read, task->read_snapshot, task->ranges, task_pool->getFilterForSegment(filter), max_version, block_size);
                 LOG_TRACE(log, "Start to read segment, segment={}", cur_segment->simpleInfo());
             }
             FAIL_POINT_PAUSE(FailPoints::pause_when_reading_from_dt_stream);
@@ -112,6 +118,7 @@ protected:
             {
                 if (action.transform(res))
                 {
+                    task_pool->addReadRows(res.rows());
                     return res;
                 }
                 else
@@ -37,6 +37,7 @@ namespace DM
 DeltaValueSpace::DeltaValueSpace(PageIdU64 id_, const ColumnFilePersisteds & persisted_files, const ColumnFiles & in_memory_files)
     : persisted_file_set(std::make_shared<ColumnFilePersistedSet>(id_, persisted_files))
     , mem_table_set(std::make_shared<MemTableSet>(in_memory_files))
+    , initial_max_data_version(persisted_files.empty() && in_memory_files.empty() ? 0 : UNKNOWN_DATA_VERSION)
     , delta_index(std::make_shared<DeltaIndex>())
     , log(Logger::get())
 {}
@@ -44,6 +45,7 @@ DeltaValueSpace::DeltaValueSpace(PageIdU64 id_, const ColumnFilePersisteds & per
 DeltaValueSpace::DeltaValueSpace(ColumnFilePersistedSetPtr && persisted_file_set_)
     : persisted_file_set(std::move(persisted_file_set_))
     , mem_table_set(std::make_shared<MemTableSet>())
+    , initial_max_data_version(persisted_file_set->getColumnFileCount() == 0 ? 0 : UNKNOWN_DATA_VERSION)
     , delta_index(std::make_shared<DeltaIndex>())
     , log(Logger::get())
 {}
@@ -248,12 +250,33 @@ void DeltaValueSpace::recordRemoveColumnFilesPages(WriteBatches & wbs) const
     mem_table_set->recordRemoveColumnFilesPages(wbs);
 }
 
-bool DeltaValueSpace::appendColumnFile(DMContext & /*context*/, const ColumnFilePtr & column_file)
+UInt64 DeltaValueSpace::getMaxDataVersion(const Block & block, size_t offset, size_t limit)
+{
+    const auto col = tryGetByColumnId(block, VERSION_COLUMN_ID);
+    if (!col.column)
+        return UNKNOWN_DATA_VERSION;
+
+    const auto & versions = toColumnVectorData<UInt64>(col.column);
+    UInt64 max_version = 0;
+    for (size_t i = offset; i < offset + limit; ++i)
+        max_version = std::max(max_version, versions[i]);
+    return max_version;
+}
+
+void DeltaValueSpace::updateMaxAppendedDataVersion(UInt64 version)
+{
+    auto current = max_appended_data_version.load(std::memory_order_relaxed);
+    while (current < version && !max_appended_data_version.compare_exchange_weak(current, version, std::memory_order_acq_rel))
+        ;
+}
+
+bool DeltaValueSpace::appendColumnFile(DMContext & /*context*/, const ColumnFilePtr & column_file, UInt64 max_version)
 {
     std::scoped_lock lock(mutex);
     if (abandoned.load(std::memory_order_relaxed))
         return false;
 
+    updateMaxAppendedDataVersion(max_version);
     mem_table_set->appendColumnFile(column_file);
     return true;
 }
@@ -264,6 +287,7 @@ bool DeltaValueSpace::appendToCache(DMContext & context, const Block & block, si
     if (abandoned.load(std::memory_order_relaxed))
         return false;
 
+    updateMaxAppendedDataVersion(getMaxDataVersion(block, offset, limit));
     mem_table_set->appendToCache(context, block, offset, limit);
     return true;
 }
@@ -278,12 +302,13 @@ bool DeltaValueSpace::appendDeleteRange(DMContext & /*context*/, const RowKeyRan
     return true;
 }
 
-bool DeltaValueSpace::ingestColumnFiles(DMContext & /*context*/, const RowKeyRange & range, const ColumnFiles & column_files, bool clear_data_in_range)
+bool DeltaValueSpace::ingestColumnFiles(DMContext & /*context*/, const RowKeyRange & range, const ColumnFiles & column_files, bool clear_data_in_range, UInt64 max_version)
 {
     std::scoped_lock lock(mutex);
     if (abandoned.load(std::memory_order_relaxed))
         return false;
 
+    updateMaxAppendedDataVersion(max_version);
     mem_table_set->ingestColumnFiles(range, column_files, clear_data_in_range);
     return true;
 }
@@ -93,6 +93,13 @@ private:
     std::atomic<size_t> last_try_split_bytes = 0;
     std::atomic<size_t> last_try_place_delta_index_rows = 0;
 
+    /// The upper bound of the commit versions of the column files this instance is created with.
+    /// They are unknown unless set by `setInitialMaxDataVersion`, e.g. restored after reboot.
+    std::atomic<UInt64> initial_max_data_version;
+    /// The max commit version of the data appended to this instance. It is updated before the data
+    /// is appended, so that it is not less than the version of any data in a snapshot.
+    std::atomic<UInt64> max_appended_data_version = 0;
+
     DeltaIndexPtr delta_index;
     UInt64 delta_index_epoch = 0;
 
@@ -235,6 +242,20 @@ public:
     std::atomic<size_t> & getLastTrySplitBytes() { return last_try_split_bytes; }
     std::atomic<size_t> & getLastTryPlaceDeltaIndexRows() { return last_try_place_delta_index_rows; }
 
+    /// The version used when the versions of some data are unknown.
+    static constexpr UInt64 UNKNOWN_DATA_VERSION = std::numeric_limits<UInt64>::max();
+
+    /// The max version of the version column in `block` within [offset, offset + limit).
+    static UInt64 getMaxDataVersion(const Block & block, size_t offset, size_t limit);
+
+    /// The upper bound of the commit versions of all the data in this instance.
+    UInt64 getMaxDataVersion() const { return std::max(initial_max_data_version.load(std::memory_order_acquire), getMaxAppendedDataVersion()); }
+    /// The max commit version of the data appended since this instance is created.
+    UInt64 getMaxAppendedDataVersion() const { return max_appended_data_version.load(std::memory_order_acquire); }
+    /// Set the upper bound of the commit versions of the column files this instance is created with,
+    /// must be called before this instance is shared.
+    void setInitialMaxDataVersion(UInt64 version) { initial_max_data_version.store(version, std::memory_order_release); }
+
     size_t getDeltaIndexBytes()
     {
         std::scoped_lock lock(mutex);
@@ -264,13 +285,15 @@ public:
     /// some updates on this instance. E.g. this instance have been abandoned.
     /// Caller should try again from the beginning.
 
-    bool appendColumnFile(DMContext & context, const ColumnFilePtr & column_file);
+    /// `max_version` is the max commit version of the data in `column_file`.
+    bool appendColumnFile(DMContext & context, const ColumnFilePtr & column_file, UInt64 max_version = UNKNOWN_DATA_VERSION);
 
     bool appendToCache(DMContext & context, const Block & block, size_t offset, size_t limit);
 
     bool appendDeleteRange(DMContext & context, const RowKeyRange & delete_range);
 
-    bool ingestColumnFiles(DMContext & context, const RowKeyRange & range, const ColumnFiles & column_files, bool clear_data_in_range);
+    /// `max_version` is the max commit version of the data in `column_files`.
+    bool ingestColumnFiles(DMContext & context, const RowKeyRange & range, const ColumnFiles & column_files, bool clear_data_in_range, UInt64 max_version = UNKNOWN_DATA_VERSION);
 
     /// Flush the data of column files which haven't write to disk yet, and also save the metadata of column files.
     bool flush(DMContext & context);
@@ -302,6 +325,9 @@ public:
      * @returns empty if `for_update == true` is specified and there is another alive for_update snapshot.
      */
     DeltaSnapshotPtr createSnapshot(const DMContext & context, bool for_update, CurrentMetrics::Metric type);
+
+private:
+    void updateMaxAppendedDataVersion(UInt64 version);
 };
 
 class DeltaValueSnapshot
@@ -21,6 +21,7 @@
 #include <Common/assert_cast.h>
 #include <Core/SortDescription.h>
 #include <Functions/FunctionsConversion.h>
+#include <IO/IOThreadPools.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Interpreters/sortBlock.h>
@@ -48,6 +49,7 @@
 
 #include <atomic>
 #include <ext/scope_guard.h>
+#include <future>
 #include <magic_enum.hpp>
 #include <memory>
 
@@ -178,6 +180,70 @@ ColumnDefinesPtr generateStoreColumns(const ColumnDefines & table_columns, bool
     }
     return columns;
 }
+
+constexpr size_t MAX_RESTORE_SEGMENT_WORKERS = 16;
+
+// Restore the delta and stable of the segments with at most `MAX_RESTORE_SEGMENT_WORKERS` threads
+// from `RestoreSegmentPool`. The returned segments are in the same order as `segment_infos`.
+Segments restoreSegments(const LoggerPtr & log, DMContext & dm_context, const Segment::SegmentMetaInfos & segment_infos)
+{
+    Segments restored(segment_infos.size());
+    // Each worker keeps taking the next segment to restore until all are done. The current thread
+    // works as well, so the restore makes progress even when the pool is busy with other stores.
+    std::atomic<size_t> next_index = 0;
+    auto restore_worker = [&] {
+        try
+        {
+            for (size_t i = next_index++; i < segment_infos.size(); i = next_index++)
+                restored[i] = Segment::restoreSegment(log, dm_context, segment_infos[i]);
+        }
+        catch (...)
+        {
+            // Stop other workers from taking more segments
+            next_index = segment_infos.size();
+            throw;
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    // The current thread is one of the workers
+    const size_t max_workers = std::min(segment_infos.size(), MAX_RESTORE_SEGMENT_WORKERS);
+    for (size_t i = 1; i < max_workers; ++i)
+    {
+        auto task = std::make_shared<std::packaged_task<void()>>(restore_worker);
+        auto future = task->get_future();
+        if (!RestoreSegmentPool::get().trySchedule([task] { (*task)(); }))
+            break;
+        futures.emplace_back(std::move(future));
+    }
+
+    std::exception_ptr first_exception;
+    try
+    {
+        restore_worker();
+    }
+    catch (...)
+    {
+        first_exception = std::current_exception();
+    }
+    // Wait for all workers before leaving, they are referencing the local variables
+    for (auto & f : futures)
+    {
+        try
+        {
+            f.get();
+        }
+        catch (...)
+        {
+            if (!first_exception)
+                first_exception = std::current_exception();
+        }
+    }
+    if (first_exception)
+        std::rethrow_exception(first_exception);
+
+    return restored;
+}
 } // namespace
 
 DeltaMergeStore::Settings DeltaMergeStore::EMPTY_SETTINGS = DeltaMergeStore::Settings{.not_compress_columns = NotCompress{}};
@@ -213,6 +279,11 @@ DeltaMergeStore::DeltaMergeStore(Context & db_context,
 
     LOG_INFO(log, "Restore DeltaMerge Store start");
 
+    // Time spent in each phase of restoring, for diagnosing slow startup
+    Stopwatch watch;
+    auto seconds_from_last_phase = [&watch] { return watch.elapsedFromLastTime() / 1'000'000'000.0; };
+    double stable_files_seconds = 0, page_storage_seconds = 0, segment_meta_seconds = 0, segments_seconds = 0;
+
     storage_pool = std::make_shared<StoragePool>(global_context,
                                                  ns_id,
                                                  *path_pool,
@@ -221,6 +292,7 @@ DeltaMergeStore::DeltaMergeStore(Context & db_context,
     // Restore existing dm files.
     // Should be done before any background task setup.
     restoreStableFiles();
+    stable_files_seconds = seconds_from_last_phase();
 
     original_table_columns.emplace_back(original_table_handle_define);
     original_table_columns.emplace_back(getVersionColumnDefine());
@@ -239,6 +311,7 @@ DeltaMergeStore::DeltaMergeStore(Context & db_context,
     try
     {
         page_storage_run_mode = storage_pool->restore(); // restore from disk
+        page_storage_seconds = seconds_from_last_phase();
         if (const auto first_segment_entry = storage_pool->metaReader()->getPageEntry(DELTA_MERGE_FIRST_SEGMENT_ID);
             !first_segment_entry.isValid())
         {
@@ -270,15 +343,18 @@ DeltaMergeStore::DeltaMergeStore(Context & db_context,
         }
         else
         {
-            auto segment_id = DELTA_MERGE_FIRST_SEGMENT_ID;
-            while (segment_id)
+            // Walk the segment chain by only reading the segment meta pages, then restore
+            // the delta and stable of the segments concurrently.
+            auto segment_infos = Segment::readAllSegmentsMetaInfo(*dm_context, DELTA_MERGE_FIRST_SEGMENT_ID);
+            segment_meta_seconds = seconds_from_last_phase();
+
+            auto restored_segments = restoreSegments(log, *dm_context, segment_infos);
+            for (const auto & segment : restored_segments)
             {
-                auto segment = Segment::restoreSegment(log, *dm_context, segment_id);
                 segments.emplace(segment->getRowKeyRange().getEnd(), segment);
-                id_to_segment.emplace(segment_id, segment);
-
-                segment_id = segment->nextSegmentId();
+                id_to_segment.emplace(segment->segmentId(), segment);
             }
+            segments_seconds = seconds_from_last_phase();
         }
     }
     catch (...)
@@ -289,7 +365,22 @@ DeltaMergeStore::DeltaMergeStore(Context & db_context,
 
     setUpBackgroundTask(dm_context);
 
-    LOG_INFO(log, "Restore DeltaMerge Store end, ps_run_mode={}", magic_enum::enum_name(page_storage_run_mode));
+    const auto total_seconds = watch.elapsedSeconds();
+    GET_METRIC(tiflash_storage_restore_duration_seconds, type_stable_files).Observe(stable_files_seconds);
+    GET_METRIC(tiflash_storage_restore_duration_seconds, type_page_storage).Observe(page_storage_seconds);
+    GET_METRIC(tiflash_storage_restore_duration_seconds, type_segment_meta).Observe(segment_meta_seconds);
+    GET_METRIC(tiflash_storage_restore_duration_seconds, type_segments).Observe(segments_seconds);
+    GET_METRIC(tiflash_storage_restore_duration_seconds, type_total).Observe(total_seconds);
+    LOG_INFO(
+        log,
+        "Restore DeltaMerge Store end, ps_run_mode={} segments={} elapsed={:.3f}s stable_files={:.3f}s page_storage={:.3f}s segment_meta={:.3f}s segments={:.3f}s",
+        magic_enum::enum_name(page_storage_run_mode),
+        id_to_segment.size(),
+        total_seconds,
+        stable_files_seconds,
+        page_storage_seconds,
+        segment_meta_seconds,
+        segments_seconds);
 }
 
 DeltaMergeStore::~DeltaMergeStore()
@@ -610,7 +701,7 @@ void DeltaMergeStore::write(const Context & db_context, const DB::Settings & db_
                 }
 
                 // Write could fail, because other threads could already updated the instance. Like split/merge, merge delta.
-                if (segment->writeToDisk(*dm_context, write_column_file))
+                if (segment->writeToDisk(*dm_context, write_column_file, DeltaValueSpace::getMaxDataVersion(block, offset, limit)))
                 {
                     updated_segments.push_back(segment);
                     break;
@@ -1001,24 +1092,38 @@ BlockInputStreams DeltaMergeStore::read(const Context & db_context,
                                         size_t expected_block_size,
                                         const SegmentIdSet & read_segments,
                                         size_t extra_table_id_index,
-                                        ScanContextPtr scan_context)
+                                        ScanContextPtr scan_context,
+                                        const ReadLimitHint & limit_hint)
 {
     // Use the id from MPP/Coprocessor level as tracing_id
     auto dm_context = newDMContext(db_context, db_settings, tracing_id, scan_context);
 
+    // Reading in the order of handle requires the segments are read one by one in order.
+    keep_order = keep_order || limit_hint.in_handle_order;
     // If keep order is required, disable read thread.
     auto enable_read_thread = db_context.getSettingsRef().dt_enable_read_thread && !keep_order;
     // SegmentReadTaskScheduler and SegmentReadTaskPool use table_id + segment id as unique ID when read thread is enabled.
     // 'try_split_task' can result in several read tasks with the same id that can cause some trouble.
     // Also, too many read tasks of a segment with different small ranges is not good for data sharing cache.
-    SegmentReadTasks tasks = getReadTasksByRanges(*dm_context, sorted_ranges, num_streams, read_segments, /*try_split_task =*/!enable_read_thread);
+    // Splitting tasks will break the order of segments.
+    SegmentReadTasks tasks = getReadTasksByRanges(*dm_context, sorted_ranges, num_streams, read_segments, /*try_split_task =*/!enable_read_thread && !limit_hint.in_handle_order);
+    if (limit_hint.in_handle_order)
+    {
+        // Only one stream reads the segments so that the rows are produced in the order of segments.
+        num_streams = 1;
+        if (limit_hint.desc)
+            tasks.reverse();
+    }
     auto log_tracing_id = getLogTracingId(*dm_context);
     auto tracing_logger = log->getChild(log_tracing_id);
     LOG_DEBUG(tracing_logger,
-              "Read create segment snapshot done, keep_order={} dt_enable_read_thread={} enable_read_thread={}",
+              "Read create segment snapshot done, keep_order={} dt_enable_read_thread={} enable_read_thread={} limit={} in_handle_order={} desc={}",
               keep_order,
               db_context.getSettingsRef().dt_enable_read_thread,
-              enable_read_thread);
+              enable_read_thread,
+              limit_hint.rows,
+              limit_hint.in_handle_order,
+              limit_hint.desc);
 
     auto after_segment_read = [&](const DMContextPtr & dm_context_, const SegmentPtr & segment_) {
         // TODO: Update the tracing_id before checkSegmentUpdate?
@@ -1041,7 +1146,8 @@ BlockInputStreams DeltaMergeStore::read(const Context & db_context,
         after_segment_read,
         log_tracing_id,
         enable_read_thread,
-        final_num_stream);
+        final_num_stream,
+        limit_hint);
 
     BlockInputStreams res;
     for (size_t i = 0; i < final_num_stream; ++i)
@@ -1093,8 +1199,11 @@ SourceOps DeltaMergeStore::readSourceOps(
     size_t expected_block_size,
     const SegmentIdSet & read_segments,
     size_t extra_table_id_index,
-    ScanContextPtr scan_context)
+    ScanContextPtr scan_context,
+    const ReadLimitHint & limit_hint)
 {
+    RUNTIME_CHECK(!limit_hint.in_handle_order); // TODO: support keep order
+
     // Use the id from MPP/Coprocessor level as tracing_id
     auto dm_context = newDMContext(db_context, db_settings, tracing_id, scan_context);
 
@@ -1131,7 +1240,8 @@ SourceOps DeltaMergeStore::readSourceOps(
         after_segment_read,
         log_tracing_id,
         enable_read_thread,
-        final_num_stream);
+        final_num_stream,
+        limit_hint);
 
     SourceOps res;
     RUNTIME_CHECK(enable_read_thread); // TODO: support keep order
@@ -339,6 +339,7 @@ public:
     ///     when is_fast_scan == false, we will read rows with MVCC filtering, del mark !=0  filter and sorted merge.
     ///     when is_fast_scan == true, we will read rows without MVCC and sorted merge.
     /// `sorted_ranges` should be already sorted and merged.
+    /// `limit_hint` is the LIMIT/TopN above the read without any filter, the read stops once enough rows are read.
     BlockInputStreams read(const Context & db_context,
                            const DB::Settings & db_settings,
                            const ColumnDefines & columns_to_read,
@@ -352,13 +353,15 @@ public:
                            size_t expected_block_size = DEFAULT_BLOCK_SIZE,
                            const SegmentIdSet & read_segments = {},
                            size_t extra_table_id_index = InvalidColumnID,
-                           ScanContextPtr scan_context = nullptr);
+                           ScanContextPtr scan_context = nullptr,
+                           const ReadLimitHint & limit_hint = {});
 
 
     /// Read rows in two modes:
     ///     when is_fast_scan == false, we will read rows with MVCC filtering, del mark !=0  filter and sorted merge.
     ///     when is_fast_scan == true, we will read rows without MVCC and sorted merge.
     /// `sorted_ranges` should be already sorted and merged.
+    /// `limit_hint` is the LIMIT above the read without any filter, reading in the order of handle is not supported.
     SourceOps readSourceOps(PipelineExecutorStatus & exec_status_,
                             const Context & db_context,
                             const DB::Settings & db_settings,
@@ -373,7 +376,8 @@ public:
                             size_t expected_block_size = DEFAULT_BLOCK_SIZE,
                             const SegmentIdSet & read_segments = {},
                             size_t extra_table_id_index = InvalidColumnID,
-                            ScanContextPtr scan_context = nullptr);
+                            ScanContextPtr scan_context = nullptr,
+                            const ReadLimitHint & limit_hint = {});
 
     Remote::DisaggPhysicalTableReadSnapshotPtr
     writeNodeBuildRemoteReadSnapshot(
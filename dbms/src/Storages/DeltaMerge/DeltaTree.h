@@ -103,6 +103,14 @@ inline DT_TypeCount updateCount(DT_TypeCount type_count, UInt32 count)
     return (count << 1) | static_cast<DT_TypeCount>(isInsert(type_count));
 }
 
+/// The delta of row id generated by an entry: an insert adds one row, and a delete removes "count" rows.
+/// It is a select instead of a branch, so that the loops over the entries can be vectorized.
+inline Int64 getDelta(DT_TypeCount type_count)
+{
+    Int64 tc = type_count;
+    return (tc & TYPE_MASK) ? 1 : -(tc >> 1);
+}
+
 } // namespace DTType
 
 
@@ -123,9 +131,25 @@ struct DTMutation
     bool isInsert() const { return DTType::isInsert(type_count); }
     bool isDelete() const { return DTType::isDelete(type_count); }
     UInt32 count() const { return DTType::getCount(type_count); }
+    Int64 delta() const { return DTType::getDelta(type_count); }
     void setCount(UInt32 v) { type_count = DTType::updateCount(type_count, v); }
 };
 
+/// Returns the number of sids which are less than id (or not greater than id, if not is_left).
+/// The sids in a node are ordered, so it is also the position of the first sid which is equal or greater
+/// than id (or greater than id). The loop does not exit early, so that it can be vectorized.
+template <bool is_left>
+inline size_t countSidsBefore(const DT_Id * sids, size_t count, UInt64 id)
+{
+    if (unlikely(id > std::numeric_limits<DT_Id>::max()))
+        return count;
+    auto target = static_cast<DT_Id>(id);
+    size_t res = 0;
+    for (size_t i = 0; i < count; ++i)
+        res += is_left ? sids[i] < target : sids[i] <= target;
+    return res;
+}
+
 /// Note that we allocate one more slot for entries in DTIntern and DTLeaf, to simplify entry insert operation.
 
 template <size_t M, size_t F, size_t S>
@@ -192,38 +216,31 @@ struct DTLeaf
     {
         Int64 delta = 0;
         for (size_t i = 0; i < count; ++i)
-        {
-            const auto & m = mutations[i];
-            if (m.isInsert())
-                delta += 1;
-            else
-                delta -= m.count();
-        }
+            delta += mutations[i].delta();
         return delta;
     }
 
-    /// Search the first pos with equal or greater id.
+    /// Search the first pos with equal or greater id (greater id if not is_left), starting from "start" with "delta".
     /// Returns <pos_in_node, delta>.
-    template <bool isRid>
-    inline std::pair<size_t, Int64> search(const UInt64 id, Int64 delta) const
+    template <bool isRid, bool is_left = true>
+    inline std::pair<size_t, Int64> search(const UInt64 id, Int64 delta, size_t start = 0) const
     {
-        size_t i = 0;
-        for (; i < count; ++i)
+        size_t i = start;
+        if constexpr (isRid)
         {
-            if constexpr (isRid)
-            {
-                if (id <= rid(i, delta))
-                    return {i, delta};
-            }
-            else
+            for (; i < count; ++i)
             {
-                if (id <= sid(i))
-                    return {i, delta};
+                if (is_left ? id <= rid(i, delta) : id < rid(i, delta))
+                    break;
+                delta += mutations[i].delta();
             }
-            if (isInsert(i))
-                delta += 1;
-            else
-                delta -= mutCount(i);
+        }
+        else
+        {
+            /// The pos doesn't depend on the delta, so count it first, and then sum up the delta before it.
+            i += countSidsBefore<is_left>(sids + start, count - start, id);
+            for (size_t j = start; j < i; ++j)
+                delta += mutations[j].delta();
         }
         return {i, delta};
     }
@@ -393,11 +410,14 @@ struct DTIntern
         }
     }
 
+    /// Returns count if not found. The children are unique, so there is no need to exit early,
+    /// which makes the loop vectorizable.
     inline size_t searchChild(NodePtr child)
     {
-        size_t i = 0;
-        for (; i < count && children[i] != child; ++i) {}
-        return i;
+        size_t pos = count;
+        for (size_t i = 0; i < count; ++i)
+            pos = children[i] == child ? i : pos;
+        return pos;
     }
 
     inline Int64 getDelta()
@@ -850,11 +870,12 @@ private:
         bytes -= sizeof(T);
     }
 
-    template <typename T>
-    T * createNode()
+    /// Construct the node in place, e.g. a copy of another node is constructed directly without zeroing it first.
+    template <typename T, typename... Args>
+    T * createNode(Args &&... args)
     {
         T * n = reinterpret_cast<T *>(allocator->alloc(sizeof(T)));
-        new (n) T();
+        new (n) T(std::forward<Args>(args)...);
 
         bytes += sizeof(T);
 
@@ -927,7 +948,8 @@ public:
         std::swap(num_deletes, other.num_deletes);
         std::swap(num_entries, other.num_entries);
 
-        std::swap(allocator, allocator);
+        std::swap(allocator, other.allocator);
+        std::swap(bytes, other.bytes);
 
         insert_value_space.swap(other.insert_value_space);
     }
@@ -1020,12 +1042,13 @@ DT_CLASS::DeltaTree(const DT_CLASS::Self & o)
     , num_deletes(o.num_deletes)
     , num_entries(o.num_entries)
     , allocator(new Allocator())
+    , insert_value_space(o.insert_value_space)
 {
     NodePtr my_root;
     if (isLeaf(o.root))
-        my_root = new (createNode<Leaf>()) Leaf(*as(Leaf, o.root));
+        my_root = createNode<Leaf>(*as(Leaf, o.root));
     else
-        my_root = new (createNode<Intern>()) Intern(*as(Intern, o.root));
+        my_root = createNode<Intern>(*as(Intern, o.root));
 
     std::queue<NodePtr> nodes;
     nodes.push(my_root);
@@ -1058,7 +1081,7 @@ DT_CLASS::DeltaTree(const DT_CLASS::Self & o)
             {
                 for (size_t i = 0; i < intern->count; ++i)
                 {
-                    auto child = new (createNode<Leaf>()) Leaf(*as(Leaf, intern->children[i]));
+                    auto child = createNode<Leaf>(*as(Leaf, intern->children[i]));
                     nodes.push(child);
                     intern->children[i] = child;
 
@@ -1069,7 +1092,7 @@ DT_CLASS::DeltaTree(const DT_CLASS::Self & o)
             {
                 for (size_t i = 0; i < intern->count; ++i)
                 {
-                    auto child = new (createNode<Intern>()) Intern(*as(Intern, intern->children[i]));
+                    auto child = createNode<Intern>(*as(Intern, intern->children[i]));
                     nodes.push(child);
                     intern->children[i] = child;
 
@@ -1278,12 +1301,12 @@ typename DT_CLASS::EntryIterator DT_CLASS::findLeaf(const UInt64 id) const
     {
         InternPtr intern = as(Intern, node);
         size_t i = 0;
-        for (; i < intern->count - 1; ++i)
+        if constexpr (is_rid)
         {
-            delta += intern->deltas[i];
-            bool ok;
-            if constexpr (is_rid)
+            for (; i < intern->count - 1; ++i)
             {
+                delta += intern->deltas[i];
+                bool ok;
                 if constexpr (is_left)
                 {
                     ok = id <= intern->rid(i, delta);
@@ -1292,23 +1315,18 @@ typename DT_CLASS::EntryIterator DT_CLASS::findLeaf(const UInt64 id) const
                 {
                     ok = id < intern->rid(i, delta);
                 }
-            }
-            else
-            {
-                if constexpr (is_left)
-                {
-                    ok = id <= intern->sid(i);
-                }
-                else
+                if (ok)
                 {
-                    ok = id < intern->sid(i);
+                    delta -= intern->deltas[i];
+                    break;
                 }
             }
-            if (ok)
-            {
-                delta -= intern->deltas[i];
-                break;
-            }
+        }
+        else
+        {
+            i = countSidsBefore<is_left>(intern->sids, intern->count - 1, id);
+            for (size_t j = 0; j < i; ++j)
+                delta += intern->deltas[j];
         }
         node = intern->children[i];
     }
@@ -1319,37 +1337,15 @@ DT_TEMPLATE
 template <bool is_rid, bool is_left>
 void DT_CLASS::searchId(EntryIterator & it, const UInt64 id) const
 {
-    EntryIterator leaf_end(this->end());
-    while (it != leaf_end)
+    /// Search inside the leaves directly, rather than stepping the iterator entry by entry.
+    LeafPtr leaf = it.getLeaf();
+    auto [pos, delta] = leaf->template search<is_rid, is_left>(id, it.getDelta(), it.getPos());
+    while (pos >= leaf->count && leaf->next)
     {
-        if constexpr (is_rid)
-        {
-            if constexpr (is_left)
-            {
-                if (id <= it.getRid())
-                    break;
-            }
-            else
-            {
-                if (id < it.getRid())
-                    break;
-            }
-        }
-        else
-        {
-            if constexpr (is_left)
-            {
-                if (id <= it.getSid())
-                    break;
-            }
-            else
-            {
-                if (id < it.getSid())
-                    break;
-            }
-        }
-        ++it;
+        leaf = leaf->next;
+        std::tie(pos, delta) = leaf->template search<is_rid, is_left>(id, delta);
     }
+    it = EntryIterator(leaf, pos, delta);
 }
 
 DT_TEMPLATE
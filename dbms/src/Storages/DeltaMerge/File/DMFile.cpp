@@ -603,14 +603,28 @@ void DMFile::readMetadata(const FileProviderPtr & file_provider, const ReadMetaM
     footer.meta_pack_info.column_stat_size = Poco::File(metaPath()).getSize();
     footer.meta_pack_info.pack_stat_size = recheck(Poco::File(packStatPath()).getSize());
 
-    if (read_meta_mode.needPackProperty() && footer.meta_pack_info.pack_property_size != 0)
-        readPackProperty(file_provider, footer.meta_pack_info);
-
     if (read_meta_mode.needColumnStat())
         readColumnStat(file_provider, footer.meta_pack_info);
 
+    if (read_meta_mode.loadPackLazily() && (read_meta_mode.needPackStat() || read_meta_mode.needPackProperty()))
+    {
+        // The pack stats and pack properties are separated files in this format, defer reading
+        // them so that restoring a large number of DMFiles only touches the column stats.
+        lazy_pack_loader = [this, file_provider, meta_pack_info = footer.meta_pack_info, read_meta_mode] {
+            readPackStatAndProperty(file_provider, meta_pack_info, read_meta_mode);
+        };
+        return;
+    }
+    readPackStatAndProperty(file_provider, footer.meta_pack_info, read_meta_mode);
+}
+
+void DMFile::readPackStatAndProperty(const FileProviderPtr & file_provider, const MetaPackInfo & meta_pack_info, const ReadMetaMode & read_meta_mode)
+{
+    if (read_meta_mode.needPackProperty() && meta_pack_info.pack_property_size != 0)
+        readPackProperty(file_provider, meta_pack_info);
+
     if (read_meta_mode.needPackStat())
-        readPackStat(file_provider, footer.meta_pack_info);
+        readPackStat(file_provider, meta_pack_info);
 }
 
 void DMFile::finalizeForFolderMode(const FileProviderPtr & file_provider, const WriteLimiterPtr & write_limiter)
@@ -28,6 +28,10 @@
 #include <Storages/S3/S3Filename.h>
 #include <Storages/S3/S3RandomAccessFile.h>
 #include <common/logger_useful.h>
+
+#include <functional>
+#include <mutex>
+
 namespace DB::DM
 {
 class DMFile;
@@ -82,6 +86,8 @@ public:
         static constexpr size_t READ_COLUMN_STAT = 0x01;
         static constexpr size_t READ_PACK_STAT = 0x02;
         static constexpr size_t READ_PACK_PROPERTY = 0x04;
+        // Defer reading the pack stats and pack properties until they are first accessed.
+        static constexpr size_t LOAD_PACK_LAZILY = 0x08;
 
         size_t value;
 
@@ -109,10 +115,17 @@ public:
         {
             return ReadMetaMode(READ_COLUMN_STAT | READ_PACK_STAT);
         }
+        // Same as `all`, but the pack stats and pack properties are read from disk on first access.
+        // Used when restoring a large number of DMFiles at startup.
+        static ReadMetaMode allWithLazyPack()
+        {
+            return ReadMetaMode(READ_COLUMN_STAT | READ_PACK_STAT | READ_PACK_PROPERTY | LOAD_PACK_LAZILY);
+        }
 
         inline bool needColumnStat() const { return value & READ_COLUMN_STAT; }
         inline bool needPackStat() const { return value & READ_PACK_STAT; }
         inline bool needPackProperty() const { return value & READ_PACK_PROPERTY; }
+        inline bool loadPackLazily() const { return value & LOAD_PACK_LAZILY; }
 
         inline bool isNone() const { return value == READ_NONE; }
         inline bool isAll() const { return needColumnStat() && needPackStat() && needPackProperty(); }
@@ -268,7 +281,7 @@ public:
     size_t getRows() const
     {
         size_t rows = 0;
-        for (const auto & s : pack_stats)
+        for (const auto & s : getPackStats())
             rows += s.rows;
         return rows;
     }
@@ -276,7 +289,7 @@ public:
     size_t getBytes() const
     {
         size_t bytes = 0;
-        for (const auto & s : pack_stats)
+        for (const auto & s : getPackStats())
             bytes += s.bytes;
         return bytes;
     }
@@ -291,9 +304,17 @@ public:
         return bytes;
     }
 
-    size_t getPacks() const { return pack_stats.size(); }
-    const PackStats & getPackStats() const { return pack_stats; }
-    PackProperties & getPackProperties() { return pack_properties; }
+    size_t getPacks() const { return getPackStats().size(); }
+    const PackStats & getPackStats() const
+    {
+        loadPackIfNeed();
+        return pack_stats;
+    }
+    PackProperties & getPackProperties()
+    {
+        loadPackIfNeed();
+        return pack_properties;
+    }
 
     const ColumnStat & getColumnStat(ColId col_id) const
     {
@@ -427,6 +448,13 @@ public:
 
     void writeMetadata(const FileProviderPtr & file_provider, const WriteLimiterPtr & write_limiter);
     void readMetadata(const FileProviderPtr & file_provider, const ReadMetaMode & read_meta_mode);
+    void readPackStatAndProperty(const FileProviderPtr & file_provider, const MetaPackInfo & meta_pack_info, const ReadMetaMode & read_meta_mode);
+    // Read the pack stats and pack properties deferred by `ReadMetaMode::allWithLazyPack`.
+    void loadPackIfNeed() const
+    {
+        if (lazy_pack_loader)
+            std::call_once(lazy_pack_loaded, [this] { lazy_pack_loader(); });
+    }
 
     void upgradeMetaIfNeed(const FileProviderPtr & file_provider, DMFileFormat::Version ver);
 
@@ -479,8 +507,13 @@ public:
     UInt64 page_id;
     String parent_path;
 
-    PackStats pack_stats;
-    PackProperties pack_properties;
+    // Could be filled lazily by `loadPackIfNeed`, always access them through
+    // `getPackStats`/`getPackProperties` unless the DMFile is being written.
+    mutable PackStats pack_stats;
+    mutable PackProperties pack_properties;
+    // Set only when the pack stats are deferred at restore, never changed afterwards.
+    std::function<void()> lazy_pack_loader;
+    mutable std::once_flag lazy_pack_loaded;
     ColumnStats column_stats;
     std::unordered_set<ColId> column_indices;
 
@@ -68,6 +68,8 @@ DMFileBlockInputStreamPtr DMFileBlockInputStreamBuilder::build(const DMFilePtr &
         column_cache,
         aio_threshold,
         max_read_buffer_size,
+        read_ahead_packs,
+        max_read_ahead_bytes,
         file_provider,
         read_limiter,
         rows_threshold_per_read,
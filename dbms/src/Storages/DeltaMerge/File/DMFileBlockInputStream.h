@@ -160,6 +160,8 @@ private:
         enable_column_cache = settings.dt_enable_stable_column_cache;
         aio_threshold = settings.min_bytes_to_use_direct_io;
         max_read_buffer_size = settings.max_read_buffer_size;
+        read_ahead_packs = settings.dt_read_ahead_packs;
+        max_read_ahead_bytes = settings.dt_max_read_ahead_bytes;
         enable_read_thread = settings.dt_enable_read_thread;
         return *this;
     }
@@ -191,6 +193,8 @@ private:
     ReadLimiterPtr read_limiter;
     size_t aio_threshold{};
     size_t max_read_buffer_size{};
+    size_t read_ahead_packs = 0;
+    size_t max_read_ahead_bytes = 0;
     size_t rows_threshold_per_read = DMFILE_READ_ROWS_THRESHOLD;
     bool read_one_pack_every_time = false;
     bool enable_read_thread = false;
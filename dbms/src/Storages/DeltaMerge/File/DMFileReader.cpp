@@ -15,6 +15,7 @@
 #include <Columns/ColumnsCommon.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/Stopwatch.h>
+#include <Common/TiFlashMetrics.h>
 #include <Common/escapeForFileName.h>
 #include <DataTypes/IDataType.h>
 #include <Encryption/FileProvider.h>
@@ -90,7 +91,7 @@ DMFileReader::Stream::Stream(
         marks = mark_load();
 
     auto is_null_map = endsWith(file_name_base, ".null");
-    size_t data_file_size = reader.dmfile->colDataSize(col_id, is_null_map);
+    data_file_size = reader.dmfile->colDataSize(col_id, is_null_map);
     size_t packs = reader.dmfile->getPacks();
     size_t buffer_size = 0;
     size_t estimated_size = 0;
@@ -169,6 +170,57 @@ DMFileReader::Stream::Stream(
     }
 }
 
+size_t DMFileReader::Stream::prefetch(size_t pack_id) const
+{
+    const size_t packs = marks->size();
+    const size_t begin = getOffsetInFile(pack_id);
+    // Find the end of the compressed blocks that contain the rows of the pack, like reading a range of packs.
+    size_t end_pack_id = pack_id + 1;
+    while (end_pack_id < packs && getOffsetInFile(end_pack_id) == begin)
+        ++end_pack_id;
+    if (end_pack_id < packs && getOffsetInDecompressedBlock(end_pack_id) > 0)
+    {
+        const size_t last_offset_in_file = getOffsetInFile(end_pack_id);
+        while (end_pack_id < packs && getOffsetInFile(end_pack_id) == last_offset_in_file)
+            ++end_pack_id;
+    }
+    const size_t end = (end_pack_id == packs) ? data_file_size : getOffsetInFile(end_pack_id);
+    return end > begin ? buf->prefetch(begin, end - begin) : 0;
+}
+
+DMFileReadAheadWindow::~DMFileReadAheadWindow()
+{
+    if (pending_bytes > 0)
+        GET_METRIC(tiflash_storage_read_ahead_bytes, type_wasted).Increment(pending_bytes);
+}
+
+void DMFileReadAheadWindow::addHinted(size_t pack_id, size_t bytes)
+{
+    pending_packs.emplace_back(pack_id, bytes);
+    pending_bytes += bytes;
+    GET_METRIC(tiflash_storage_read_ahead_bytes, type_hint).Increment(bytes);
+}
+
+void DMFileReadAheadWindow::onRead(size_t start_pack_id, size_t end_pack_id)
+{
+    size_t hit_bytes = 0;
+    size_t wasted_bytes = 0;
+    while (!pending_packs.empty() && pending_packs.front().first < end_pack_id)
+    {
+        const auto [pack_id, bytes] = pending_packs.front();
+        pending_packs.pop_front();
+        pending_bytes -= bytes;
+        if (pack_id >= start_pack_id)
+            hit_bytes += bytes;
+        else
+            wasted_bytes += bytes;
+    }
+    if (hit_bytes > 0)
+        GET_METRIC(tiflash_storage_read_ahead_bytes, type_hit).Increment(hit_bytes);
+    if (wasted_bytes > 0)
+        GET_METRIC(tiflash_storage_read_ahead_bytes, type_wasted).Increment(wasted_bytes);
+}
+
 DMFileReader::DMFileReader(
     const DMFilePtr & dmfile_,
     const ColumnDefines & read_columns_,
@@ -186,6 +238,8 @@ DMFileReader::DMFileReader(
     const ColumnCachePtr & column_cache_,
     size_t aio_threshold,
     size_t max_read_buffer_size,
+    size_t read_ahead_packs,
+    size_t max_read_ahead_bytes,
     const FileProviderPtr & file_provider_,
     const ReadLimiterPtr & read_limiter,
     size_t rows_threshold_per_read_,
@@ -208,6 +262,7 @@ DMFileReader::DMFileReader(
     , column_cache(column_cache_)
     , scan_context(scan_context_)
     , rows_threshold_per_read(rows_threshold_per_read_)
+    , read_ahead_window(read_ahead_packs, max_read_ahead_bytes)
     , file_provider(file_provider_)
     , log(Logger::get(tracing_id_))
 {
@@ -249,6 +304,26 @@ bool DMFileReader::shouldSeek(size_t pack_id)
     return pack_id != 0 && !pack_filter.getUsePacks()[pack_id - 1];
 }
 
+void DMFileReader::readAhead()
+{
+    if (!read_ahead_window.enabled())
+        return;
+
+    const auto & use_packs = pack_filter.getUsePacks();
+    const auto [begin, end] = read_ahead_window.getRangeToHint(next_pack_id, use_packs.size());
+    for (size_t pack_id = begin; pack_id < end && !read_ahead_window.isFull(); ++pack_id)
+    {
+        read_ahead_window.setHintedEnd(pack_id + 1);
+        if (!use_packs[pack_id])
+            continue;
+        size_t bytes = 0;
+        for (const auto & [name, stream] : column_streams)
+            bytes += stream->prefetch(pack_id);
+        if (bytes > 0)
+            read_ahead_window.addHinted(pack_id, bytes);
+    }
+}
+
 bool DMFileReader::getSkippedRows(size_t & skip_rows)
 {
     skip_rows = 0;
@@ -466,6 +541,11 @@ Block DMFileReader::read()
     if (read_rows == 0)
         return {};
 
+    // Hint the packs after the packs to read now, they are read from disk while the packs are
+    // decompressed and processed.
+    read_ahead_window.onRead(start_pack_id, next_pack_id);
+    readAhead();
+
     Block res;
     res.setStartOffset(start_row_offset);
 
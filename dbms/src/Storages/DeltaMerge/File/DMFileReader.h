@@ -27,6 +27,9 @@
 #include <Storages/DeltaMerge/ScanContext.h>
 #include <Storages/MarkCache.h>
 
+#include <deque>
+#include <utility>
+
 namespace DB
 {
 namespace DM
@@ -36,6 +39,55 @@ using RSOperatorPtr = std::shared_ptr<RSOperator>;
 
 inline static const size_t DMFILE_READ_ROWS_THRESHOLD = DEFAULT_MERGE_BLOCK_SIZE * 3;
 
+/// The packs hinted to be read ahead but not read yet, used to bound the read-ahead and count the
+/// bytes that are hinted but never read.
+class DMFileReadAheadWindow
+{
+public:
+    DMFileReadAheadWindow(size_t max_packs_, size_t max_bytes_)
+        : max_packs(max_packs_)
+        , max_bytes(max_bytes_)
+    {}
+
+    DMFileReadAheadWindow(DMFileReadAheadWindow && rhs) noexcept
+        : max_packs(rhs.max_packs)
+        , max_bytes(rhs.max_bytes)
+        , hinted_end_pack_id(rhs.hinted_end_pack_id)
+        , pending_packs(std::move(rhs.pending_packs))
+        , pending_bytes(std::exchange(rhs.pending_bytes, 0))
+    {
+        rhs.pending_packs.clear();
+    }
+
+    /// The pending packs are never read.
+    ~DMFileReadAheadWindow();
+
+    bool enabled() const { return max_packs > 0 && max_bytes > 0; }
+
+    /// Return the range of packs [begin, end) that can be hinted when the next pack to read is `next_pack_id`.
+    std::pair<size_t, size_t> getRangeToHint(size_t next_pack_id, size_t pack_count) const
+    {
+        return {std::max(hinted_end_pack_id, next_pack_id), std::min(pack_count, next_pack_id + max_packs)};
+    }
+    bool isFull() const { return pending_bytes >= max_bytes; }
+    void addHinted(size_t pack_id, size_t bytes);
+    void setHintedEnd(size_t pack_id) { hinted_end_pack_id = pack_id; }
+
+    /// The packs in [start_pack_id, end_pack_id) are read, and the hinted packs before them are skipped.
+    void onRead(size_t start_pack_id, size_t end_pack_id);
+
+    size_t getPendingBytes() const { return pending_bytes; }
+
+private:
+    const size_t max_packs;
+    const size_t max_bytes;
+    // The packs before it have been considered.
+    size_t hinted_end_pack_id = 0;
+    // (pack_id, bytes) in the order of pack_id.
+    std::deque<std::pair<size_t, size_t>> pending_packs;
+    size_t pending_bytes = 0;
+};
+
 class DMFileReader
 {
 public:
@@ -63,7 +115,12 @@ public:
             return (*marks)[i].offset_in_decompressed_block;
         }
 
+        /// Hint the OS to read the compressed data of the pack in background.
+        /// Return the number of bytes hinted.
+        size_t prefetch(size_t pack_id) const;
+
         std::unique_ptr<CompressedSeekableReaderBuffer> buf;
+        size_t data_file_size;
     };
     using StreamPtr = std::unique_ptr<Stream>;
     using ColumnStreams = std::map<String, StreamPtr>;
@@ -89,6 +146,9 @@ public:
         const ColumnCachePtr & column_cache_,
         size_t aio_threshold,
         size_t max_read_buffer_size,
+        // read ahead, 0 means disabled
+        size_t read_ahead_packs,
+        size_t max_read_ahead_bytes,
         const FileProviderPtr & file_provider_,
         const ReadLimiterPtr & read_limiter,
         size_t rows_threshold_per_read_,
@@ -123,6 +183,10 @@ public:
 private:
     bool shouldSeek(size_t pack_id);
 
+    /// Hint the OS to read the next packs to be read in background, so that reading from disk
+    /// overlaps with decompressing and processing the packs read.
+    void readAhead();
+
     void readFromDisk(ColumnDefine & column_define,
                       MutableColumnPtr & column,
                       size_t start_pack_id,
@@ -174,6 +238,8 @@ private:
     size_t next_pack_id = 0;
     size_t next_row_offset = 0;
 
+    DMFileReadAheadWindow read_ahead_window;
+
     FileProviderPtr file_provider;
 
     LoggerPtr log;
@@ -145,6 +145,8 @@ RSOperatorPtr createNotLike(const Attr & attr, const Field & values);
 //
 RSOperatorPtr createIsNull(const Attr & attr);
 //
+RSOperatorPtr createTopN(const Attr & attr, const Field & value, bool desc);
+//
 RSOperatorPtr createUnsupported(const String & content, const String & reason, bool is_not);
 
 
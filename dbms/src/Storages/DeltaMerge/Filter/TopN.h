@@ -0,0 +1,64 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
+
+namespace DB
+{
+namespace DM
+{
+/// Skip the packs that can not contain any row of the result of a TopN, `value` is the threshold of
+/// the TopN (see `TopNThreshold`). Like TiDB, NULL is less than any other value.
+class TopN : public ColCmpVal
+{
+    bool desc;
+
+public:
+    TopN(const Attr & attr_, const Field & value_, bool desc_)
+        : ColCmpVal(attr_, value_, /*null_direction*/ -1)
+        , desc(desc_)
+    {}
+
+    String name() override { return desc ? "topn_desc" : "topn_asc"; }
+
+    RSResult roughCheck(size_t pack_id, const RSCheckParam & param) override
+    {
+        GET_RSINDEX_FROM_PARAM_NOT_FOUND_RETURN_SOME(param, attr, rsindex);
+        if (!desc)
+        {
+            // The NULL values are the first ones in ascending order.
+            if (rsindex.minmax->checkIsNull(pack_id) != None)
+                return Some;
+            // The threshold is NULL, only the NULL values are needed.
+            if (value.isNull())
+                return None;
+            // value <= threshold
+            return !rsindex.minmax->checkGreater(pack_id, value, rsindex.type, null_direction);
+        }
+        else
+        {
+            // The threshold is NULL, any value is not after it.
+            if (value.isNull())
+                return Some;
+            // value >= threshold
+            return rsindex.minmax->checkGreaterEqual(pack_id, value, rsindex.type, null_direction);
+        }
+    }
+};
+
+} // namespace DM
+
+} // namespace DB
@@ -18,6 +18,7 @@
 #include <Common/UniThreadPool.h>
 #include <DataStreams/IBlockInputStream.h>
 #include <DataStreams/NullBlockInputStream.h>
+#include <Flash/Coprocessor/CHBlockChunkCodecV1.h>
 #include <IO/IOThreadPools.h>
 #include <IO/ReadBufferFromMemory.h>
 #include <IO/ReadBufferFromString.h>
@@ -473,8 +474,24 @@ void RNRemoteSegmentReadTask::initColumnFileDataProvider(Remote::RNLocalPageCach
         table_id);
 }
 
+void RNRemoteSegmentReadTask::decompressPage(RemotePb::RemotePage & remote_page)
+{
+    if (remote_page.uncompressed_size() == 0)
+        return;
+
+    ReadBufferFromString compressed_buf(remote_page.data());
+    CompressedCHBlockChunkReadBuffer decompress_buf(compressed_buf);
+    String uncompressed(remote_page.uncompressed_size(), '\0');
+    decompress_buf.readStrict(uncompressed.data(), uncompressed.size());
+    *remote_page.mutable_data() = std::move(uncompressed);
+    remote_page.set_uncompressed_size(0);
+}
+
 void RNRemoteSegmentReadTask::receivePage(RemotePb::RemotePage && remote_page)
 {
+    // Decompress before acquiring the lock so that pages can be decompressed concurrently.
+    decompressPage(remote_page);
+
     std::lock_guard lock(mtx_queue);
     const size_t buf_size = remote_page.data().size();
 
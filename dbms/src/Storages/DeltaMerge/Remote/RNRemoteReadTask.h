@@ -226,6 +226,9 @@ public:
 
     void receivePage(RemotePb::RemotePage && remote_page);
 
+    /// The page data may be compressed by the write node, decompress it in place.
+    static void decompressPage(RemotePb::RemotePage & remote_page);
+
     void receiveMemTable(Block && block)
     {
         // Keep the block in memory for reading (multiple times)
@@ -24,6 +24,7 @@
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Poco/Logger.h>
 #include <Storages/DeltaMerge/BitmapFilter/BitmapFilterBlockInputStream.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
 #include <Storages/DeltaMerge/DMContext.h>
 #include <Storages/DeltaMerge/DMDecoratorStreams.h>
 #include <Storages/DeltaMerge/DMVersionFilterBlockInputStream.h>
@@ -327,15 +328,41 @@ SegmentPtr Segment::restoreSegment( //
 
     ReadBufferFromMemory buf(page.data.begin(), page.data.size());
     Segment::SegmentMetaInfo segment_info;
+    segment_info.segment_id = segment_id;
     readSegmentMetaInfo(buf, segment_info);
 
+    return restoreSegment(parent_log, context, segment_info);
+}
+
+SegmentPtr Segment::restoreSegment( //
+    const LoggerPtr & parent_log,
+    DMContext & context,
+    const SegmentMetaInfo & segment_info)
+{
     auto delta = DeltaValueSpace::restore(context, segment_info.range, segment_info.delta_id);
     auto stable = StableValueSpace::restore(context, segment_info.stable_id);
-    auto segment = std::make_shared<Segment>(parent_log, segment_info.epoch, segment_info.range, segment_id, segment_info.next_segment_id, delta, stable);
+    auto segment = std::make_shared<Segment>(parent_log, segment_info.epoch, segment_info.range, segment_info.segment_id, segment_info.next_segment_id, delta, stable);
 
     return segment;
 }
 
+Segment::SegmentMetaInfos Segment::readAllSegmentsMetaInfo(DMContext & context, PageIdU64 first_segment_id)
+{
+    SegmentMetaInfos segment_infos;
+    PageIdU64 current_segment_id = first_segment_id;
+    while (current_segment_id != 0)
+    {
+        Page page = context.storage_pool->metaReader()->read(current_segment_id); // not limit restore
+        ReadBufferFromMemory buf(page.data.begin(), page.data.size());
+        Segment::SegmentMetaInfo segment_info;
+        segment_info.segment_id = current_segment_id;
+        readSegmentMetaInfo(buf, segment_info);
+        current_segment_id = segment_info.next_segment_id;
+        segment_infos.emplace_back(std::move(segment_info));
+    }
+    return segment_infos;
+}
+
 Segment::SegmentMetaInfos Segment::readAllSegmentsMetaInfoInRange( //
     DMContext & context,
     NamespaceId ns_id,
@@ -429,10 +456,10 @@ void Segment::serialize(WriteBatchWrapper & wb)
     wb.putPage(segment_id, 0, buf.tryGetReadBuffer(), data_size);
 }
 
-bool Segment::writeToDisk(DMContext & dm_context, const ColumnFilePtr & column_file)
+bool Segment::writeToDisk(DMContext & dm_context, const ColumnFilePtr & column_file, UInt64 max_version)
 {
     LOG_TRACE(log, "Segment write to disk, rows={} isBigFile={}", column_file->getRows(), column_file->isBigFile());
-    return delta->appendColumnFile(dm_context, column_file);
+    return delta->appendColumnFile(dm_context, column_file, max_version);
 }
 
 bool Segment::writeToCache(DMContext & dm_context, const Block & block, size_t offset, size_t limit)
@@ -451,7 +478,7 @@ bool Segment::write(DMContext & dm_context, const Block & block, bool flush_cach
     auto column_file = ColumnFileTiny::writeColumnFile(dm_context, block, 0, block.rows(), wbs);
     wbs.writeAll();
 
-    if (delta->appendColumnFile(dm_context, column_file))
+    if (delta->appendColumnFile(dm_context, column_file, DeltaValueSpace::getMaxDataVersion(block, 0, block.rows())))
     {
         if (flush_cache)
         {
@@ -571,7 +598,11 @@ bool Segment::ingestDataToDelta(
         if (column_file->getRows() != 0)
             column_files.emplace_back(std::move(column_file));
     }
-    return delta->ingestColumnFiles(dm_context, range, column_files, clear_data_in_range);
+    // The max version is only used by the bitmap filter cache, don't read the files for it if the cache is disabled.
+    const auto max_version = dm_context.db_context.getBitmapFilterCache()
+        ? StableValueSpace::getDMFilesMaxVersion(dm_context, data_files)
+        : DeltaValueSpace::UNKNOWN_DATA_VERSION;
+    return delta->ingestColumnFiles(dm_context, range, column_files, clear_data_in_range, max_version);
 }
 
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
@@ -1063,6 +1094,8 @@ SegmentPtr Segment::applyMergeDelta(const Segment::Lock & lock, //
         delta->getId(),
         persisted_column_files,
         in_memory_files);
+    // The newly appended column files are not merged into the new stable.
+    new_delta->setInitialMaxDataVersion(delta->getMaxAppendedDataVersion());
     new_delta->saveMeta(wbs);
 
     auto new_me = std::make_shared<Segment>( //
@@ -1118,6 +1151,7 @@ SegmentPtr Segment::replaceData(const Segment::Lock & lock, //
         delta->getId(),
         persisted_files,
         in_memory_files);
+    new_delta->setInitialMaxDataVersion(delta->getMaxAppendedDataVersion());
     new_delta->saveMeta(wbs);
 
     auto new_stable = std::make_shared<StableValueSpace>(stable->getId());
@@ -1761,6 +1795,9 @@ SegmentPair Segment::applySplit( //
         other_delta_id,
         other_persisted_files,
         other_in_memory_files);
+    const auto delta_max_version = split_info.is_logical ? delta->getMaxDataVersion() : delta->getMaxAppendedDataVersion();
+    my_delta->setInitialMaxDataVersion(delta_max_version);
+    other_delta->setInitialMaxDataVersion(delta_max_version);
 
     auto new_me = std::make_shared<Segment>( //
         parent_log,
@@ -1944,6 +1981,10 @@ SegmentPtr Segment::applyMerge(const std::vector<Segment::Lock> & locks, //
         first_seg->delta->getId(),
         merged_persisted_column_files,
         merged_in_memory_files);
+    UInt64 merged_delta_max_version = 0;
+    for (const auto & seg : ordered_segments)
+        merged_delta_max_version = std::max(merged_delta_max_version, seg->delta->getMaxAppendedDataVersion());
+    merged_delta->setInitialMaxDataVersion(merged_delta_max_version);
 
     auto merged = std::make_shared<Segment>( //
         first_seg->parent_log,
@@ -2463,14 +2504,48 @@ BitmapFilterPtr Segment::buildBitmapFilter(const DMContext & dm_context,
 {
     RUNTIME_CHECK_MSG(!dm_context.read_delta_only, "Read delta only is unsupported");
 
-    if (dm_context.read_stable_only || (segment_snap->delta->getRows() == 0 && segment_snap->delta->getDeletes() == 0))
-    {
-        return buildBitmapFilterStableOnly(dm_context, segment_snap, read_ranges, filter, max_version, expected_block_size);
-    }
-    else
+    auto build = [&](const RSOperatorPtr & rs_operator) {
+        if (dm_context.read_stable_only || (segment_snap->delta->getRows() == 0 && segment_snap->delta->getDeletes() == 0))
+        {
+            return buildBitmapFilterStableOnly(dm_context, segment_snap, read_ranges, rs_operator, max_version, expected_block_size);
+        }
+        else
+        {
+            return buildBitmapFilterNormal(dm_context, segment_snap, read_ranges, rs_operator, max_version, expected_block_size);
+        }
+    };
+
+    auto cache = dm_context.db_context.getBitmapFilterCache();
+    if (!cache)
+        return build(filter);
+
+    // The bitmap filter of a read can be shared with the others only if all the data of the segment are
+    // visible to it, i.e. the bitmap filter does not depend on `max_version`.
+    // The upper bound of the versions of the delta is taken after the snapshot, so it is not less than the
+    // version of any data in the snapshot.
+    const auto data_max_version = std::max(stable->getMaxDataVersion(dm_context), delta->getMaxDataVersion());
+    if (max_version < data_max_version)
     {
-        return buildBitmapFilterNormal(dm_context, segment_snap, read_ranges, filter, max_version, expected_block_size);
+        GET_METRIC(tiflash_storage_bitmap_filter_cache, type_skip_put).Increment();
+        return build(filter);
     }
+
+    const auto key = BitmapFilterCache::getKey(
+        dm_context.physical_table_id,
+        segment_id,
+        epoch,
+        segment_snap->delta->getRows(),
+        segment_snap->delta->getDeletes(),
+        dm_context.read_stable_only,
+        read_ranges);
+    if (auto bitmap_filter = cache->tryGet(key, delta); bitmap_filter)
+        return bitmap_filter;
+
+    // The cached bitmap filter may be used by the reads with different filters, so it is built
+    // without the rough set filter. The packs are still filtered by the rough set filter when reading.
+    auto bitmap_filter = build(EMPTY_RS_OPERATOR);
+    cache->put(key, delta, bitmap_filter);
+    return bitmap_filter;
 }
 
 BitmapFilterPtr Segment::buildBitmapFilterNormal(const DMContext & dm_context,
@@ -155,6 +155,14 @@ public:
     };
 
     using SegmentMetaInfos = std::vector<SegmentMetaInfo>;
+
+    // Restore the segment from a meta info that has been read before, so that the
+    // segment chain can be walked first and the segments restored concurrently.
+    static SegmentPtr restoreSegment(const LoggerPtr & parent_log, DMContext & context, const SegmentMetaInfo & segment_info);
+
+    // Read the meta info of all segments by walking the segment chain from `first_segment_id`.
+    // Only the segment meta pages are read, the delta and stable are not restored.
+    static SegmentMetaInfos readAllSegmentsMetaInfo(DMContext & context, PageIdU64 first_segment_id);
     static SegmentMetaInfos readAllSegmentsMetaInfoInRange( //
         DMContext & context,
         NamespaceId ns_id,
@@ -178,7 +186,8 @@ public:
     /// Attach a new ColumnFile into the Segment. The ColumnFile will be added to MemFileSet and flushed to disk later.
     /// The block data of the passed in ColumnFile should be placed on disk before calling this function.
     /// To write new block data, you can use `writeToCache`.
-    bool writeToDisk(DMContext & dm_context, const ColumnFilePtr & column_file);
+    /// `max_version` is the max commit version of the data in `column_file`.
+    bool writeToDisk(DMContext & dm_context, const ColumnFilePtr & column_file, UInt64 max_version);
 
     /// Write a block of data into the MemTableSet part of the Segment. The data will be flushed to disk later.
     bool writeToCache(DMContext & dm_context, const Block & block, size_t offset, size_t limit);
@@ -160,11 +160,32 @@ BlockInputStreamPtr SegmentReadTaskPool::buildInputStream(SegmentReadTaskPtr & t
     MemoryTrackerSetter setter(true, mem_tracker.get());
     BlockInputStreamPtr stream;
     auto block_size = std::max(expected_block_size, static_cast<size_t>(dm_context->db_context.getSettingsRef().dt_segment_stable_pack_rows));
-    stream = t->segment->getInputStream(read_mode, *dm_context, columns_to_read, t->read_snapshot, t->ranges, filter, max_version, block_size);
+    stream = t->segment->getInputStream(read_mode, *dm_context, columns_to_read, t->read_snapshot, t->ranges, getFilterForSegment(filter), max_version, block_size);
     LOG_DEBUG(log, "getInputStream succ, read_mode={}, pool_id={} segment_id={}", magic_enum::enum_name(read_mode), pool_id, t->segment->segmentId());
     return stream;
 }
 
+PushDownFilterPtr SegmentReadTaskPool::getFilterForSegment(const PushDownFilterPtr & filter_) const
+{
+    if (!limit_hint.topn_threshold)
+        return filter_;
+    auto threshold = limit_hint.topn_threshold->get();
+    if (!threshold)
+        return filter_;
+
+    // The threshold is fixed when reading a segment, so that all the streams of the segment skip the same packs.
+    auto topn_filter = createTopN(limit_hint.topn_attr, *threshold, limit_hint.topn_threshold->isDesc());
+    if (!filter_)
+        return std::make_shared<PushDownFilter>(topn_filter);
+    auto rs_operator = filter_->rs_operator ? createAnd({filter_->rs_operator, topn_filter}) : topn_filter;
+    return std::make_shared<PushDownFilter>(
+        rs_operator,
+        filter_->before_where,
+        filter_->filter_columns,
+        filter_->filter_column_name,
+        filter_->extra_cast);
+}
+
 void SegmentReadTaskPool::finishSegment(const SegmentPtr & seg)
 {
     after_segment_read(dm_context, seg);
@@ -173,16 +194,21 @@ void SegmentReadTaskPool::finishSegment(const SegmentPtr & seg)
         std::lock_guard lock(mutex);
         active_segment_ids.erase(seg->segmentId());
         pool_finished = active_segment_ids.empty() && tasks_wrapper.empty();
+        if (pool_finished)
+        {
+            finishQueueUnlock();
+        }
     }
     LOG_DEBUG(log, "finishSegment pool_id={} segment_id={} pool_finished={}", pool_id, seg->segmentId(), pool_finished);
-    if (pool_finished)
-    {
-        q.finish();
-    }
 }
 
 SegmentReadTaskPtr SegmentReadTaskPool::nextTask()
 {
+    // Enough rows are read, skip the rest segments.
+    if (isLimitReached())
+    {
+        return nullptr;
+    }
     std::lock_guard lock(mutex);
     return tasks_wrapper.nextTask();
 }
@@ -285,7 +311,60 @@ void SegmentReadTaskPool::pushBlock(Block && block)
 {
     blk_stat.push(block);
     global_blk_stat.push(block);
-    q.push(std::move(block), nullptr);
+    auto rows = block.rows();
+    if (!q.push(std::move(block), nullptr))
+    {
+        // The queue is finished because of the limit or an exception, `block` is not moved.
+        blk_stat.pop(block);
+        global_blk_stat.pop(block);
+        return;
+    }
+    if (addReadRows(rows))
+    {
+        // Let the readers finish as soon as the blocks in the queue are consumed. The segments being read
+        // will be stopped by `valid()` and the rest segments will not be scheduled.
+        std::lock_guard lock(mutex);
+        finishQueueUnlock();
+    }
+}
+
+void SegmentReadTaskPool::finishQueueUnlock()
+{
+    if (!q_finished)
+    {
+        q_finished = true;
+        q.finish();
+    }
+}
+
+bool SegmentReadTaskPool::addReadRows(size_t rows)
+{
+    if (!limit_hint.hasLimit())
+    {
+        return false;
+    }
+    auto prev_rows = read_rows.fetch_add(rows, std::memory_order_relaxed);
+    if (prev_rows < limit_hint.rows && prev_rows + rows >= limit_hint.rows)
+    {
+        LOG_DEBUG(log, "Limit reached, pool_id={} limit={} read_rows={}", pool_id, limit_hint.rows, prev_rows + rows);
+    }
+    return prev_rows + rows >= limit_hint.rows;
+}
+
+bool SegmentReadTaskPool::isLimitReached() const
+{
+    return limit_hint.hasLimit() && read_rows.load(std::memory_order_relaxed) >= limit_hint.rows;
+}
+
+bool SegmentReadTaskPool::canStopReadingSegment() const
+{
+    // In the descending order, the rows of a segment are still read in ascending order, so the whole
+    // segment is needed. The same to the modes that the rows are not sorted in a segment.
+    if (limit_hint.in_handle_order)
+    {
+        return !limit_hint.desc && read_mode == ReadMode::Normal;
+    }
+    return true;
 }
 
 Int64 SegmentReadTaskPool::increaseUnorderedInputStreamRefCount()
@@ -320,7 +399,7 @@ bool SegmentReadTaskPool::exceptionHappened() const
 
 bool SegmentReadTaskPool::valid() const
 {
-    return !exceptionHappened() && unordered_input_stream_ref_count.load(std::memory_order_relaxed) > 0;
+    return !exceptionHappened() && !isLimitReached() && unordered_input_stream_ref_count.load(std::memory_order_relaxed) > 0;
 }
 void SegmentReadTaskPool::setException(const DB::Exception & e)
 {
@@ -329,7 +408,7 @@ void SegmentReadTaskPool::setException(const DB::Exception & e)
     {
         exception = e;
         exception_happened.store(true, std::memory_order_relaxed);
-        q.finish();
+        finishQueueUnlock();
     }
 }
 
@@ -14,6 +14,7 @@
 
 #pragma once
 #include <Common/MemoryTrackerSetter.h>
+#include <DataStreams/TopNThreshold.h>
 #include <Storages/DeltaMerge/DMContext.h>
 #include <Storages/DeltaMerge/Filter/PushDownFilter.h>
 #include <Storages/DeltaMerge/ReadThread/WorkQueue.h>
@@ -133,6 +134,25 @@ enum class ReadMode
     Bitmap,
 };
 
+// The LIMIT/TopN pushed down to the read path. Reading stops once `rows` rows are read.
+struct ReadLimitHint
+{
+    // 0 means no limit.
+    size_t rows = 0;
+    // The segments are read one by one in the order of handle, descending if `desc` is true.
+    // So that the first `rows` rows in the order of handle are contained in the segments read.
+    bool in_handle_order = false;
+    bool desc = false;
+
+    // The threshold of the TopN ordered by the column `topn_attr`, the packs that all rows are after
+    // the threshold are skipped. The threshold is tightened during reading, so it is checked again
+    // when starting to read a segment.
+    TopNThresholdPtr topn_threshold;
+    Attr topn_attr;
+
+    bool hasLimit() const { return rows > 0; }
+};
+
 // If `enable_read_thread_` is true, `SegmentReadTasksWrapper` use `std::unordered_map` to index `SegmentReadTask` by segment id,
 // else it is the same as `SegmentReadTasks`, a `std::list` of `SegmentReadTask`.
 // `SegmeneReadTasksWrapper` is not thread-safe.
@@ -171,7 +191,8 @@ public:
         AfterSegmentRead after_segment_read_,
         const String & tracing_id,
         bool enable_read_thread_,
-        Int64 num_streams_)
+        Int64 num_streams_,
+        const ReadLimitHint & limit_hint_ = {})
         : pool_id(nextPoolId())
         , table_id(table_id_)
         , dm_context(dm_context_)
@@ -193,6 +214,8 @@ public:
         // Limiting the minimum number of reading segments to 2 is to avoid, as much as possible,
         // situations where the computation may be faster and the storage layer may not be able to keep up.
         , active_segment_limit(std::max(num_streams_, 2))
+        , limit_hint(limit_hint_)
+        , read_rows(0)
     {}
 
     ~SegmentReadTaskPool()
@@ -241,6 +264,15 @@ public:
     bool valid() const;
     void setException(const DB::Exception & e);
 
+    // Return true if the limit is reached, no more segments need to be read.
+    bool addReadRows(size_t rows);
+    bool isLimitReached() const;
+    // Return true if the rest of the segments being read can be skipped when the limit is reached.
+    bool canStopReadingSegment() const;
+
+    // Return the filter used to read a new segment, which contains the current threshold of TopN.
+    PushDownFilterPtr getFilterForSegment(const PushDownFilterPtr & filter_) const;
+
     std::once_flag & addToSchedulerFlag()
     {
         return add_to_scheduler;
@@ -256,6 +288,7 @@ private:
     bool exceptionHappened() const;
     void finishSegment(const SegmentPtr & seg);
     void pushBlock(Block && block);
+    void finishQueueUnlock();
 
     const uint64_t pool_id;
     const int64_t table_id;
@@ -270,6 +303,8 @@ private:
     mutable std::mutex mutex;
     std::unordered_set<uint64_t> active_segment_ids;
     WorkQueue<Block> q;
+    // Protected by `mutex`, the queue is finished by the exception, the limit or all segments are read.
+    bool q_finished = false;
     BlockStat blk_stat;
     LoggerPtr log;
 
@@ -290,6 +325,9 @@ private:
     const Int64 block_slot_limit;
     const Int64 active_segment_limit;
 
+    const ReadLimitHint limit_hint;
+    std::atomic<size_t> read_rows;
+
     inline static std::atomic<uint64_t> pool_id_gen{1};
     inline static BlockStat global_blk_stat;
     static uint64_t nextPoolId()
@@ -128,7 +128,7 @@ StableValueSpacePtr StableValueSpace::restore(DMContext & context, PageIdU64 id)
             auto file_id = context.storage_pool->dataReader()->getNormalPageId(page_id);
             auto path_delegate = context.path_pool->getStableDiskDelegator();
             auto file_parent_path = path_delegate.getDTFilePath(file_id);
-            dmfile = DMFile::restore(context.db_context.getFileProvider(), file_id, page_id, file_parent_path, DMFile::ReadMetaMode::all());
+            dmfile = DMFile::restore(context.db_context.getFileProvider(), file_id, page_id, file_parent_path, DMFile::ReadMetaMode::allWithLazyPack());
             auto res = path_delegate.updateDTFileSize(file_id, dmfile->getBytesOnDisk());
             RUNTIME_CHECK_MSG(res, "update dt file size failed, path={}", dmfile->path());
         }
@@ -264,6 +264,43 @@ void StableValueSpace::recordRemovePacksPages(WriteBatches & wbs) const
     }
 }
 
+UInt64 StableValueSpace::getMaxDataVersion(const DMContext & context)
+{
+    auto version = max_data_version.load(std::memory_order_acquire);
+    if (version == std::numeric_limits<UInt64>::max())
+    {
+        // The files never change, it is fine to load it concurrently.
+        version = getDMFilesMaxVersion(context, files);
+        max_data_version.store(version, std::memory_order_release);
+    }
+    return version;
+}
+
+UInt64 StableValueSpace::getDMFilesMaxVersion(const DMContext & context, const DMFiles & dmfiles)
+{
+    UInt64 max_version = 0;
+    for (const auto & file : dmfiles)
+    {
+        const auto & pack_stats = file->getPackStats();
+        if (pack_stats.empty())
+            continue;
+        auto pack_filter = DMFilePackFilter::loadFrom(
+            file,
+            context.db_context.getGlobalContext().getMinMaxIndexCache(),
+            /*set_cache_if_miss*/ true,
+            /*rowkey_ranges*/ {},
+            EMPTY_RS_OPERATOR,
+            {},
+            context.db_context.getFileProvider(),
+            context.getReadLimiter(),
+            context.scan_context,
+            context.tracing_id);
+        for (size_t pack_id = 0; pack_id < pack_stats.size(); ++pack_id)
+            max_version = std::max(max_version, pack_filter.getMaxVersion(pack_id));
+    }
+    return max_version;
+}
+
 void StableValueSpace::calculateStableProperty(const DMContext & context, const RowKeyRange & rowkey_range, bool is_common_handle)
 {
     property.gc_hint_version = std::numeric_limits<UInt64>::max();
@@ -140,6 +140,15 @@ public:
 
     void calculateStableProperty(const DMContext & context, const RowKeyRange & rowkey_range, bool is_common_handle);
 
+    /**
+     * Return the max commit version of the data in the underlying DTFiles.
+     * It is loaded from the minmax index of the version column at the first time.
+     */
+    UInt64 getMaxDataVersion(const DMContext & context);
+
+    /// Return the max commit version of the data in `dmfiles`, by the minmax index of the version column.
+    static UInt64 getDMFilesMaxVersion(const DMContext & context, const DMFiles & dmfiles);
+
     struct Snapshot;
     using SnapshotPtr = std::shared_ptr<Snapshot>;
 
@@ -263,6 +272,9 @@ private:
     StableProperty property;
     std::atomic<bool> is_property_cached = false;
 
+    // The max commit version of the data, it is not loaded yet if it is the max value of UInt64.
+    std::atomic<UInt64> max_data_version = std::numeric_limits<UInt64>::max();
+
     LoggerPtr log;
 };
 
@@ -0,0 +1,142 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/TiFlashMetrics.h>
+#include <Interpreters/Settings.h>
+#include <Storages/DeltaMerge/WriteCombiner.h>
+
+namespace DB
+{
+namespace DM
+{
+void WriteCombiner::write(Block & block, const Settings & settings)
+{
+    const size_t max_rows = settings.dt_raft_write_combine_max_rows;
+    const UInt64 wait_us = settings.dt_raft_write_combine_wait_us;
+    if (max_rows == 0)
+    {
+        write_func(block, settings);
+        return;
+    }
+
+    PendingWrite self{&block, &settings};
+    std::unique_lock lock(mu);
+    queue.push_back(&self);
+    queued_rows += block.rows();
+    leader_cv.notify_one();
+
+    cv.wait(lock, [&] { return self.done || !writing; });
+    if (!self.done)
+    {
+        // Become the leader, write the queued blocks until the block of itself is written.
+        writing = true;
+        if (wait_us > 0)
+            leader_cv.wait_for(lock, std::chrono::microseconds(wait_us), [&] { return queued_rows >= max_rows; });
+
+        while (!self.done)
+        {
+            auto batch = popBatch(max_rows);
+            lock.unlock();
+            writeBatch(batch);
+            lock.lock();
+            for (auto * pending : batch)
+                pending->done = true;
+            cv.notify_all();
+        }
+        writing = false;
+        // Let one of the waiting writers become the new leader.
+        cv.notify_all();
+    }
+    lock.unlock();
+
+    if (self.error)
+        std::rethrow_exception(self.error);
+}
+
+bool WriteCombiner::canCombine(const Block & lhs, const Block & rhs)
+{
+    if (!blocksHaveEqualStructure(lhs, rhs))
+        return false;
+    for (size_t i = 0; i < lhs.columns(); ++i)
+    {
+        if (lhs.getByPosition(i).column_id != rhs.getByPosition(i).column_id)
+            return false;
+    }
+    return true;
+}
+
+std::vector<WriteCombiner::PendingWrite *> WriteCombiner::popBatch(size_t max_rows)
+{
+    std::vector<PendingWrite *> batch;
+    size_t rows = 0;
+    while (!queue.empty())
+    {
+        auto * pending = queue.front();
+        if (!batch.empty())
+        {
+            // Keep the FIFO order, stop at the first block which can not be combined.
+            if (rows + pending->block->rows() > max_rows || !canCombine(*batch.front()->block, *pending->block))
+                break;
+        }
+        rows += pending->block->rows();
+        batch.push_back(pending);
+        queue.pop_front();
+    }
+    queued_rows -= rows;
+    return batch;
+}
+
+void WriteCombiner::writeBatch(const std::vector<PendingWrite *> & batch)
+{
+    GET_METRIC(tiflash_raft_write_combine_count, type_block).Increment(batch.size());
+    GET_METRIC(tiflash_raft_write_combine_count, type_write).Increment();
+
+    std::exception_ptr error;
+    try
+    {
+        if (batch.size() == 1)
+        {
+            // Write the block directly, so the caller can reuse the block for decoding.
+            write_func(*batch.front()->block, *batch.front()->settings);
+        }
+        else
+        {
+            const auto & first = *batch.front()->block;
+            auto columns = first.cloneEmptyColumns();
+            size_t rows = 0;
+            for (const auto * pending : batch)
+                rows += pending->block->rows();
+            for (auto & column : columns)
+                column->reserve(rows);
+            for (const auto * pending : batch)
+            {
+                const auto & block = *pending->block;
+                for (size_t i = 0; i < columns.size(); ++i)
+                    columns[i]->insertRangeFrom(*block.getByPosition(i).column, 0, block.rows());
+            }
+            auto combined = first.cloneWithColumns(std::move(columns));
+            write_func(combined, *batch.front()->settings);
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    for (auto * pending : batch)
+        pending->error = error;
+}
+
+} // namespace DM
+} // namespace DB
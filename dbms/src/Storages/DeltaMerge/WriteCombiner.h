@@ -0,0 +1,84 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Core/Block.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace DB
+{
+struct Settings;
+
+namespace DM
+{
+/// Combine the blocks written concurrently into a table by the raft apply threads of different
+/// regions, so that they are written into the storage by one write.
+///
+/// The writers form a group commit: the first writer becomes the leader and writes the queued
+/// blocks in FIFO order, the other writers wait until their blocks are written by the leader.
+/// `write` returns only after the block is written into the storage, so the raft layer can still
+/// persist the apply state of a region after the data of it is written.
+class WriteCombiner
+{
+public:
+    using WriteFunc = std::function<void(Block &, const Settings &)>;
+
+    explicit WriteCombiner(WriteFunc write_func_)
+        : write_func(std::move(write_func_))
+    {}
+
+    /// Write `block` together with the blocks written by other threads at the same time.
+    /// At most `dt_raft_write_combine_max_rows` rows are combined into one write, 0 means never combine.
+    /// The leader waits at most `dt_raft_write_combine_wait_us` for more blocks before writing.
+    /// A combined write is done with the settings of the first block in it.
+    /// Throw the exception thrown by the write of `block`.
+    void write(Block & block, const Settings & settings);
+
+private:
+    struct PendingWrite
+    {
+        Block * block;
+        const Settings * settings;
+        bool done = false;
+        std::exception_ptr error;
+    };
+
+    static bool canCombine(const Block & lhs, const Block & rhs);
+
+    // Pop the blocks written by the next write from `queue`.
+    std::vector<PendingWrite *> popBatch(size_t max_rows);
+
+    void writeBatch(const std::vector<PendingWrite *> & batch);
+
+    const WriteFunc write_func;
+
+    std::mutex mu;
+    // Notified when some queued blocks are written or the leader quits.
+    std::condition_variable cv;
+    // Notified when a block is queued, used by the leader waiting for more blocks.
+    std::condition_variable leader_cv;
+    std::deque<PendingWrite *> queue;
+    size_t queued_rows = 0;
+    bool writing = false;
+};
+
+} // namespace DM
+} // namespace DB
@@ -0,0 +1,111 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/ArenaWithFreeLists.h>
+#include <Storages/DeltaMerge/DeltaMergeDefines.h>
+#include <Storages/DeltaMerge/DeltaTree.h>
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace DB::DM::bench
+{
+namespace
+{
+// Build a delta tree with about `num_entries` entries, half of them are inserts and the others are deletes.
+DeltaTreePtr prepareDeltaTree(size_t num_entries)
+{
+    auto tree = std::make_shared<DefaultDeltaTree>();
+    std::mt19937_64 rng(num_entries);
+    size_t rows = num_entries;
+    for (size_t i = 0; i < num_entries; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            tree->addInsert(rng() % (rows + 1), i);
+            ++rows;
+        }
+        else
+        {
+            tree->addDelete(rng() % rows);
+            --rows;
+        }
+    }
+    return tree;
+}
+
+// Place an insert and then delete it at random rids, the size of the tree keeps unchanged.
+// Args: number of entries in the tree.
+void placeDeltaTree(benchmark::State & state)
+{
+    const auto num_entries = static_cast<size_t>(state.range(0));
+    auto tree = prepareDeltaTree(num_entries);
+    std::mt19937_64 rng(0);
+    UInt64 tuple_id = num_entries;
+    for (auto _ : state)
+    {
+        auto rid = rng() % num_entries;
+        tree->addInsert(rid, tuple_id++);
+        tree->addDelete(rid);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+// Traverse all the entries, like what DeltaMergeBlockInputStream does.
+// Args: number of entries in the tree.
+void traverseDeltaTree(benchmark::State & state)
+{
+    const auto num_entries = static_cast<size_t>(state.range(0));
+    auto tree = prepareDeltaTree(num_entries);
+    for (auto _ : state)
+    {
+        UInt64 sum = 0;
+        for (auto it = tree->begin(), end = tree->end(); it != end; ++it)
+            sum += it.getRid();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * tree->numEntries());
+}
+
+// Clone the tree, which is done every time a delta index is updated.
+// Args: number of entries in the tree.
+void cloneDeltaTree(benchmark::State & state)
+{
+    const auto num_entries = static_cast<size_t>(state.range(0));
+    auto tree = prepareDeltaTree(num_entries);
+    for (auto _ : state)
+    {
+        DefaultDeltaTree copy(*tree);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * tree->numEntries());
+}
+} // namespace
+
+BENCHMARK(placeDeltaTree)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Arg(10'000'000);
+BENCHMARK(traverseDeltaTree)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(cloneDeltaTree)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace DB::DM::bench
@@ -0,0 +1,81 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
+#include <Storages/DeltaMerge/Delta/DeltaValueSpace.h>
+#include <gtest/gtest.h>
+
+namespace DB::DM::tests
+{
+namespace
+{
+UInt128 getKey(UInt64 epoch, size_t delta_rows, size_t delta_deletes, const HandleRange & range)
+{
+    return BitmapFilterCache::getKey(
+        /*physical_table_id*/ 100,
+        /*segment_id*/ 1,
+        epoch,
+        delta_rows,
+        delta_deletes,
+        /*read_stable_only*/ false,
+        {RowKeyRange::fromHandleRange(range)});
+}
+} // namespace
+
+TEST(BitmapFilterCacheTest, Key)
+{
+    const auto key = getKey(1, 10, 1, HandleRange{0, 100});
+    ASSERT_EQ(key, getKey(1, 10, 1, HandleRange{0, 100}));
+    // Different segment epoch.
+    ASSERT_NE(key, getKey(2, 10, 1, HandleRange{0, 100}));
+    // Different delta snapshot.
+    ASSERT_NE(key, getKey(1, 11, 1, HandleRange{0, 100}));
+    ASSERT_NE(key, getKey(1, 10, 2, HandleRange{0, 100}));
+    // Different read ranges.
+    ASSERT_NE(key, getKey(1, 10, 1, HandleRange{0, 99}));
+    ASSERT_NE(key, getKey(1, 10, 1, HandleRange{1, 100}));
+}
+
+TEST(BitmapFilterCacheTest, Delta)
+{
+    BitmapFilterCache cache(1024 * 1024);
+    auto delta = std::make_shared<DeltaValueSpace>(1);
+    auto bitmap_filter = std::make_shared<BitmapFilter>(100, /*default_value*/ true);
+    const auto key = getKey(1, 10, 1, HandleRange{0, 100});
+
+    ASSERT_EQ(cache.tryGet(key, delta), nullptr);
+    cache.put(key, delta, bitmap_filter);
+    ASSERT_EQ(cache.tryGet(key, delta), bitmap_filter);
+    // The same key of another delta, e.g. a segment of another table.
+    auto another_delta = std::make_shared<DeltaValueSpace>(1);
+    ASSERT_EQ(cache.tryGet(key, another_delta), nullptr);
+}
+
+TEST(BitmapFilterCacheTest, Weight)
+{
+    auto bitmap_filter = std::make_shared<BitmapFilter>(8000, /*default_value*/ true);
+    const size_t entry_weight = sizeof(BitmapFilterCacheEntry) + bitmap_filter->byteSize();
+    ASSERT_GE(entry_weight, sizeof(BitmapFilterCacheEntry) + 1000);
+
+    BitmapFilterCache cache(entry_weight * 2);
+    auto delta = std::make_shared<DeltaValueSpace>(1);
+    for (UInt64 epoch = 1; epoch <= 3; ++epoch)
+        cache.put(getKey(epoch, 0, 0, HandleRange{0, 100}), delta, bitmap_filter);
+    ASSERT_EQ(cache.weight(), entry_weight * 2);
+    // The oldest entry is evicted.
+    ASSERT_EQ(cache.tryGet(getKey(1, 0, 0, HandleRange{0, 100}), delta), nullptr);
+    ASSERT_EQ(cache.tryGet(getKey(3, 0, 0, HandleRange{0, 100}), delta), bitmap_filter);
+}
+
+} // namespace DB::DM::tests
@@ -17,6 +17,8 @@
 #include <Storages/DeltaMerge/Tuple.h>
 #include <gtest/gtest.h>
 
+#include <random>
+
 namespace DB
 {
 namespace DM
@@ -316,6 +318,53 @@ TEST_F(DeltaTree_test, InsertSkipDelete)
     checkCopy(tree);
 }
 
+TEST_F(DeltaTree_test, RandomPlace)
+{
+    // The rows after placing, the stable rows are represented by negative numbers.
+    const size_t stable_rows = 300;
+    std::vector<Int64> rows;
+    for (size_t i = 0; i < stable_rows; ++i)
+        rows.push_back(-static_cast<Int64>(i) - 1);
+
+    std::mt19937 rng(42);
+    for (UInt64 tuple_id = 0; tuple_id < 1000; ++tuple_id)
+    {
+        if (rows.empty() || rng() % 2 == 0)
+        {
+            auto rid = rng() % (rows.size() + 1);
+            tree.addInsert(rid, tuple_id);
+            rows.insert(rows.begin() + rid, tuple_id);
+        }
+        else
+        {
+            auto rid = rng() % rows.size();
+            tree.addDelete(rid);
+            rows.erase(rows.begin() + rid);
+        }
+    }
+    tree.checkAll();
+
+    std::vector<Int64> placed_rows;
+    UInt64 sid = 0;
+    for (auto it = tree.begin(), end = tree.end(); it != end; ++it)
+    {
+        for (; sid < it.getSid(); ++sid)
+            placed_rows.push_back(-static_cast<Int64>(sid) - 1);
+        if (it.isInsert())
+            placed_rows.push_back(it.getValue());
+        else
+            sid += it.getCount();
+    }
+    for (; sid < stable_rows; ++sid)
+        placed_rows.push_back(-static_cast<Int64>(sid) - 1);
+    ASSERT_EQ(placed_rows, rows);
+
+    FakeDeltaTree copy;
+    copy = tree;
+    copy.checkAll();
+    ASSERT_EQ(treeToString(copy), treeToString(tree));
+}
+
 } // namespace tests
 } // namespace DM
 } // namespace DB
@@ -143,7 +143,7 @@ Block appendColumnFileTinyToDeltaValueSpace(DMContext & context, DeltaValueSpace
     Block block = DMTestEnv::prepareSimpleWriteBlock(rows_start, rows_start + rows_num, false, tso);
     auto tiny_file = ColumnFileTiny::writeColumnFile(context, block, 0, block.rows(), wbs);
     wbs.writeLogAndData();
-    delta->appendColumnFile(context, tiny_file);
+    delta->appendColumnFile(context, tiny_file, tso);
     return block;
 }
 
@@ -166,7 +166,7 @@ Block appendColumnFileBigToDeltaValueSpace(DMContext & context, ColumnDefinesPtr
     auto column_file = std::make_shared<ColumnFileBig>(context, dmfile, RowKeyRange::fromHandleRange(range));
     wbs.data.putExternal(file_id, 0);
     wbs.writeLogAndData();
-    delta->ingestColumnFiles(context, RowKeyRange::fromHandleRange(range), {column_file}, false);
+    delta->ingestColumnFiles(context, RowKeyRange::fromHandleRange(range), {column_file}, false, tso);
     return block;
 }
 
@@ -494,6 +494,49 @@ TEST_F(DeltaValueSpaceTest, Restore)
     }
 }
 
+TEST_F(DeltaValueSpaceTest, MaxDataVersion)
+{
+    // No data.
+    ASSERT_EQ(delta->getMaxDataVersion(), 0);
+
+    size_t total_rows_write = 0;
+    WriteBatches wbs(*dmContext().storage_pool, dmContext().getWriteLimiter());
+    {
+        appendBlockToDeltaValueSpace(dmContext(), delta, total_rows_write, num_rows_write_per_batch, /*tso*/ 10);
+        total_rows_write += num_rows_write_per_batch;
+        ASSERT_EQ(delta->getMaxDataVersion(), 10);
+    }
+    {
+        appendColumnFileTinyToDeltaValueSpace(dmContext(), delta, total_rows_write, num_rows_write_per_batch, wbs, /*tso*/ 30);
+        total_rows_write += num_rows_write_per_batch;
+        ASSERT_EQ(delta->getMaxDataVersion(), 30);
+    }
+    {
+        appendColumnFileBigToDeltaValueSpace(dmContext(), table_columns, delta, total_rows_write, num_rows_write_per_batch, wbs, /*tso*/ 20);
+        total_rows_write += num_rows_write_per_batch;
+        ASSERT_EQ(delta->getMaxDataVersion(), 30);
+    }
+    {
+        delta->appendDeleteRange(dmContext(), RowKeyRange::fromHandleRange(HandleRange(0, num_rows_write_per_batch)));
+        ASSERT_EQ(delta->getMaxDataVersion(), 30);
+    }
+    ASSERT_EQ(delta->getMaxAppendedDataVersion(), 30);
+
+    // The versions of the data written before restore are unknown.
+    delta->flush(dmContext());
+    auto new_delta = delta->restore(dmContext(), RowKeyRange::newAll(false, 1), delta_id);
+    ASSERT_EQ(new_delta->getMaxDataVersion(), DeltaValueSpace::UNKNOWN_DATA_VERSION);
+    new_delta->setInitialMaxDataVersion(delta->getMaxAppendedDataVersion());
+    ASSERT_EQ(new_delta->getMaxDataVersion(), 30);
+    ASSERT_EQ(new_delta->getMaxAppendedDataVersion(), 0);
+
+    // The versions are unknown without the version column.
+    Block block = DMTestEnv::prepareSimpleWriteBlock(0, 10, false, /*tso*/ 5);
+    ASSERT_EQ(DeltaValueSpace::getMaxDataVersion(block, 0, block.rows()), 5);
+    block.erase(VERSION_COLUMN_NAME);
+    ASSERT_EQ(DeltaValueSpace::getMaxDataVersion(block, 0, block.rows()), DeltaValueSpace::UNKNOWN_DATA_VERSION);
+}
+
 TEST_F(DeltaValueSpaceTest, CloneNewlyAppendedColumnFiles)
 {
     auto persisted_file_set = delta->getPersistedFileSet();
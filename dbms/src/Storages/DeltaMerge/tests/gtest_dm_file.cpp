@@ -238,6 +238,53 @@ try
 }
 CATCH
 
+TEST_P(DMFileTest, RestoreWithLazyPack)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID, /*add_nullable*/ true);
+
+    const size_t num_rows_write = 128;
+    DMFileBlockOutputStream::BlockProperty block_property;
+    block_property.effective_num_rows = 1;
+    block_property.gc_hint_version = 1;
+    block_property.deleted_rows = 1;
+    {
+        Block block1 = DMTestEnv::prepareSimpleWriteBlockWithNullable(0, num_rows_write / 2);
+        Block block2 = DMTestEnv::prepareSimpleWriteBlockWithNullable(num_rows_write / 2, num_rows_write);
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        stream->write(block1, block_property);
+        stream->write(block2, block_property);
+        stream->writeSuffix();
+    }
+
+    auto file_provider = dbContext().getFileProvider();
+    auto lazy_file = DMFile::restore(file_provider, dm_file->fileId(), dm_file->pageId(), dm_file->parentPath(), DMFile::ReadMetaMode::allWithLazyPack());
+    // The column stats are always ready after restore
+    ASSERT_EQ(lazy_file->getBytesOnDisk(), dm_file->getBytesOnDisk());
+    // The pack stats are loaded on first access
+    ASSERT_EQ(lazy_file->getPacks(), 2UL);
+    ASSERT_EQ(lazy_file->getRows(), num_rows_write);
+    ASSERT_EQ(lazy_file->getBytes(), dm_file->getBytes());
+    ASSERT_EQ(lazy_file->getPackProperties().property_size(), 2);
+
+    {
+        // Read from a restored file without accessing the pack stats in advance
+        lazy_file = DMFile::restore(file_provider, dm_file->fileId(), dm_file->pageId(), dm_file->parentPath(), DMFile::ReadMetaMode::allWithLazyPack());
+        DMFileBlockInputStreamBuilder builder(dbContext());
+        auto stream = builder
+                          .setColumnCache(column_cache)
+                          .build(lazy_file, *cols, RowKeyRanges{RowKeyRange::newAll(false, 1)}, std::make_shared<ScanContext>());
+        ASSERT_INPUTSTREAM_COLS_UR(
+            stream,
+            Strings({DMTestEnv::pk_name}),
+            createColumns({
+                createColumn<Int64>(createNumbers<Int64>(0, num_rows_write)),
+            }));
+    }
+}
+CATCH
+
 TEST_P(DMFileTest, MetaV2)
 try
 {
@@ -831,6 +878,41 @@ try
 }
 CATCH
 
+TEST(DMFileReadAheadWindowTest, Window)
+try
+{
+    ASSERT_FALSE(DMFileReadAheadWindow(0, 1024).enabled());
+    ASSERT_FALSE(DMFileReadAheadWindow(4, 0).enabled());
+
+    DMFileReadAheadWindow window(4, 1024);
+    ASSERT_TRUE(window.enabled());
+    ASSERT_EQ(window.getRangeToHint(0, 10), std::make_pair(0UL, 4UL));
+    ASSERT_EQ(window.getRangeToHint(8, 10), std::make_pair(8UL, 10UL));
+
+    window.addHinted(1, 300);
+    window.addHinted(2, 300);
+    window.addHinted(3, 300);
+    window.setHintedEnd(4);
+    ASSERT_FALSE(window.isFull());
+    ASSERT_EQ(window.getPendingBytes(), 900);
+    // The packs hinted are not hinted again.
+    ASSERT_EQ(window.getRangeToHint(1, 10), std::make_pair(4UL, 5UL));
+
+    // Pack 1 is skipped, pack 2 is read.
+    window.onRead(2, 3);
+    ASSERT_EQ(window.getPendingBytes(), 300);
+    window.addHinted(4, 800);
+    ASSERT_TRUE(window.isFull());
+
+    // Moving the window does not count the pending bytes twice.
+    DMFileReadAheadWindow moved(std::move(window));
+    ASSERT_EQ(moved.getPendingBytes(), 1100);
+    ASSERT_EQ(window.getPendingBytes(), 0); // NOLINT(bugprone-use-after-move)
+    moved.onRead(3, 5);
+    ASSERT_EQ(moved.getPendingBytes(), 0);
+}
+CATCH
+
 namespace
 {
 RSOperatorPtr toRSFilter(const ColumnDefine & cd, const HandleRange & range)
@@ -1399,6 +1399,26 @@ try
 }
 CATCH
 
+TEST_F(DMMinMaxIndexTest, TopN)
+try
+{
+    const auto * case_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    // Ascending, the rows less than or equal to the threshold are needed.
+    ASSERT_EQ(true, checkMatch(case_name, *context, "Int64", "100", createTopN(attr("Int64"), Field((Int64)100), false)));
+    ASSERT_EQ(false, checkMatch(case_name, *context, "Int64", "100", createTopN(attr("Int64"), Field((Int64)99), false)));
+    // Descending, the rows greater than or equal to the threshold are needed.
+    ASSERT_EQ(true, checkMatch(case_name, *context, "Int64", "100", createTopN(attr("Int64"), Field((Int64)100), true)));
+    ASSERT_EQ(false, checkMatch(case_name, *context, "Int64", "100", createTopN(attr("Int64"), Field((Int64)101), true)));
+
+    // NULL is less than any other value.
+    CSVTuples tuples_with_null = {{"0", "0", "0", "100"}, {"1", "1", "0", "\\N"}};
+    ASSERT_EQ(true, checkMatch(case_name, *context, "Nullable(Int64)", tuples_with_null, createTopN(attr("Nullable(Int64)"), Field((Int64)99), false)));
+    ASSERT_EQ(false, checkMatch(case_name, *context, "Nullable(Int64)", tuples_with_null, createTopN(attr("Nullable(Int64)"), Field((Int64)101), true)));
+    ASSERT_EQ(false, checkMatch(case_name, *context, "Nullable(Int64)", "100", createTopN(attr("Nullable(Int64)"), Field(), false)));
+    ASSERT_EQ(true, checkMatch(case_name, *context, "Nullable(Int64)", "100", createTopN(attr("Nullable(Int64)"), Field(), true)));
+}
+CATCH
+
 TEST_F(DMMinMaxIndexTest, DelMark)
 try
 {
@@ -0,0 +1,138 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Interpreters/Settings.h>
+#include <Storages/DeltaMerge/WriteCombiner.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace DB
+{
+namespace DM
+{
+namespace tests
+{
+using DB::tests::createColumn;
+
+namespace
+{
+Settings makeSettings(size_t max_rows)
+{
+    Settings settings;
+    settings.dt_raft_write_combine_max_rows = max_rows;
+    return settings;
+}
+} // namespace
+
+TEST(WriteCombinerTest, WriteDirectly)
+try
+{
+    std::vector<const Block *> written;
+    WriteCombiner combiner([&](Block & block, const Settings &) { written.push_back(&block); });
+
+    Block block{createColumn<Int64>({1, 2, 3}, "a")};
+    // A single block is written without copy.
+    combiner.write(block, makeSettings(1024));
+    ASSERT_EQ(written.size(), 1);
+    ASSERT_EQ(written.back(), &block);
+    // Combining is disabled.
+    combiner.write(block, makeSettings(0));
+    ASSERT_EQ(written.size(), 2);
+    ASSERT_EQ(written.back(), &block);
+}
+CATCH
+
+TEST(WriteCombinerTest, CombineConcurrentWrites)
+try
+{
+    std::mutex mu;
+    std::vector<size_t> written_rows;
+    Int64 written_sum = 0;
+    WriteCombiner combiner([&](Block & block, const Settings &) {
+        // Slow down the writes, so the other writers are queued.
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::lock_guard lock(mu);
+        written_rows.push_back(block.rows());
+        const auto & column = block.getByName("a").column;
+        for (size_t i = 0; i < column->size(); ++i)
+            written_sum += column->getInt(i);
+    });
+
+    const size_t num_writers = 8;
+    std::vector<std::thread> writers;
+    for (size_t i = 0; i < num_writers; ++i)
+    {
+        writers.emplace_back([&, i] {
+            Block block{createColumn<Int64>({static_cast<Int64>(i), static_cast<Int64>(i)}, "a")};
+            combiner.write(block, makeSettings(1024));
+        });
+    }
+    for (auto & writer : writers)
+        writer.join();
+
+    size_t total_rows = 0;
+    for (auto rows : written_rows)
+        total_rows += rows;
+    ASSERT_EQ(total_rows, num_writers * 2);
+    ASSERT_EQ(written_sum, 56);
+    ASSERT_LT(written_rows.size(), num_writers);
+}
+CATCH
+
+TEST(WriteCombinerTest, NotCombined)
+try
+{
+    std::vector<size_t> written_rows;
+    WriteCombiner combiner([&](Block & block, const Settings &) {
+        written_rows.push_back(block.rows());
+        if (block.has("b"))
+            throw Exception("write failed");
+    });
+
+    // The blocks exceed the max rows or have different structure are not combined.
+    std::vector<std::thread> writers;
+    writers.emplace_back([&] {
+        Block block{createColumn<Int64>({1, 2, 3}, "a")};
+        combiner.write(block, makeSettings(4));
+    });
+    writers.emplace_back([&] {
+        Block block{createColumn<Int64>({1, 2, 3}, "a")};
+        combiner.write(block, makeSettings(4));
+    });
+    bool failed = false;
+    writers.emplace_back([&] {
+        Block block{createColumn<Int64>({1}, "b")};
+        try
+        {
+            combiner.write(block, makeSettings(4));
+        }
+        catch (const Exception &)
+        {
+            failed = true;
+        }
+    });
+    for (auto & writer : writers)
+        writer.join();
+
+    ASSERT_EQ(written_rows.size(), 3);
+    ASSERT_TRUE(failed);
+}
+CATCH
+
+} // namespace tests
+} // namespace DM
+} // namespace DB
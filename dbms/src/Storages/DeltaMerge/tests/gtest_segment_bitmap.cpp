@@ -506,4 +506,58 @@ try
 }
 CATCH
 
+TEST_F(SegmentBitmapFilterTest, Cache)
+try
+{
+    if (!db_context->getGlobalContext().getBitmapFilterCache())
+        db_context->getGlobalContext().setBitmapFilterCache(64 * 1024 * 1024);
+    ASSERT_NE(dm_context->db_context.getBitmapFilterCache(), nullptr);
+
+    writeSegment("s:[0, 1000)|d_tiny:[500, 1500)|d_mem:[1000, 2000)");
+    ASSERT_EQ(version, 3);
+
+    auto build = [&](UInt64 max_version) {
+        auto [seg, snap] = getSegmentForRead(SEG_ID);
+        return seg->buildBitmapFilter(*dm_context, snap, {seg->getRowKeyRange()}, EMPTY_RS_OPERATOR, max_version, DEFAULT_BLOCK_SIZE);
+    };
+    auto build_normal = [&](UInt64 max_version) {
+        auto [seg, snap] = getSegmentForRead(SEG_ID);
+        return seg->buildBitmapFilterNormal(*dm_context, snap, {seg->getRowKeyRange()}, EMPTY_RS_OPERATOR, max_version, DEFAULT_BLOCK_SIZE);
+    };
+
+    {
+        // Some data are invisible to a stale read, the bitmap filter is not cached.
+        auto bitmap_filter = build(version - 1);
+        ASSERT_NE(bitmap_filter, build(version - 1));
+        ASSERT_EQ(bitmap_filter->toDebugString(), build_normal(version - 1)->toDebugString());
+    }
+    {
+        // All data are visible, the bitmap filter is shared by the reads with newer versions.
+        auto bitmap_filter = build(version);
+        ASSERT_EQ(bitmap_filter, build(version));
+        ASSERT_EQ(bitmap_filter, build(std::numeric_limits<UInt64>::max()));
+        ASSERT_EQ(bitmap_filter->toDebugString(), build_normal(version)->toDebugString());
+
+        // The delta snapshot is changed by a new write.
+        writeSegment(SEG_ID, 100, 2000);
+        ASSERT_EQ(version, 4);
+        ASSERT_NE(build(version - 1), build(version - 1));
+        auto new_bitmap_filter = build(version);
+        ASSERT_NE(new_bitmap_filter, bitmap_filter);
+        ASSERT_EQ(new_bitmap_filter, build(version));
+        ASSERT_EQ(new_bitmap_filter->toDebugString(), build_normal(version)->toDebugString());
+    }
+    {
+        // The versions of the stable are taken into account after merging delta.
+        mergeSegmentDelta(SEG_ID);
+        ASSERT_NE(build(version - 1), build(version - 1));
+        auto bitmap_filter = build(version);
+        ASSERT_EQ(bitmap_filter, build(version));
+        auto [seg, snap] = getSegmentForRead(SEG_ID);
+        auto expected = seg->buildBitmapFilterStableOnly(*dm_context, snap, {seg->getRowKeyRange()}, EMPTY_RS_OPERATOR, version, DEFAULT_BLOCK_SIZE);
+        ASSERT_EQ(bitmap_filter->toDebugString(), expected->toDebugString());
+    }
+}
+CATCH
+
 } // namespace DB::DM::tests
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Columns/ColumnsNumber.h>
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataTypes/DataTypesNumber.h>
 #include <Storages/DeltaMerge/Segment.h>
 #include <Storages/DeltaMerge/SegmentReadTaskPool.h>
 #include <TestUtils/TiFlashTestBasic.h>
@@ -101,4 +104,81 @@ TEST(SegmentReadTasksWrapperTest, Ordered)
     ASSERT_EQ(tasks_wrapper.nextTask(), nullptr);
 }
 
+Block createBlock(size_t rows)
+{
+    return Block{ColumnWithTypeAndName{ColumnInt64::create(rows), std::make_shared<DataTypeInt64>(), "a"}};
+}
+
+SegmentReadTaskPoolPtr createSegmentReadTaskPool(bool enable_read_thread, const ReadLimitHint & limit_hint)
+{
+    return std::make_shared<SegmentReadTaskPool>(
+        /*table_id_*/ 1,
+        /*dm_context_*/ nullptr,
+        ColumnDefines{},
+        /*filter_*/ nullptr,
+        /*max_version_*/ 0,
+        DEFAULT_BLOCK_SIZE,
+        ReadMode::Normal,
+        createSegmentReadTasks(test_seg_ids),
+        [](const DMContextPtr &, const SegmentPtr &) {},
+        "SegmentReadTaskPoolTest",
+        enable_read_thread,
+        /*num_streams_*/ 1,
+        limit_hint);
+}
+
+TEST(SegmentReadTaskPoolTest, LimitInHandleOrder)
+{
+    auto pool = createSegmentReadTaskPool(false, ReadLimitHint{.rows = 100, .in_handle_order = true, .desc = true});
+
+    auto task = pool->nextTask();
+    ASSERT_EQ(task->segment->segmentId(), test_seg_ids[0]);
+    ASSERT_FALSE(pool->addReadRows(60));
+    ASSERT_FALSE(pool->isLimitReached());
+
+    task = pool->nextTask();
+    ASSERT_EQ(task->segment->segmentId(), test_seg_ids[1]);
+    ASSERT_TRUE(pool->addReadRows(60));
+    ASSERT_TRUE(pool->isLimitReached());
+    // The rows of a segment are in ascending order, the whole segment is needed for the descending order.
+    ASSERT_FALSE(pool->canStopReadingSegment());
+    // The rest segments are skipped.
+    ASSERT_EQ(pool->nextTask(), nullptr);
+
+    pool = createSegmentReadTaskPool(false, ReadLimitHint{.rows = 100, .in_handle_order = true, .desc = false});
+    ASSERT_TRUE(pool->addReadRows(100));
+    ASSERT_TRUE(pool->canStopReadingSegment());
+}
+
+TEST(SegmentReadTaskPoolTest, LimitWithReadThread)
+{
+    auto pool = createSegmentReadTaskPool(true, ReadLimitHint{.rows = 5});
+    pool->increaseUnorderedInputStreamRefCount();
+    ASSERT_TRUE(pool->valid());
+
+    auto segment = createSegment(test_seg_ids[0]);
+    BlockInputStreamPtr stream = std::make_shared<BlocksListBlockInputStream>(BlocksList{createBlock(3), createBlock(3), createBlock(3)});
+    ASSERT_TRUE(pool->readOneBlock(stream, segment));
+    ASSERT_TRUE(pool->valid());
+    ASSERT_TRUE(pool->readOneBlock(stream, segment));
+    // Enough rows are read, the segments being read should be stopped.
+    ASSERT_FALSE(pool->valid());
+    ASSERT_TRUE(pool->canStopReadingSegment());
+    // The block read after the limit is reached is dropped.
+    ASSERT_TRUE(pool->readOneBlock(stream, segment));
+    ASSERT_EQ(pool->getFreeBlockSlots(), 1);
+
+    // The readers finish after the blocks in the queue are consumed.
+    for (size_t i = 0; i < 2; ++i)
+    {
+        Block block;
+        pool->popBlock(block);
+        ASSERT_EQ(block.rows(), 3);
+    }
+    Block block;
+    pool->popBlock(block);
+    ASSERT_FALSE(block);
+    pool->decreaseUnorderedInputStreamRefCount();
+}
+
 } // namespace DB::DM::tests
\ No newline at end of file
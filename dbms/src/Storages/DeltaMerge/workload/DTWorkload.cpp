@@ -18,6 +18,10 @@
 #include <Poco/Logger.h>
 #include <Poco/Util/LayeredConfiguration.h>
 #include <Storages/DeltaMerge/DeltaMergeStore.h>
+#include <Storages/DeltaMerge/ExternalDTFileInfo.h>
+#include <Storages/DeltaMerge/File/DMFile.h>
+#include <Storages/DeltaMerge/File/DMFileBlockOutputStream.h>
+#include <Storages/DeltaMerge/Filter/PushDownFilter.h>
 #include <Storages/DeltaMerge/Filter/RSOperator.h>
 #include <Storages/DeltaMerge/workload/DTWorkload.h>
 #include <Storages/DeltaMerge/workload/DataGenerator.h>
@@ -31,6 +35,8 @@
 #include <Storages/DeltaMerge/workload/Utils.h>
 #include <TestUtils/TiFlashTestEnv.h>
 
+#include <random>
+
 namespace DB::DM::tests
 {
 
@@ -41,7 +47,7 @@ DTWorkload::DTWorkload(const WorkloadOptions & opts_, std::shared_ptr<SharedHand
     , table_info(std::make_unique<TableInfo>(table_info_))
     , handle_table(handle_table_)
     , writing_threads(opts_.write_thread_count)
-    , stat(opts_.write_thread_count, opts_.read_thread_count)
+    , stat(opts_.write_thread_count, opts_.read_thread_count, opts_.delete_range_thread_count, opts_.ingest_thread_count)
 {
     auto v = table_info->toStrings();
     for (const auto & s : v)
@@ -145,7 +151,9 @@ void DTWorkload::write(ThreadStat & write_stat)
             }
             auto ts = updateBlock(block, key);
 
+            Stopwatch write_sw;
             store->write(*context, context->getSettingsRef(), block);
+            write_stat.latencies["write"].add(write_sw.elapsed() / 1000);
 
             if (handle_table != nullptr)
             {
@@ -172,8 +180,13 @@ void DTWorkload::write(ThreadStat & write_stat)
 template <typename T>
 void DTWorkload::read(const ColumnDefines & columns, int stream_count, T func)
 {
-    auto ranges = {RowKeyRange::newAll(store->isCommonHandle(), store->getRowKeyColumnSize())};
-    auto filter = EMPTY_FILTER;
+    RowKeyRanges ranges{RowKeyRange::newAll(store->isCommonHandle(), store->getRowKeyColumnSize())};
+    read(columns, ranges, EMPTY_FILTER, stream_count, func);
+}
+
+template <typename T>
+void DTWorkload::read(const ColumnDefines & columns, const RowKeyRanges & ranges, const PushDownFilterPtr & filter, int stream_count, T func)
+{
     int excepted_block_size = 1024;
     uint64_t read_ts = ts_gen->get();
     auto streams = store->read(*context, context->getSettingsRef(), columns, ranges, stream_count, read_ts, filter, "DTWorkload", false, opts->is_fast_scan, excepted_block_size);
@@ -252,31 +265,178 @@ void DTWorkload::verifyHandle(uint64_t r)
     }
 }
 
-void DTWorkload::scanAll(ThreadStat & read_stat)
+namespace
+{
+auto countRows(std::atomic<uint64_t> & read_count)
+{
+    return [&read_count](BlockInputStreamPtr in, [[maybe_unused]] uint64_t read_ts) {
+        while (Block block = in->read())
+        {
+            read_count.fetch_add(block.rows(), std::memory_order_relaxed);
+        }
+    };
+}
+} // namespace
+
+uint64_t DTWorkload::scanAll()
+{
+    const auto & columns = store->getTableColumns();
+    int stream_count = opts->read_stream_count;
+    std::atomic<uint64_t> read_count = 0;
+    read(columns, stream_count, countRows(read_count));
+    return read_count;
+}
+
+// Scan `range_scan_rows` handles from a random key. The range is pushed down as a rough set filter
+// on the handle column, so the packs out of the range are skipped by the min-max index.
+uint64_t DTWorkload::rangeScan()
+{
+    const auto & columns = store->getTableColumns();
+    int stream_count = opts->read_stream_count;
+    auto start = static_cast<Int64>(key_gen->get64());
+    auto end = start + static_cast<Int64>(opts->range_scan_rows);
+    const auto & handle = table_info->handle;
+    Attr attr{.col_name = handle.name, .col_id = handle.id, .type = handle.type};
+    auto rs_operator = createAnd({createGreaterEqual(attr, Field(start), -1), createLess(attr, Field(end), -1)});
+    auto filter = std::make_shared<PushDownFilter>(rs_operator);
+    RowKeyRanges ranges{RowKeyRange::newAll(store->isCommonHandle(), store->getRowKeyColumnSize())};
+    std::atomic<uint64_t> read_count = 0;
+    read(columns, ranges, filter, stream_count, countRows(read_count));
+    return read_count;
+}
+
+uint64_t DTWorkload::pointLookup()
+{
+    const auto & columns = store->getTableColumns();
+    auto key = static_cast<Int64>(key_gen->get64());
+    RowKeyRanges ranges{RowKeyRange::fromHandleRange(HandleRange(key, key + 1))};
+    std::atomic<uint64_t> read_count = 0;
+    read(columns, ranges, EMPTY_FILTER, 1, countRows(read_count));
+    return read_count;
+}
+
+void DTWorkload::readLoop(ThreadStat & read_stat)
 {
     try
     {
+        static const std::vector<std::string> mixed_read_types{"full_scan", "range_scan", "point_lookup"};
+        std::mt19937_64 rand_gen(std::random_device{}());
+        uint64_t total_ns = 0;
         while (writing_threads.load(std::memory_order_relaxed) > 0)
         {
-            const auto & columns = store->getTableColumns();
-            int stream_count = opts->read_stream_count;
-            std::atomic<uint64_t> read_count = 0;
-            auto count_row = [&read_count](BlockInputStreamPtr in, [[maybe_unused]] uint64_t read_ts) {
-                while (Block block = in->read())
-                {
-                    read_count.fetch_add(block.rows(), std::memory_order_relaxed);
-                }
-            };
+            const auto & read_type = opts->read_type == "mixed" ? mixed_read_types[rand_gen() % mixed_read_types.size()] : opts->read_type;
+            Stopwatch sw;
+            uint64_t read_count = 0;
+            if (read_type == "full_scan")
+            {
+                read_count = scanAll();
+            }
+            else if (read_type == "range_scan")
+            {
+                read_count = rangeScan();
+            }
+            else
+            {
+                read_count = pointLookup();
+            }
+            auto elapsed_ns = sw.elapsed();
+            read_stat.latencies[read_type].add(elapsed_ns / 1000);
+            total_ns += elapsed_ns;
+            read_stat.ms = total_ns / 1000000;
+            read_stat.count += read_count;
+            if (read_type == "full_scan")
+            {
+                LOG_INFO(log, "scanAll: columns {} streams {} read_count {} read_ms {}", store->getTableColumns().size(), opts->read_stream_count, read_count, elapsed_ns / 1000000);
+            }
+        }
+        LOG_INFO(log, "read_stat: {}", read_stat.toString());
+    }
+    catch (...)
+    {
+        tryLogCurrentException("exception thrown in DTWorkload::readLoop");
+        throw;
+    }
+}
+
+// Delete `delete_range_rows` handles from a random key periodically until the writes finish.
+void DTWorkload::deleteRange(ThreadStat & delete_range_stat)
+{
+    try
+    {
+        Stopwatch total_sw;
+        while (writing_threads.load(std::memory_order_relaxed) > 0)
+        {
+            auto start = static_cast<Int64>(key_gen->get64());
+            auto range = RowKeyRange::fromHandleRange(HandleRange(start, start + static_cast<Int64>(opts->delete_range_rows)));
+            Stopwatch sw;
+            store->deleteRange(*context, context->getSettingsRef(), range);
+            delete_range_stat.latencies["delete_range"].add(sw.elapsed() / 1000);
+            delete_range_stat.count++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(opts->delete_range_interval_ms));
+        }
+        delete_range_stat.ms = total_sw.elapsedMilliseconds();
+        LOG_INFO(log, "delete_range_stat: {}", delete_range_stat.toString());
+    }
+    catch (...)
+    {
+        tryLogCurrentException("exception thrown in DTWorkload::deleteRange");
+        throw;
+    }
+}
+
+// Ingest a DMFile of `ingest_rows` consecutive handles from a random key periodically until the writes finish.
+// The data in the range is replaced by the DMFile, just like applying a snapshot of a region.
+void DTWorkload::ingest(ThreadStat & ingest_stat)
+{
+    try
+    {
+        auto data_gen = DataGenerator::create(*opts, *table_info, *ts_gen);
+        const auto & columns = store->getTableColumns();
+        Stopwatch total_sw;
+        while (writing_threads.load(std::memory_order_relaxed) > 0)
+        {
+            auto start = key_gen->get64();
+            Blocks blocks;
+            blocks.reserve(opts->ingest_rows);
+            for (uint64_t key = start; key < start + opts->ingest_rows; key++)
+            {
+                blocks.push_back(std::get<0>(data_gen->get(key)));
+            }
+            auto block = vstackBlocks(std::move(blocks));
+
             Stopwatch sw;
-            read(columns, stream_count, count_row);
-            read_stat.ms = sw.elapsedMilliseconds();
-            read_stat.count = read_count;
-            LOG_INFO(log, "scanAll: columns {} streams {} read_stat {}", columns.size(), stream_count, read_stat.toString());
+            auto [parent_path, file_id] = store->preAllocateIngestFile();
+            if (parent_path.empty())
+            {
+                // The store is shutting down.
+                break;
+            }
+            auto dmfile = DMFile::create(file_id, parent_path, DMChecksumConfig::fromDBContext(*context));
+            {
+                DMFileBlockOutputStream output_stream(*context, dmfile, columns);
+                DMFileBlockOutputStream::BlockProperty property{
+                    .not_clean_rows = 0,
+                    .deleted_rows = 0,
+                    .effective_num_rows = block.rows(),
+                    .gc_hint_version = 0,
+                };
+                output_stream.writePrefix();
+                output_stream.write(block, property);
+                output_stream.writeSuffix();
+            }
+            store->preIngestFile(parent_path, file_id, dmfile->getBytesOnDisk());
+            auto range = RowKeyRange::fromHandleRange(HandleRange(static_cast<Int64>(start), static_cast<Int64>(start + opts->ingest_rows)));
+            store->ingestFiles(*context, context->getSettingsRef(), range, {ExternalDTFileInfo{.id = file_id, .range = range}}, /*clear_data_in_range*/ true);
+            ingest_stat.latencies["ingest"].add(sw.elapsed() / 1000);
+            ingest_stat.count += block.rows();
+            std::this_thread::sleep_for(std::chrono::milliseconds(opts->ingest_interval_ms));
         }
+        ingest_stat.ms = total_sw.elapsedMilliseconds();
+        LOG_INFO(log, "ingest_stat: {}", ingest_stat.toString());
     }
     catch (...)
     {
-        tryLogCurrentException("exception thrown in scanAll");
+        tryLogCurrentException("exception thrown in DTWorkload::ingest");
         throw;
     }
 }
@@ -292,7 +452,19 @@ void DTWorkload::run(uint64_t r)
     std::vector<std::thread> read_threads;
     for (uint64_t i = 0; i < opts->read_thread_count; i++)
     {
-        read_threads.push_back(std::thread(&DTWorkload::scanAll, this, std::ref(stat.read_stats[i])));
+        read_threads.push_back(std::thread(&DTWorkload::readLoop, this, std::ref(stat.read_stats[i])));
+    }
+
+    std::vector<std::thread> delete_range_threads;
+    for (uint64_t i = 0; i < opts->delete_range_thread_count; i++)
+    {
+        delete_range_threads.push_back(std::thread(&DTWorkload::deleteRange, this, std::ref(stat.delete_range_stats[i])));
+    }
+
+    std::vector<std::thread> ingest_threads;
+    for (uint64_t i = 0; i < opts->ingest_thread_count; i++)
+    {
+        ingest_threads.push_back(std::thread(&DTWorkload::ingest, this, std::ref(stat.ingest_stats[i])));
     }
 
     for (auto & t : write_threads)
@@ -303,6 +475,14 @@ void DTWorkload::run(uint64_t r)
     {
         t.join();
     }
+    for (auto & t : delete_range_threads)
+    {
+        t.join();
+    }
+    for (auto & t : ingest_threads)
+    {
+        t.join();
+    }
     if (opts->verification)
     {
         verifyHandle(r);
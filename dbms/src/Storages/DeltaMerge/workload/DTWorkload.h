@@ -15,9 +15,11 @@
 #pragma once
 
 #include <Interpreters/Context_fwd.h>
+#include <Storages/DeltaMerge/workload/LatencyHistogram.h>
 #include <fmt/ranges.h>
 
 #include <atomic>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,6 +35,10 @@ namespace DB::DM
 class DeltaMergeStore;
 struct ColumnDefine;
 using ColumnDefines = std::vector<ColumnDefine>;
+struct RowKeyRange;
+using RowKeyRanges = std::vector<RowKeyRange>;
+class PushDownFilter;
+using PushDownFilterPtr = std::shared_ptr<PushDownFilter>;
 } // namespace DB::DM
 
 namespace Poco
@@ -56,7 +62,12 @@ class ThreadStat
 public:
     std::string toString() const
     {
-        return fmt::format("ms {} count {} speed {}", ms, count, speed());
+        auto s = fmt::format("ms {} count {} speed {}", ms, count, speed());
+        for (const auto & [op, latency] : latencies)
+        {
+            s += fmt::format(" {} [{}]", op, latency.toString());
+        }
+        return s;
     }
 
     // count per second
@@ -65,19 +76,25 @@ public:
         return ms == 0 ? 0 : count * 1000 / ms;
     }
 
+    const std::map<std::string, LatencyHistogram> & getLatencies() const { return latencies; }
+
 private:
     uint64_t ms = 0;
     uint64_t count = 0;
+    // Latency of each operation, e.g. write, range_scan.
+    std::map<std::string, LatencyHistogram> latencies;
     friend class DTWorkload;
 };
 
 class Statistics
 {
 public:
-    explicit Statistics(int write_thread_count = 0, int read_thread_count = 0)
+    explicit Statistics(int write_thread_count = 0, int read_thread_count = 0, int delete_range_thread_count = 0, int ingest_thread_count = 0)
         : init_ms(0)
         , write_stats(write_thread_count)
         , read_stats(read_thread_count)
+        , delete_range_stats(delete_range_thread_count)
+        , ingest_stats(ingest_thread_count)
     {}
 
     uint64_t writePerSecond() const
@@ -96,6 +113,23 @@ public:
 
     uint64_t initMS() const { return init_ms; }
 
+    // Merge the latency of each operation of all threads.
+    std::map<std::string, LatencyHistogram> latencies() const
+    {
+        std::map<std::string, LatencyHistogram> res;
+        for (const auto * stats : {&write_stats, &read_stats, &delete_range_stats, &ingest_stats})
+        {
+            for (const auto & stat : *stats)
+            {
+                for (const auto & [op, latency] : stat.getLatencies())
+                {
+                    res[op].merge(latency);
+                }
+            }
+        }
+        return res;
+    }
+
     std::vector<std::string> toStrings() const
     {
         std::vector<std::string> v;
@@ -108,6 +142,18 @@ public:
         {
             v.push_back(fmt::format("read_{}: {}", i, read_stats[i].toString()));
         }
+        for (size_t i = 0; i < delete_range_stats.size(); i++)
+        {
+            v.push_back(fmt::format("delete_range_{}: {}", i, delete_range_stats[i].toString()));
+        }
+        for (size_t i = 0; i < ingest_stats.size(); i++)
+        {
+            v.push_back(fmt::format("ingest_{}: {}", i, ingest_stats[i].toString()));
+        }
+        for (const auto & [op, latency] : latencies())
+        {
+            v.push_back(fmt::format("latency {}: {}", op, latency.toString()));
+        }
         return v;
     }
 
@@ -115,6 +161,8 @@ private:
     uint64_t init_ms;
     std::vector<ThreadStat> write_stats;
     std::vector<ThreadStat> read_stats;
+    std::vector<ThreadStat> delete_range_stats;
+    std::vector<ThreadStat> ingest_stats;
 
     friend class DTWorkload;
 };
@@ -137,9 +185,16 @@ public:
 private:
     void write(ThreadStat & write_stat);
     void verifyHandle(uint64_t r);
-    void scanAll(ThreadStat & read_stat);
+    void readLoop(ThreadStat & read_stat);
+    uint64_t scanAll();
+    uint64_t rangeScan();
+    uint64_t pointLookup();
+    void deleteRange(ThreadStat & delete_range_stat);
+    void ingest(ThreadStat & ingest_stat);
     template <typename T>
     void read(const ColumnDefines & columns, int stream_count, T func);
+    template <typename T>
+    void read(const ColumnDefines & columns, const RowKeyRanges & ranges, const PushDownFilterPtr & filter, int stream_count, T func);
     uint64_t updateBlock(Block & block, uint64_t key);
 
     Poco::Logger * log;
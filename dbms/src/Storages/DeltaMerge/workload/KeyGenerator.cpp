@@ -16,7 +16,9 @@
 #include <Storages/DeltaMerge/workload/Options.h>
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <mutex>
 #include <random>
 
@@ -90,6 +92,59 @@ private:
     std::normal_distribution<> normal_dist;
 };
 
+// Generate keys in [0, key_count) following the zipfian distribution, the smaller keys are more popular.
+// The algorithm is from "Quickly Generating Billion-Record Synthetic Databases", Jim Gray et al, SIGMOD 1994,
+// which is also used by YCSB.
+class ZipfianDistributionKeyGenerator : public KeyGenerator
+{
+public:
+    ZipfianDistributionKeyGenerator(uint64_t key_count_, double theta_)
+        : key_count(std::max<uint64_t>(key_count_, 2))
+        , theta(theta_)
+        , rand_gen(std::random_device()())
+        , uniform_dist(0.0, 1.0)
+    {
+        zetan = zeta(key_count, theta);
+        alpha = 1.0 / (1.0 - theta);
+        eta = (1.0 - std::pow(2.0 / key_count, 1.0 - theta)) / (1.0 - zeta(2, theta) / zetan);
+    }
+
+    uint64_t get64() override
+    {
+        double u = 0;
+        {
+            std::lock_guard lock(mtx);
+            u = uniform_dist(rand_gen);
+        }
+        double uz = u * zetan;
+        if (uz < 1.0)
+            return 0;
+        if (uz < 1.0 + std::pow(0.5, theta))
+            return 1;
+        auto key = static_cast<uint64_t>(key_count * std::pow(eta * u - eta + 1.0, alpha));
+        return std::min(key, key_count - 1);
+    }
+
+private:
+    static double zeta(uint64_t n, double theta)
+    {
+        double sum = 0;
+        for (uint64_t i = 1; i <= n; i++)
+            sum += 1.0 / std::pow(static_cast<double>(i), theta);
+        return sum;
+    }
+
+    const uint64_t key_count;
+    const double theta;
+    double zetan;
+    double alpha;
+    double eta;
+
+    std::mutex mtx;
+    std::mt19937_64 rand_gen;
+    std::uniform_real_distribution<double> uniform_dist;
+};
+
 std::unique_ptr<KeyGenerator> KeyGenerator::create(const WorkloadOptions & opts)
 {
     const auto & dist = opts.write_key_distribution;
@@ -105,6 +160,10 @@ std::unique_ptr<KeyGenerator> KeyGenerator::create(const WorkloadOptions & opts)
     {
         return std::make_unique<NormalDistributionKeyGenerator>(opts.max_key_count);
     }
+    else if (dist == "zipfian")
+    {
+        return std::make_unique<ZipfianDistributionKeyGenerator>(opts.max_key_count, opts.zipfian_theta);
+    }
     else
     {
         throw std::invalid_argument(fmt::format("KeyGenerator::create '{}' not support.", dist));
@@ -0,0 +1,98 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Storages/DeltaMerge/workload/LatencyHistogram.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace DB::DM::tests
+{
+size_t LatencyHistogram::bucketIndex(uint64_t us)
+{
+    if (us < sub_bucket_count)
+        return us;
+    // The highest bit decides the power of 2, the next `sub_bucket_bits` bits decide the sub bucket.
+    size_t highest_bit = 63 - __builtin_clzll(us);
+    size_t shift = highest_bit - sub_bucket_bits;
+    size_t sub_bucket = (us >> shift) & (sub_bucket_count - 1);
+    return ((shift + 1) << sub_bucket_bits) + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index)
+{
+    if (index < sub_bucket_count)
+        return index;
+    size_t shift = (index >> sub_bucket_bits) - 1;
+    uint64_t sub_bucket = index & (sub_bucket_count - 1);
+    return ((sub_bucket_count + sub_bucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::add(uint64_t us)
+{
+    ++buckets[bucketIndex(us)];
+    ++total_count;
+    sum_us += us;
+    max_us = std::max(max_us, us);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram & other)
+{
+    for (size_t i = 0; i < bucket_count; ++i)
+        buckets[i] += other.buckets[i];
+    total_count += other.total_count;
+    sum_us += other.sum_us;
+    max_us = std::max(max_us, other.max_us);
+}
+
+uint64_t LatencyHistogram::percentile(double p) const
+{
+    if (total_count == 0)
+        return 0;
+    auto target = std::max<uint64_t>(1, std::ceil(p * total_count));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < bucket_count; ++i)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= target)
+            return std::min(bucketUpperBound(i), max_us);
+    }
+    return max_us;
+}
+
+std::string LatencyHistogram::toString() const
+{
+    return fmt::format(
+        "count {} mean_us {:.1f} p50_us {} p99_us {} p999_us {} max_us {}",
+        count(),
+        mean(),
+        percentile(0.5),
+        percentile(0.99),
+        percentile(0.999),
+        max());
+}
+
+std::string LatencyHistogram::toJson() const
+{
+    return fmt::format(
+        R"({{"count":{},"mean_us":{:.1f},"p50_us":{},"p99_us":{},"p999_us":{},"max_us":{}}})",
+        count(),
+        mean(),
+        percentile(0.5),
+        percentile(0.99),
+        percentile(0.999),
+        max());
+}
+} // namespace DB::DM::tests
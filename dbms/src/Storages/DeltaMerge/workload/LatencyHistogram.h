@@ -0,0 +1,60 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace DB::DM::tests
+{
+// A log-linear histogram of latencies in microseconds.
+// Every power of 2 is divided into 16 buckets, so the relative error of percentiles is less than 1/16.
+// It is not thread-safe, each thread records into its own histogram and merges them at last.
+class LatencyHistogram
+{
+public:
+    void add(uint64_t us);
+
+    void merge(const LatencyHistogram & other);
+
+    uint64_t count() const { return total_count; }
+
+    uint64_t max() const { return max_us; }
+
+    double mean() const { return total_count == 0 ? 0 : static_cast<double>(sum_us) / total_count; }
+
+    // `p` is in [0, 1], e.g. 0.99 means p99.
+    uint64_t percentile(double p) const;
+
+    std::string toString() const;
+
+    std::string toJson() const;
+
+private:
+    static constexpr size_t sub_bucket_bits = 4;
+    static constexpr size_t sub_bucket_count = 1 << sub_bucket_bits;
+    static constexpr size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+    static size_t bucketIndex(uint64_t us);
+    // The max value in the bucket.
+    static uint64_t bucketUpperBound(size_t index);
+
+    std::array<uint64_t, bucket_count> buckets{};
+    uint64_t total_count = 0;
+    uint64_t sum_us = 0;
+    uint64_t max_us = 0;
+};
+} // namespace DB::DM::tests
@@ -14,6 +14,7 @@
 
 #include <Common/Config/TOMLConfiguration.h>
 #include <Common/Exception.h>
+#include <Common/FmtUtils.h>
 #include <Common/Logger.h>
 #include <Common/UniThreadPool.h>
 #include <IO/IOThreadPools.h>
@@ -25,6 +26,7 @@
 #include <Storages/DeltaMerge/ReadThread/SegmentReader.h>
 #include <Storages/DeltaMerge/workload/DTWorkload.h>
 #include <Storages/DeltaMerge/workload/Handle.h>
+#include <Storages/DeltaMerge/workload/LatencyHistogram.h>
 #include <Storages/DeltaMerge/workload/Options.h>
 #include <Storages/DeltaMerge/workload/Utils.h>
 #include <Storages/Page/PageConstants.h>
@@ -85,6 +87,14 @@ void initThreadPool()
         /*max_threads*/ default_num_threads,
         /*max_free_threads*/ default_num_threads / 2,
         /*queue_size*/ default_num_threads * 2);
+    RestoreSegmentPool::initialize(
+        /*max_threads*/ default_num_threads,
+        /*max_free_threads*/ default_num_threads / 2,
+        /*queue_size*/ default_num_threads * 8);
+    BlobReadPool::initialize(
+        /*max_threads*/ default_num_threads,
+        /*max_free_threads*/ default_num_threads / 2,
+        /*queue_size*/ default_num_threads * 8);
 }
 
 void initReadThread()
@@ -175,6 +185,53 @@ uint64_t average(const std::vector<uint64_t> & v)
     return std::accumulate(begin, end, 0ul) / count;
 }
 
+// Append the result of a run as a json line to `opts.report_file`, so that it can be compared between releases by scripts.
+void outputReport(
+    Poco::Logger * log,
+    const std::vector<Statistics> & stats,
+    const WorkloadOptions & opts,
+    uint64_t max_init_ms,
+    uint64_t avg_write_per_second,
+    uint64_t avg_read_per_second)
+{
+    std::map<std::string, LatencyHistogram> latencies;
+    for (const auto & stat : stats)
+    {
+        for (const auto & [op, latency] : stat.latencies())
+        {
+            latencies[op].merge(latency);
+        }
+    }
+
+    FmtBuffer fmt_buf;
+    fmt_buf.fmtAppend(
+        R"({{"date":"{}","table":"{}","columns_count":{},"write_key_distribution":"{}","read_type":"{}","write_thread_count":{},"read_thread_count":{},"delete_range_thread_count":{},"ingest_thread_count":{},"init_seconds":{:.2f},"write_per_second":{},"read_per_second":{},"latency":{{)",
+        localDate(),
+        opts.table,
+        opts.columns_count,
+        opts.write_key_distribution,
+        opts.read_type,
+        opts.write_thread_count,
+        opts.read_thread_count,
+        opts.delete_range_thread_count,
+        opts.ingest_thread_count,
+        max_init_ms / 1000.0,
+        avg_write_per_second,
+        avg_read_per_second);
+    fmt_buf.joinStr(
+        latencies.begin(),
+        latencies.end(),
+        [](const auto & op_latency, FmtBuffer & fb) {
+            fb.fmtAppend(R"("{}":{})", op_latency.first, op_latency.second.toJson());
+        },
+        ",");
+    fmt_buf.append("}}");
+
+    std::ofstream ofs(opts.report_file, std::ios::app);
+    ofs << fmt_buf.toString() << std::endl;
+    LOG_INFO(log, "Write report to {}", opts.report_file);
+}
+
 void outputResult(Poco::Logger * log, const std::vector<Statistics> & stats, WorkloadOptions & opts)
 {
     if (stats.empty())
@@ -206,6 +263,11 @@ void outputResult(Poco::Logger * log, const std::vector<Statistics> & stats, Wor
                          avg_read_per_second);
     LOG_INFO(log, s);
     std::cout << s << std::endl;
+
+    if (!opts.report_file.empty())
+    {
+        outputReport(log, stats, opts, max_init_ms, avg_write_per_second, avg_read_per_second);
+    }
 }
 
 std::shared_ptr<SharedHandleTable> createHandleTable(WorkloadOptions & opts)
@@ -327,7 +389,7 @@ void runAndRandomKill(WorkloadOptions & opts, ContextPtr context)
 void dailyPerformanceTest(WorkloadOptions & opts, ContextPtr context)
 {
     outputResultHeader();
-    std::vector<std::string> workloads{"uniform", "normal", "incremental"};
+    std::vector<std::string> workloads{"uniform", "normal", "incremental", "zipfian"};
     for (size_t i = 0; i < workloads.size(); i++)
     {
         opts.write_key_distribution = workloads[i];
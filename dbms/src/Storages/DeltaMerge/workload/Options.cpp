@@ -25,6 +25,7 @@ std::string WorkloadOptions::toString(std::string seperator) const
 {
     return fmt::format("max_key_count {}{}", max_key_count, seperator) + //
         fmt::format("write_key_distribution {}{}", write_key_distribution, seperator) + //
+        fmt::format("zipfian_theta {}{}", zipfian_theta, seperator) + //
         fmt::format("write_count {}{}", write_count, seperator) + //
         fmt::format("write_thread_count {}{}", write_thread_count, seperator) + //
         fmt::format("table {}{}", table, seperator) + //
@@ -42,6 +43,14 @@ std::string WorkloadOptions::toString(std::string seperator) const
         fmt::format("config_file {}{}", config_file, seperator) + //
         fmt::format("read_thread_count {}{}", read_thread_count, seperator) + //
         fmt::format("read_stream_count {}{}", read_stream_count, seperator) + //
+        fmt::format("read_type {}{}", read_type, seperator) + //
+        fmt::format("range_scan_rows {}{}", range_scan_rows, seperator) + //
+        fmt::format("delete_range_thread_count {}{}", delete_range_thread_count, seperator) + //
+        fmt::format("delete_range_rows {}{}", delete_range_rows, seperator) + //
+        fmt::format("delete_range_interval_ms {}{}", delete_range_interval_ms, seperator) + //
+        fmt::format("ingest_thread_count {}{}", ingest_thread_count, seperator) + //
+        fmt::format("ingest_rows {}{}", ingest_rows, seperator) + //
+        fmt::format("ingest_interval_ms {}{}", ingest_interval_ms, seperator) + //
         fmt::format("testing_type {}{}", testing_type, seperator) + //
         fmt::format("log_write_request {}{}", log_write_request, seperator) + //
         fmt::format("ps_run_mode {}{}", magic_enum::enum_name(ps_run_mode), seperator) + //
@@ -49,7 +58,8 @@ std::string WorkloadOptions::toString(std::string seperator) const
         fmt::format("table_id {}{}", table_id, seperator) + //
         fmt::format("table_name {}{}", table_name, seperator) + //
         fmt::format("is_fast_scan {}{}", is_fast_scan, seperator) + //
-        fmt::format("enable_read_thread {}{}", enable_read_thread, seperator);
+        fmt::format("enable_read_thread {}{}", enable_read_thread, seperator) + //
+        fmt::format("report_file {}{}", report_file, seperator);
 }
 
 std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv[])
@@ -60,7 +70,8 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
     desc.add_options() //
         ("help", "produce help message") //
         ("max_key_count", value<uint64_t>()->default_value(20000000), "Default is 2000w.") //
-        ("write_key_distribution", value<std::string>()->default_value("uniform"), "uniform/normal/incremental") //
+        ("write_key_distribution", value<std::string>()->default_value("uniform"), "uniform/normal/incremental/zipfian") //
+        ("zipfian_theta", value<double>()->default_value(0.99), "The skew of zipfian distribution, in (0, 1). The larger the more skewed.") //
         ("write_count", value<uint64_t>()->default_value(5000000), "Default is 500w.") //
         ("write_thread_count", value<uint64_t>()->default_value(4), "") //
         ("max_write_per_sec", value<uint64_t>()->default_value(0), "") //
@@ -85,6 +96,16 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
         //
         ("read_thread_count", value<uint64_t>()->default_value(1), "") //
         ("read_stream_count", value<uint64_t>()->default_value(4), "") //
+        ("read_type", value<std::string>()->default_value("full_scan"), "full_scan/range_scan/point_lookup/mixed") //
+        ("range_scan_rows", value<uint64_t>()->default_value(1000), "The handle range of range_scan, filtered by rough set index") //
+        //
+        ("delete_range_thread_count", value<uint64_t>()->default_value(0), "") //
+        ("delete_range_rows", value<uint64_t>()->default_value(10000), "") //
+        ("delete_range_interval_ms", value<uint64_t>()->default_value(100), "") //
+        //
+        ("ingest_thread_count", value<uint64_t>()->default_value(0), "") //
+        ("ingest_rows", value<uint64_t>()->default_value(100000), "") //
+        ("ingest_interval_ms", value<uint64_t>()->default_value(1000), "") //
         //
         ("testing_type", value<std::string>()->default_value(""), "daily_perf/daily_random") //
         //
@@ -102,7 +123,9 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
         ("s3_bucket", value<std::string>()->default_value(""), "") //
         ("s3_endpoint", value<std::string>()->default_value(""), "") //
         ("s3_access_key_id", value<std::string>()->default_value(""), "") //
-        ("s3_secret_access_key", value<std::string>()->default_value(""), "");
+        ("s3_secret_access_key", value<std::string>()->default_value(""), "") //
+        //
+        ("report_file", value<std::string>()->default_value(""), "Write the result as json into this file if not empty");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
@@ -115,6 +138,11 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
 
     max_key_count = vm["max_key_count"].as<uint64_t>();
     write_key_distribution = vm["write_key_distribution"].as<std::string>();
+    zipfian_theta = vm["zipfian_theta"].as<double>();
+    if (zipfian_theta <= 0 || zipfian_theta >= 1)
+    {
+        return {false, fmt::format("zipfian_theta must be in (0, 1), but got {}.", zipfian_theta)};
+    }
     write_count = vm["write_count"].as<uint64_t>();
     write_thread_count = vm["write_thread_count"].as<uint64_t>();
     max_write_per_sec = vm["max_write_per_sec"].as<uint64_t>();
@@ -160,6 +188,26 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
 
     read_thread_count = vm["read_thread_count"].as<uint64_t>();
     read_stream_count = vm["read_stream_count"].as<uint64_t>();
+    read_type = vm["read_type"].as<std::string>();
+    if (read_type != "full_scan" && read_type != "range_scan" && read_type != "point_lookup" && read_type != "mixed")
+    {
+        return {false, fmt::format("read_type {} is not supported.", read_type)};
+    }
+    range_scan_rows = vm["range_scan_rows"].as<uint64_t>();
+
+    delete_range_thread_count = vm["delete_range_thread_count"].as<uint64_t>();
+    delete_range_rows = vm["delete_range_rows"].as<uint64_t>();
+    delete_range_interval_ms = vm["delete_range_interval_ms"].as<uint64_t>();
+
+    ingest_thread_count = vm["ingest_thread_count"].as<uint64_t>();
+    ingest_rows = vm["ingest_rows"].as<uint64_t>();
+    ingest_interval_ms = vm["ingest_interval_ms"].as<uint64_t>();
+
+    // The handle table used by verification does not know the rows deleted or overwritten by delete range and ingest.
+    if (verification && (delete_range_thread_count > 0 || ingest_thread_count > 0))
+    {
+        return {false, fmt::format("Disallow verification({}) and delete range({}) or ingest({}) are enabled simultaneously.", verification, delete_range_thread_count, ingest_thread_count)};
+    }
 
     testing_type = vm["testing_type"].as<std::string>();
     log_write_request = vm["log_write_request"].as<bool>();
@@ -186,6 +234,8 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
     s3_access_key_id = vm["s3_access_key_id"].as<String>();
     s3_secret_access_key = vm["s3_secret_access_key"].as<String>();
 
+    report_file = vm["report_file"].as<std::string>();
+
     return {true, toString()};
 }
 
@@ -25,6 +25,7 @@ struct WorkloadOptions
 {
     uint64_t max_key_count;
     std::string write_key_distribution;
+    double zipfian_theta;
     uint64_t write_count;
     uint64_t write_thread_count;
 
@@ -50,6 +51,16 @@ struct WorkloadOptions
 
     uint64_t read_thread_count;
     uint64_t read_stream_count;
+    std::string read_type;
+    uint64_t range_scan_rows;
+
+    uint64_t delete_range_thread_count;
+    uint64_t delete_range_rows;
+    uint64_t delete_range_interval_ms;
+
+    uint64_t ingest_thread_count;
+    uint64_t ingest_rows;
+    uint64_t ingest_interval_ms;
 
     std::string testing_type;
 
@@ -70,6 +81,9 @@ struct WorkloadOptions
     String s3_endpoint;
     String s3_access_key_id;
     String s3_secret_access_key;
+
+    std::string report_file;
+
     std::string toString(std::string seperator = "\n") const;
     std::pair<bool, std::string> parseOptions(int argc, char * argv[]);
     void initFailpoints() const;
@@ -20,6 +20,7 @@
 #include <Common/Stopwatch.h>
 #include <Common/TiFlashMetrics.h>
 #include <Common/formatReadable.h>
+#include <IO/IOThreadPools.h>
 #include <Poco/File.h>
 #include <Storages/Page/FileUsage.h>
 #include <Storages/Page/V3/Blob/GCInfo.h>
@@ -34,6 +35,8 @@
 #include <boost_wrapper/string_split.h>
 #include <common/logger_useful.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <ext/scope_guard.h>
 #include <iterator>
 #include <magic_enum.hpp>
@@ -63,6 +66,13 @@ extern const char force_change_all_blobs_to_read_only[];
 namespace PS::V3
 {
 static constexpr bool BLOBSTORE_CHECKSUM_ON_READ = true;
+// Ranges in the same blob file with a gap not larger than this are merged into one read
+static constexpr size_t BLOBSTORE_READ_MERGE_GAP = 32 * 1024;
+// The max bytes of one merged read
+static constexpr size_t BLOBSTORE_READ_MERGE_MAX_BYTES = 4 * 1024 * 1024;
+// The merged reads are issued concurrently only when there are at least this many bytes to read
+static constexpr size_t BLOBSTORE_PARALLEL_READ_MIN_BYTES = 1024 * 1024;
+static constexpr size_t BLOBSTORE_PARALLEL_READ_MAX_WORKERS = 8;
 
 using BlobStatPtr = BlobStats::BlobStatPtr;
 using ChecksumClass = Digest::CRC64;
@@ -679,11 +689,13 @@ BlobStore<Trait>::read(FieldReadInfos & to_read, const ReadLimiterPtr & read_lim
 
     ProfileEvents::increment(ProfileEvents::PSMReadPages, to_read.size());
 
-    // Sort in ascending order by offset in file.
+    // Sort in ascending order by (file, offset) so that near-adjacent fields can be merged into one read.
     std::sort(
         to_read.begin(),
         to_read.end(),
-        [](const FieldReadInfo & a, const FieldReadInfo & b) { return a.entry.offset < b.entry.offset; });
+        [](const FieldReadInfo & a, const FieldReadInfo & b) {
+            return std::tie(a.entry.file_id, a.entry.offset) < std::tie(b.entry.file_id, b.entry.offset);
+        });
 
     // allocate data_buf that can hold all pages with specify fields
 
@@ -740,6 +752,23 @@ BlobStore<Trait>::read(FieldReadInfos & to_read, const ReadLimiterPtr & read_lim
         free(p, buf_size);
     });
 
+    {
+        ReadRanges ranges;
+        char * write_offset = shared_data_buf;
+        for (const auto & [page_id_v3, entry, fields] : to_read)
+        {
+            for (const auto field_index : fields)
+            {
+                const auto [beg_offset, end_offset] = entry.getFieldOffsets(field_index);
+                const auto size_to_read = end_offset - beg_offset;
+                if (size_to_read != 0)
+                    ranges.emplace_back(ReadRange{page_id_v3, entry.file_id, entry.offset + beg_offset, size_to_read, write_offset});
+                write_offset += size_to_read;
+            }
+        }
+        readRanges(ranges, read_limiter);
+    }
+
     std::set<FieldOffsetInsidePage> fields_offset_in_page;
     char * pos = shared_data_buf;
     for (const auto & [page_id_v3, entry, fields] : to_read)
@@ -748,10 +777,8 @@ BlobStore<Trait>::read(FieldReadInfos & to_read, const ReadLimiterPtr & read_lim
         char * write_offset = pos;
         for (const auto field_index : fields)
         {
-            // TODO: Continuously fields can read by one system call.
             const auto [beg_offset, end_offset] = entry.getFieldOffsets(field_index);
             const auto size_to_read = end_offset - beg_offset;
-            auto blob_file = read(page_id_v3, entry.file_id, entry.offset + beg_offset, write_offset, size_to_read, read_limiter);
             fields_offset_in_page.emplace(field_index, read_size_this_entry);
 
             if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
@@ -774,7 +801,7 @@ BlobStore<Trait>::read(FieldReadInfos & to_read, const ReadLimiterPtr & read_lim
                                     beg_offset,
                                     size_to_read,
                                     entry,
-                                    blob_file->getPath()),
+                                    getBlobFile(entry.file_id)->getPath()),
                         ErrorCodes::CHECKSUM_DOESNT_MATCH);
                 }
             }
@@ -824,9 +851,9 @@ BlobStore<Trait>::read(PageIdAndEntries & entries, const ReadLimiterPtr & read_l
 
     ProfileEvents::increment(ProfileEvents::PSMReadPages, entries.size());
 
-    // Sort in ascending order by offset in file.
+    // Sort in ascending order by (file, offset) so that near-adjacent pages can be merged into one read.
     std::sort(entries.begin(), entries.end(), [](const auto & a, const auto & b) {
-        return a.second.offset < b.second.offset;
+        return std::tie(a.second.file_id, a.second.offset) < std::tie(b.second.file_id, b.second.offset);
     });
 
     // allocate data_buf that can hold all pages
@@ -856,12 +883,23 @@ BlobStore<Trait>::read(PageIdAndEntries & entries, const ReadLimiterPtr & read_l
         free(p, buf_size);
     });
 
+    {
+        ReadRanges ranges;
+        ranges.reserve(entries.size());
+        char * write_offset = data_buf;
+        for (const auto & [page_id_v3, entry] : entries)
+        {
+            if (entry.size != 0)
+                ranges.emplace_back(ReadRange{page_id_v3, entry.file_id, entry.offset, entry.size, write_offset});
+            write_offset += entry.size;
+        }
+        readRanges(ranges, read_limiter);
+    }
+
     char * pos = data_buf;
     PageMap page_map;
     for (const auto & [page_id_v3, entry] : entries)
     {
-        auto blob_file = read(page_id_v3, entry.file_id, entry.offset, pos, entry.size, read_limiter);
-
         if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
         {
             ChecksumClass digest;
@@ -875,7 +913,7 @@ BlobStore<Trait>::read(PageIdAndEntries & entries, const ReadLimiterPtr & read_l
                                 entry.checksum,
                                 checksum,
                                 entry,
-                                blob_file->getPath()),
+                                getBlobFile(entry.file_id)->getPath()),
                     ErrorCodes::CHECKSUM_DOESNT_MATCH);
             }
         }
@@ -993,6 +1031,133 @@ BlobFilePtr BlobStore<Trait>::read(const typename BlobStore<Trait>::PageId & pag
     return blob_file;
 }
 
+template <typename Trait>
+size_t BlobStore<Trait>::readRanges(const ReadRanges & ranges, const ReadLimiterPtr & read_limiter)
+{
+    if (ranges.empty())
+        return 0;
+
+    // Split the ranges into groups, each group is read by one merged read.
+    // Note the ranges may overlap when different pages share the same entry.
+    std::vector<std::pair<size_t, size_t>> groups; // [begin, end) of ranges
+    size_t total_bytes = 0;
+    for (size_t begin = 0; begin < ranges.size();)
+    {
+        const auto & first = ranges[begin];
+        BlobFileOffset group_end = first.offset + first.size;
+        size_t end = begin + 1;
+        for (; end < ranges.size(); ++end)
+        {
+            const auto & range = ranges[end];
+            const auto new_group_end = std::max(group_end, range.offset + range.size);
+            if (range.file_id != first.file_id
+                || range.offset > group_end + BLOBSTORE_READ_MERGE_GAP
+                || new_group_end - first.offset > BLOBSTORE_READ_MERGE_MAX_BYTES)
+                break;
+            group_end = new_group_end;
+        }
+        total_bytes += group_end - first.offset;
+        groups.emplace_back(begin, end);
+        begin = end;
+    }
+
+    if (groups.size() == 1 || total_bytes < BLOBSTORE_PARALLEL_READ_MIN_BYTES || !BlobReadPool::instance)
+    {
+        for (const auto & [begin, end] : groups)
+            readMergedRanges(ranges.data() + begin, ranges.data() + end, read_limiter);
+        return groups.size();
+    }
+
+    // Issue the merged reads concurrently. The current thread is one of the workers and
+    // the others are scheduled to `BlobReadPool`. The state is shared with the scheduled
+    // workers, a worker that starts after all groups are claimed returns without touching
+    // anything else. So we only wait for the running workers and never block on the tasks
+    // still queued in the pool.
+    struct ParallelReadState
+    {
+        const size_t num_groups;
+        std::atomic<size_t> next_group = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t running = 0;
+        std::exception_ptr first_exception;
+
+        explicit ParallelReadState(size_t num_groups_)
+            : num_groups(num_groups_)
+        {}
+    };
+    auto state = std::make_shared<ParallelReadState>(groups.size());
+    auto read_worker = [this, state, &ranges, &groups, &read_limiter] {
+        {
+            std::lock_guard lock(state->mutex);
+            ++state->running;
+        }
+        for (size_t i = state->next_group.fetch_add(1); i < state->num_groups; i = state->next_group.fetch_add(1))
+        {
+            try
+            {
+                const auto & [begin, end] = groups[i];
+                readMergedRanges(ranges.data() + begin, ranges.data() + end, read_limiter);
+            }
+            catch (...)
+            {
+                // Stop other workers from claiming more groups
+                state->next_group = state->num_groups;
+                std::lock_guard lock(state->mutex);
+                if (!state->first_exception)
+                    state->first_exception = std::current_exception();
+                break;
+            }
+        }
+        std::lock_guard lock(state->mutex);
+        --state->running;
+        state->cv.notify_all();
+    };
+
+    const size_t num_workers = std::min(groups.size(), BLOBSTORE_PARALLEL_READ_MAX_WORKERS);
+    for (size_t i = 1; i < num_workers; ++i)
+    {
+        if (!BlobReadPool::get().trySchedule(read_worker))
+            break;
+    }
+    read_worker();
+
+    std::unique_lock lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->running == 0; });
+    if (state->first_exception)
+        std::rethrow_exception(state->first_exception);
+    return groups.size();
+}
+
+template <typename Trait>
+void BlobStore<Trait>::readMergedRanges(const ReadRange * begin, const ReadRange * end, const ReadLimiterPtr & read_limiter)
+{
+    assert(begin < end);
+    // Whether the ranges are continuous both in the blob file and in the buffers,
+    // then they can be read into the buffers directly.
+    bool continuous = true;
+    BlobFileOffset read_end = begin->offset + begin->size;
+    for (const auto * range = begin + 1; range != end; ++range)
+    {
+        const auto * prev = range - 1;
+        continuous = continuous && range->offset == prev->offset + prev->size && range->buf == prev->buf + prev->size;
+        read_end = std::max(read_end, range->offset + range->size);
+    }
+    const size_t read_size = read_end - begin->offset;
+    if (continuous)
+    {
+        read(begin->page_id, begin->file_id, begin->offset, begin->buf, read_size, read_limiter);
+        return;
+    }
+
+    // Read the whole span into a temporary buffer and copy out each range
+    char * tmp_buf = static_cast<char *>(alloc(read_size));
+    SCOPE_EXIT({ free(tmp_buf, read_size); });
+    read(begin->page_id, begin->file_id, begin->offset, tmp_buf, read_size, read_limiter);
+    for (const auto * range = begin; range != end; ++range)
+        memcpy(range->buf, tmp_buf + (range->offset - begin->offset), range->size);
+}
+
 
 template <typename Trait>
 std::vector<BlobFileId> BlobStore<Trait>::getGCStats()
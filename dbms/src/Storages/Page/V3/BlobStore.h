@@ -102,6 +102,28 @@ private:
 
     BlobFilePtr read(const PageId & page_id_v3, BlobFileId blob_id, BlobFileOffset offset, char * buffers, size_t size, const ReadLimiterPtr & read_limiter = nullptr, bool background = false);
 
+    // A continuous range in the blob file that should be read into `buf`.
+    struct ReadRange
+    {
+        PageId page_id;
+        BlobFileId file_id;
+        BlobFileOffset offset;
+        size_t size;
+        char * buf;
+    };
+    using ReadRanges = std::vector<ReadRange>;
+
+    /**
+     *  Read all `ranges` into their buffers. `ranges` must be sorted by (file_id, offset).
+     *  Adjacent or near-adjacent ranges in the same blob file are merged into one read,
+     *  and the merged reads are issued concurrently when there are enough bytes to read.
+     *  Return the number of merged reads issued.
+     */
+    size_t readRanges(const ReadRanges & ranges, const ReadLimiterPtr & read_limiter);
+
+    // Read the ranges in [begin, end), which are in the same blob file, by one read.
+    void readMergedRanges(const ReadRange * begin, const ReadRange * end, const ReadLimiterPtr & read_limiter);
+
     /**
      *  Ask BlobStats to get a span from BlobStat.
      *  We will lock BlobStats until we get a BlobStat that can hold the size.
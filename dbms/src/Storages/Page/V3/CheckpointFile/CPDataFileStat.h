@@ -31,9 +31,16 @@ struct CPDataWriteStats
     bool has_new_data = false;
     size_t incremental_data_bytes = 0;
     size_t rewrite_data_bytes = 0;
+    // The bytes written into the data file, after compression and deduplication.
+    size_t written_data_bytes = 0;
+    // The bytes skipped because the same data has been written into the data file.
+    size_t deduplicated_data_bytes = 0;
 };
 
 using RemoteFileValidSizes = std::unordered_map<String, size_t>;
+// file_id -> the offsets of the records counted into `RemoteFileValidSizes`.
+// Pages with the same data share one record in a data file, which should be counted only once.
+using RemoteFileCountedRecords = std::unordered_map<String, std::unordered_set<UInt64>>;
 
 struct CPDataFileStat
 {
@@ -12,7 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Encryption/PosixRandomAccessFile.h>
+#include <Storages/Page/PageUtil.h>
 #include <Storages/Page/V3/CheckpointFile/CPDataFileWriter.h>
+#include <city.h>
+
+namespace DB
+{
+template <typename Buffer>
+extern size_t CompressionEncode(
+    std::string_view source,
+    const CompressionSettings & compression_settings,
+    Buffer & compressed_buffer);
+} // namespace DB
 
 namespace DB::PS::V3
 {
@@ -32,8 +44,45 @@ CheckpointLocation CPDataFileWriter::write(UniversalPageId page_id, PageVersion
 {
     RUNTIME_CHECK_MSG(write_stage == WriteStage::WritingRecords, "unexpected write stage {}", magic_enum::enum_name(write_stage));
 
+    auto * suffix_record = file_suffix.add_records();
+    suffix_record->set_page_id(page_id.asStr());
+    suffix_record->set_version_sequence(version.sequence);
+    suffix_record->set_version_epoch(version.epoch);
+
+    // Only keep the compressed data when it is smaller.
+    const char * data_to_write = data;
+    size_t size_to_write = n;
+    bool is_compressed = false;
+    if (compression_settings.method != CompressionMethod::NONE && n > 0)
+    {
+        size_t compressed_size = CompressionEncode({data, n}, compression_settings, compressed_buffer);
+        if (compressed_size < n)
+        {
+            data_to_write = compressed_buffer.data();
+            size_to_write = compressed_size;
+            is_compressed = true;
+        }
+    }
+
+    // Reuse the record written before if the data is the same.
+    auto hash = CityHash_v1_0_2::CityHash128(data, n);
+    UInt128 data_hash(hash.first, hash.second);
+    if (auto iter = written_data.find(data_hash); iter != written_data.end() && iter->second.size == n)
+    {
+        // The same data is always compressed into the same bytes, so compare the bytes to be written.
+        const auto & location = iter->second.location;
+        if (location.is_compressed == is_compressed && isWrittenData(location, data_to_write, size_to_write))
+        {
+            suffix_record->set_offset_in_file(location.offset_in_file);
+            suffix_record->set_size_in_file(location.size_in_file);
+            suffix_record->set_is_compressed(location.is_compressed);
+            deduplicated_bytes += n;
+            return location;
+        }
+    }
+
     // Every record is prefixed with the length, so that this data file can be parsed standalone.
-    writeIntBinary(n, *file_writer);
+    writeIntBinary(size_to_write, *file_writer);
 
     // TODO: getMaterializedBytes only works for FramedChecksumWriteBuffer, but does not work for a normal WriteBufferFromFile.
     //       There must be something wrong and should be fixed.
@@ -42,22 +91,39 @@ CheckpointLocation CPDataFileWriter::write(UniversalPageId page_id, PageVersion
     // uint64_t write_n = file_writer->getMaterializedBytes() - file_offset;
 
     uint64_t file_offset = file_writer->count();
-    file_writer->write(data, n);
+    file_writer->write(data_to_write, size_to_write);
     uint64_t write_n = file_writer->count() - file_offset;
-    RUNTIME_CHECK(write_n == n, write_n, n); // Note: When we add compression later, write_n == n may be false.
+    RUNTIME_CHECK(write_n == size_to_write, write_n, size_to_write);
+    written_bytes += write_n;
 
-    auto * suffix_record = file_suffix.add_records();
-    suffix_record->set_page_id(page_id.asStr());
-    suffix_record->set_version_sequence(version.sequence);
-    suffix_record->set_version_epoch(version.epoch);
     suffix_record->set_offset_in_file(file_offset);
     suffix_record->set_size_in_file(write_n);
+    suffix_record->set_is_compressed(is_compressed);
 
-    return CheckpointLocation{
+    CheckpointLocation location{
         .data_file_id = file_id,
         .offset_in_file = file_offset,
         .size_in_file = write_n,
+        .is_compressed = is_compressed,
     };
+    written_data.emplace(data_hash, WrittenData{.size = n, .location = location});
+    return location;
+}
+
+bool CPDataFileWriter::isWrittenData(const CheckpointLocation & location, const char * data, size_t n)
+{
+    if (location.size_in_file != n)
+        return false;
+    if (n == 0)
+        return true;
+
+    // Make the written records visible to the reader.
+    file_writer->next();
+    if (!file_reader)
+        file_reader = PosixRandomAccessFile::create(file_path);
+    read_buffer.resize(n);
+    PageUtil::readFile(file_reader, location.offset_in_file, read_buffer.data(), n, /*read_limiter*/ nullptr);
+    return memcmp(read_buffer.data(), data, n) == 0;
 }
 
 void CPDataFileWriter::writeSuffix()
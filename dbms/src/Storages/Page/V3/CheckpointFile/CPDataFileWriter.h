@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <Common/PODArray.h>
+#include <Core/Types.h>
+#include <Encryption/RandomAccessFile.h>
+#include <IO/CompressionSettings.h>
 #include <IO/WriteBufferFromFile.h>
 #include <Poco/File.h>
 #include <Poco/Path.h>
@@ -27,6 +31,7 @@
 
 #include <magic_enum.hpp>
 #include <string>
+#include <unordered_map>
 
 namespace DB::PS::V3
 {
@@ -38,6 +43,12 @@ public:
     {
         const std::string & file_path;
         const std::string & file_id;
+
+        /**
+         * Each record is compressed into a standalone compressed block, so that it
+         * can still be read by its offset and size. NONE means not compressed.
+         */
+        const CompressionMethod compression_method = CompressionMethod::NONE;
     };
 
     static CPDataFileWriterPtr create(Options options)
@@ -46,13 +57,14 @@ public:
     }
 
     explicit CPDataFileWriter(Options options)
-        : file_writer(std::make_unique<WriteBufferFromFile>(options.file_path))
+        : file_path(options.file_path)
+        , file_writer(std::make_unique<WriteBufferFromFile>(options.file_path))
         , file_id(std::make_shared<std::string>(options.file_id))
+        , compression_settings(options.compression_method)
     {
         // TODO: FramedChecksumWriteBuffer does not support random access for arbitrary frame sizes.
         //   So currently we use checksum = false.
         //   Need to update FramedChecksumWriteBuffer first.
-        // TODO: Support compressed data file.
     }
 
     ~CPDataFileWriter()
@@ -77,6 +89,18 @@ public:
         return file_suffix.records_size();
     }
 
+    /// The bytes of the records in the data file, after compression and deduplication.
+    size_t writtenBytes() const
+    {
+        return written_bytes;
+    }
+
+    /// The bytes of the records not written because the same data has been written.
+    size_t deduplicatedBytes() const
+    {
+        return deduplicated_bytes;
+    }
+
 private:
     enum class WriteStage
     {
@@ -85,9 +109,32 @@ private:
         WritingFinished,
     };
 
+    /// Whether the record at `location` is exactly `data`, by reading it back from the file.
+    bool isWrittenData(const CheckpointLocation & location, const char * data, size_t n);
+
+    const std::string file_path;
     const std::unique_ptr<WriteBufferFromFile> file_writer;
     const std::shared_ptr<const std::string> file_id; // Shared in each write result
 
+    const CompressionSettings compression_settings;
+    PODArray<char> compressed_buffer;
+
+    // The hash of the data -> the location of the data in this file.
+    // Pages with the same data share one record, e.g. the same data rewritten by compaction.
+    // The record is read back and compared before being shared, the hash alone is not trusted.
+    struct WrittenData
+    {
+        size_t size;
+        CheckpointLocation location;
+    };
+    std::unordered_map<UInt128, WrittenData> written_data;
+    // Opened on the first hit of `written_data`.
+    RandomAccessFilePtr file_reader;
+    PODArray<char> read_buffer;
+
+    size_t written_bytes = 0;
+    size_t deduplicated_bytes = 0;
+
     CheckpointProto::DataFileSuffix file_suffix;
     WriteStage write_stage = WriteStage::WritingPrefix;
 };
@@ -25,6 +25,7 @@ CPFilesWriter::CPFilesWriter(CPFilesWriter::Options options)
     , data_writer(CPDataFileWriter::create({
           .file_path = options.data_file_path,
           .file_id = options.data_file_id,
+          .compression_method = options.compression_method,
       }))
     , manifest_writer(CPManifestFileWriter::create({
           .file_path = options.manifest_file_path,
@@ -73,6 +74,8 @@ CPDataWriteStats CPFilesWriter::writeEditsAndApplyCheckpointInfo(
 
     CPDataWriteStats write_down_stats;
     std::unordered_map<String, size_t> rewrite_stats;
+    const size_t written_bytes_before = data_writer->writtenBytes();
+    const size_t deduplicated_bytes_before = data_writer->deduplicatedBytes();
 
     // 1. Iterate all edits, find these entry edits without the checkpoint info
     //    and collect the lock files from applied entries.
@@ -144,6 +147,8 @@ CPDataWriteStats CPFilesWriter::writeEditsAndApplyCheckpointInfo(
     manifest_writer->writeEdits(edits);
 
     write_down_stats.has_new_data = data_writer->writtenRecords() > 0;
+    write_down_stats.written_data_bytes = data_writer->writtenBytes() - written_bytes_before;
+    write_down_stats.deduplicated_data_bytes = data_writer->deduplicatedBytes() - deduplicated_bytes_before;
     return write_down_stats;
 }
 
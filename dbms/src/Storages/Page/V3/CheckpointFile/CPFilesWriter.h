@@ -46,6 +46,11 @@ public:
          * lock files from `writeEditsAndApplyCheckpointInfo`.
          */
         const std::unordered_set<String> & must_locked_files = {};
+
+        /**
+         * The compression method of the records in the data file.
+         */
+        const CompressionMethod compression_method = CompressionMethod::NONE;
     };
 
     static CPFilesWriterPtr create(Options options)
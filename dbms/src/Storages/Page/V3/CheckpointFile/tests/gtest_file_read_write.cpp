@@ -14,7 +14,10 @@
 
 #include <Common/FailPoint.h>
 #include <Encryption/PosixRandomAccessFile.h>
+#include <IO/CompressedReadBuffer.h>
 #include <IO/ReadBufferFromRandomAccessFile.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/ReadHelpers.h>
 #include <Storages/Page/V3/CheckpointFile/CPFilesWriter.h>
 #include <Storages/Page/V3/CheckpointFile/CPManifestFileReader.h>
 #include <Storages/Page/V3/CheckpointFile/CPWriteDataSource.h>
@@ -667,4 +670,70 @@ try
 }
 CATCH
 
+TEST_F(CheckpointFileTest, WriteCompressedAndDeduplicatedData)
+try
+{
+    const std::string compressible_data(1000, 'a');
+    auto writer = CPFilesWriter::create({
+        .data_file_path = dir + "/data_1",
+        .data_file_id = "data_1",
+        .manifest_file_path = dir + "/manifest_foo",
+        .manifest_file_id = "manifest_foo",
+        .data_source = CPWriteDataSourceFixture::create({{5, compressible_data},
+                                                         {10, compressible_data},
+                                                         {20, "nahida"}}),
+        .compression_method = CompressionMethod::LZ4,
+    });
+
+    writer->writePrefix({
+        .writer = {},
+        .sequence = 5,
+        .last_sequence = 3,
+    });
+    auto edits = universal::PageEntriesEdit{};
+    edits.appendRecord({.type = EditRecordType::VAR_ENTRY, .page_id = "abc", .entry = {.size = 1000, .offset = 5}});
+    edits.appendRecord({.type = EditRecordType::VAR_ENTRY, .page_id = "def", .entry = {.size = 1000, .offset = 10}});
+    edits.appendRecord({.type = EditRecordType::VAR_ENTRY, .page_id = "xyz", .entry = {.size = 6, .offset = 20}});
+    auto stats = writer->writeEditsAndApplyCheckpointInfo(edits);
+    writer->writeSuffix();
+    writer.reset();
+
+    const auto & r = edits.getRecords();
+    // The compressible data is compressed, and only written once.
+    const auto & location = r[0].entry.checkpoint_info.data_location;
+    ASSERT_TRUE(location.is_compressed);
+    ASSERT_LT(location.size_in_file, 1000);
+    ASSERT_EQ(location.offset_in_file, r[1].entry.checkpoint_info.data_location.offset_in_file);
+    ASSERT_TRUE(r[1].entry.checkpoint_info.data_location.is_compressed);
+    {
+        auto compressed = readData(location);
+        ReadBufferFromString compressed_buf(compressed);
+        CompressedReadBuffer<false> decompressed_buf(compressed_buf);
+        std::string decompressed;
+        readStringUntilEOF(decompressed, decompressed_buf);
+        ASSERT_EQ(compressible_data, decompressed);
+    }
+    // The data is not compressed if it can not be smaller.
+    ASSERT_FALSE(r[2].entry.checkpoint_info.data_location.is_compressed);
+    ASSERT_EQ("nahida", readData(r[2].entry.checkpoint_info.data_location));
+
+    ASSERT_EQ(2006, stats.incremental_data_bytes);
+    ASSERT_EQ(1000, stats.deduplicated_data_bytes);
+    ASSERT_EQ(location.size_in_file + 6, stats.written_data_bytes);
+
+    // The compression info is kept in the manifest.
+    auto manifest_file = PosixRandomAccessFile::create(dir + "/manifest_foo");
+    auto manifest_reader = CPManifestFileReader::create({
+        .plain_file = manifest_file,
+    });
+    manifest_reader->readPrefix();
+    CheckpointProto::StringsInternMap im;
+    auto edits_r = manifest_reader->readEdits(im);
+    ASSERT_TRUE(edits_r.has_value());
+    ASSERT_EQ(3, edits_r->size());
+    ASSERT_TRUE(edits_r->getRecords()[0].entry.checkpoint_info.data_location.is_compressed);
+    ASSERT_FALSE(edits_r->getRecords()[2].entry.checkpoint_info.data_location.is_compressed);
+}
+CATCH
+
 } // namespace DB::PS::V3::tests
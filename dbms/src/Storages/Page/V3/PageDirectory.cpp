@@ -700,6 +700,7 @@ bool VersionedPageEntries<Trait>::cleanOutdatedEntries(
     std::map<PageId, std::pair<PageVersion, Int64>> * normal_entries_to_deref,
     PageEntriesV3 * entries_removed,
     RemoteFileValidSizes * remote_file_sizes,
+    RemoteFileCountedRecords * remote_counted_records,
     const PageLock & /*page_lock*/)
 {
     if (type == EditRecordType::VAR_EXTERNAL)
@@ -757,6 +758,7 @@ bool VersionedPageEntries<Trait>::cleanOutdatedEntries(
 
     if (remote_file_sizes)
     {
+        assert(remote_counted_records != nullptr);
         // the entries after `iter` are valid, collect the remote info size for remote GC
         for (auto valid_iter = iter; valid_iter != entries.end(); ++valid_iter)
         {
@@ -766,6 +768,9 @@ bool VersionedPageEntries<Trait>::cleanOutdatedEntries(
             if (!entry.checkpoint_info.has_value())
                 continue;
             const auto & file_id = *entry.checkpoint_info.data_location.data_file_id;
+            // The deduplicated pages share the same record in the data file.
+            if (!(*remote_counted_records)[file_id].emplace(entry.checkpoint_info.data_location.offset_in_file).second)
+                continue;
             auto file_size_iter = remote_file_sizes->try_emplace(file_id, 0);
             file_size_iter.first->second += entry.checkpoint_info.data_location.size_in_file;
         }
@@ -862,7 +867,7 @@ bool VersionedPageEntries<Trait>::derefAndClean(
             return false;
         // Clean outdated entries after decreased the ref-counter
         // set `normal_entries_to_deref` to be nullptr to ignore cleaning ref-var-entries
-        return cleanOutdatedEntries(lowest_seq, /*normal_entries_to_deref*/ nullptr, entries_removed, /*remote_file_sizes*/ nullptr, page_lock);
+        return cleanOutdatedEntries(lowest_seq, /*normal_entries_to_deref*/ nullptr, entries_removed, /*remote_file_sizes*/ nullptr, /*remote_counted_records*/ nullptr, page_lock);
     }
 
     throw Exception(fmt::format("calling derefAndClean with invalid state [state={}]", toDebugString()));
@@ -1780,16 +1785,26 @@ bool PageDirectory<Trait>::tryDumpSnapshot(const ReadLimiterPtr & read_limiter,
     auto edit_from_disk = collapsed_dir->dumpSnapshotToEdit();
     files_snap.num_records = edit_from_disk.size();
     files_snap.read_elapsed_ms = watch.elapsedMilliseconds();
-    if constexpr (std::is_same_v<Trait, u128::PageDirectoryTrait>)
-    {
-        bool done_any_io = wal->saveSnapshot(std::move(files_snap), Trait::Serializer::serializeTo(edit_from_disk), write_limiter);
-        return done_any_io;
-    }
-    else if constexpr (std::is_same_v<Trait, universal::PageDirectoryTrait>)
+
+    // Split the snapshot into multiple log records. The records of a snapshot only depend on
+    // the records of the same page, so they can be decoded in parallel when restoring.
+    std::vector<String> serialized_snap_records;
+    auto & records = edit_from_disk.getMutRecords();
+    size_t offset = 0;
+    do
     {
-        bool done_any_io = wal->saveSnapshot(std::move(files_snap), Trait::Serializer::serializeInCompressedFormTo(edit_from_disk), write_limiter);
-        return done_any_io;
-    }
+        const size_t end = std::min(records.size(), offset + SNAPSHOT_RECORDS_PER_LOG_RECORD);
+        PageEntriesEdit chunk(end - offset);
+        chunk.getMutRecords().assign(std::make_move_iterator(records.begin() + offset), std::make_move_iterator(records.begin() + end));
+        if constexpr (std::is_same_v<Trait, u128::PageDirectoryTrait>)
+            serialized_snap_records.emplace_back(Trait::Serializer::serializeTo(chunk));
+        else if constexpr (std::is_same_v<Trait, universal::PageDirectoryTrait>)
+            serialized_snap_records.emplace_back(Trait::Serializer::serializeInCompressedFormTo(chunk));
+        offset = end;
+    } while (offset < records.size());
+
+    bool done_any_io = wal->saveSnapshot(std::move(files_snap), std::move(serialized_snap_records), write_limiter);
+    return done_any_io;
 }
 
 template <typename Trait>
@@ -1888,6 +1903,7 @@ typename PageDirectory<Trait>::PageEntries PageDirectory<Trait>::gcInMemEntries(
     // The page_id that we need to decrease ref count
     // { id_0: <version, num to decrease>, id_1: <...>, ... }
     std::map<PageId, std::pair<PageVersion, Int64>> normal_entries_to_deref;
+    RemoteFileCountedRecords remote_counted_records;
     // Iterate all page_id and try to clean up useless var entries
     while (true)
     {
@@ -1898,6 +1914,7 @@ typename PageDirectory<Trait>::PageEntries PageDirectory<Trait>::gcInMemEntries(
             &normal_entries_to_deref,
             options.need_removed_entries ? &all_del_entries : nullptr,
             options.remote_valid_sizes,
+            &remote_counted_records,
             iter->second->acquireLock());
 
         {
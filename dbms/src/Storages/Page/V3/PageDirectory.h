@@ -214,6 +214,8 @@ public:
      *   to be decreased the ref count by `derefAndClean`.
      *   The elem is <page_id, <version, num to decrease ref count>> 
      * `entries_removed`: Return the entries removed from the version list
+     * `remote_file_sizes`: Return the valid size of the remote data files, the records
+     *   in `remote_counted_records` are skipped and the newly counted records are added.
      *
      * Return `true` iff this page can be totally removed from the whole `PageDirectory`.
      */
@@ -222,6 +224,7 @@ public:
         std::map<PageId, std::pair<PageVersion, Int64>> * normal_entries_to_deref,
         PageEntriesV3 * entries_removed,
         RemoteFileValidSizes * remote_file_sizes,
+        RemoteFileCountedRecords * remote_counted_records,
         const PageLock & page_lock);
     /**
      * Decrease the ref-count of entry with given `deref_ver`.
@@ -467,6 +470,9 @@ private:
     WALStorePtr wal;
     const UInt64 max_persisted_log_files;
     LoggerPtr log;
+
+    // The max number of edit records serialized into one log record when dumping snapshot
+    static constexpr size_t SNAPSHOT_RECORDS_PER_LOG_RECORD = 100'000;
 };
 
 namespace u128
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/UniThreadPool.h>
 #include <Storages/Page/V3/PageDefines.h>
 #include <Storages/Page/V3/PageDirectory.h>
 #include <Storages/Page/V3/PageDirectoryFactory.h>
@@ -152,7 +153,24 @@ void PageDirectoryFactory<Trait>::applyRecord(
     const PageDirectoryPtr & dir,
     const typename PageEntriesEdit::EditRecord & r)
 {
-    auto [iter, created] = dir->mvcc_table_directory.insert(std::make_pair(r.page_id, nullptr));
+    auto & mvcc_table = dir->mvcc_table_directory;
+    typename std::remove_reference_t<decltype(mvcc_table)>::iterator iter;
+    bool created = false;
+    // The records of a directory snapshot are sorted by page id. Inserting with the hint at the end
+    // turns restoring from the snapshot into bulk insertions instead of a tree search per record.
+    if (mvcc_table.empty() || mvcc_table.rbegin()->first < r.page_id)
+    {
+        iter = mvcc_table.emplace_hint(mvcc_table.end(), r.page_id, nullptr);
+        created = true;
+    }
+    else if (mvcc_table.rbegin()->first == r.page_id)
+    {
+        iter = std::prev(mvcc_table.end());
+    }
+    else
+    {
+        std::tie(iter, created) = mvcc_table.insert(std::make_pair(r.page_id, nullptr));
+    }
     if (created)
     {
         if constexpr (std::is_same_v<Trait, u128::FactoryTrait>)
@@ -278,7 +296,20 @@ void PageDirectoryFactory<Trait>::applyRecord(
 template <typename Trait>
 void PageDirectoryFactory<Trait>::loadFromDisk(const PageDirectoryPtr & dir, WALStoreReaderPtr && reader)
 {
+    // The records are read sequentially but decoded in parallel by batches. The decoded edits
+    // are applied in the order of the records, because an edit could depend on the previous ones
+    // (ref, upsert, delete), no matter the page id they belong to.
     DataFileIdSet data_file_ids;
+    std::vector<String> batch;
+    size_t batch_bytes = 0;
+    auto apply_batch = [&]() {
+        auto edits = deserializeRecords(batch, data_file_ids);
+        for (const auto & edit : edits)
+            loadEdit(dir, edit);
+        batch.clear();
+        batch_bytes = 0;
+    };
+
     while (reader->remained())
     {
         auto record = reader->next();
@@ -292,22 +323,65 @@ void PageDirectoryFactory<Trait>::loadFromDisk(const PageDirectoryPtr & dir, WAL
             break;
         }
 
-        // apply the edit read
-        if constexpr (std::is_same_v<Trait, u128::FactoryTrait>)
-        {
-            auto edit = Trait::Serializer::deserializeFrom(record.value(), nullptr);
-            loadEdit(dir, edit);
-        }
-        else if constexpr (std::is_same_v<Trait, universal::FactoryTrait>)
+        batch_bytes += record->size();
+        batch.emplace_back(std::move(*record));
+        if (batch.size() >= decode_threads * 4 || batch_bytes >= MAX_DECODE_BATCH_BYTES)
+            apply_batch();
+    }
+    apply_batch();
+}
+
+template <typename Trait>
+std::vector<typename PageDirectoryFactory<Trait>::PageEntriesEdit>
+PageDirectoryFactory<Trait>::deserializeRecords(const std::vector<String> & records, DataFileIdSet & data_file_ids)
+{
+    static_assert(std::is_same_v<Trait, u128::FactoryTrait> || std::is_same_v<Trait, universal::FactoryTrait>, "unknown impl");
+    constexpr bool need_data_file_ids = std::is_same_v<Trait, universal::FactoryTrait>;
+
+    std::vector<PageEntriesEdit> edits(records.size());
+    size_t total_bytes = 0;
+    for (const auto & record : records)
+        total_bytes += record.size();
+    // Decoding small records in parallel is not worth the cost of scheduling
+    if (records.size() <= 1 || decode_threads <= 1 || total_bytes < MIN_PARALLEL_DECODE_BYTES)
+    {
+        for (size_t i = 0; i < records.size(); ++i)
+            edits[i] = Trait::Serializer::deserializeFrom(records[i], need_data_file_ids ? &data_file_ids : nullptr);
+        return edits;
+    }
+
+    {
+        // Declared after `edits`, so the destructor waits for all tasks even if an exception is thrown
+        ThreadPool decode_pool(std::min(decode_threads, records.size()));
+        for (size_t i = 0; i < records.size(); ++i)
         {
-            auto edit = Trait::Serializer::deserializeFrom(record.value(), &data_file_ids);
-            loadEdit(dir, edit);
+            decode_pool.scheduleOrThrowOnError([&, i]() {
+                // Each task dedups the data file ids on its own, they are merged below
+                DataFileIdSet local_data_file_ids;
+                edits[i] = Trait::Serializer::deserializeFrom(records[i], need_data_file_ids ? &local_data_file_ids : nullptr);
+            });
         }
-        else
+        decode_pool.wait();
+    }
+
+    if constexpr (need_data_file_ids)
+    {
+        // Share the same data file id among all entries to reduce memory usage
+        for (auto & edit : edits)
         {
-            RUNTIME_CHECK(false);
+            for (auto & r : edit.getMutRecords())
+            {
+                auto & data_file_id = r.entry.checkpoint_info.data_location.data_file_id;
+                if (!r.entry.checkpoint_info.has_value() || !data_file_id)
+                    continue;
+                if (auto iter = data_file_ids.find(*data_file_id); iter != data_file_ids.end())
+                    data_file_id = *iter;
+                else
+                    data_file_ids.emplace(data_file_id);
+            }
         }
     }
+    return edits;
 }
 
 template class PageDirectoryFactory<u128::FactoryTrait>;
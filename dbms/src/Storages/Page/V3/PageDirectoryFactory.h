@@ -19,8 +19,12 @@
 #include <Storages/Page/V3/PageDefines.h>
 #include <Storages/Page/V3/PageDirectory.h>
 #include <Storages/Page/V3/PageEntriesEdit.h>
+#include <Storages/Page/V3/WAL/serialize.h>
 #include <Storages/Page/V3/WALStore.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace DB
 {
 class PSDiskDelegator;
@@ -65,8 +69,16 @@ public:
         return *this;
     }
 
+    // The number of threads for decoding the WAL records when restoring. 1 means decoding in the current thread.
+    PageDirectoryFactory<Trait> & setDecodeThreads(size_t threads)
+    {
+        decode_threads = std::max(1UL, threads);
+        return *this;
+    }
+
 private:
     void loadFromDisk(const PageDirectoryPtr & dir, WALStoreReaderPtr && reader);
+    std::vector<PageEntriesEdit> deserializeRecords(const std::vector<String> & records, DataFileIdSet & data_file_ids);
     void loadEdit(const PageDirectoryPtr & dir, const PageEntriesEdit & edit);
     static void applyRecord(
         const PageDirectoryPtr & dir,
@@ -74,6 +86,11 @@ private:
 
     BlobStats * blob_stats = nullptr;
 
+    size_t decode_threads = std::clamp(static_cast<size_t>(std::thread::hardware_concurrency()), 1UL, 8UL);
+    // Bound the memory used by the records that are read but not applied yet
+    static constexpr size_t MAX_DECODE_BATCH_BYTES = 256 * 1024 * 1024;
+    static constexpr size_t MIN_PARALLEL_DECODE_BYTES = 1024 * 1024;
+
     // For debug tool
     friend class PageStorageControlV3;
     bool dump_entries = false;
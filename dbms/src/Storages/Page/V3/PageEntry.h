@@ -68,7 +68,7 @@ public:
                             ErrorCodes::LOGICAL_ERROR);
         else if (index == field_offsets.size() - 1)
         {
-            if (checkpoint_info.has_value() && checkpoint_info.is_local_data_reclaimed)
+            if (checkpoint_info.has_value() && checkpoint_info.is_local_data_reclaimed && !checkpoint_info.data_location.is_compressed)
             {
                 // entry.size is not reliable under this case, use the size_in_file in checkpoint_info instead
                 return checkpoint_info.data_location.size_in_file - field_offsets.back().first;
@@ -91,7 +91,7 @@ public:
                 ErrorCodes::LOGICAL_ERROR);
         else if (index == field_offsets.size() - 1)
         {
-            if (checkpoint_info.has_value() && checkpoint_info.is_local_data_reclaimed)
+            if (checkpoint_info.has_value() && checkpoint_info.is_local_data_reclaimed && !checkpoint_info.data_location.is_compressed)
             {
                 // entry.size is not reliable under this case, use the size_in_file in checkpoint_info instead
                 return {field_offsets.back().first, checkpoint_info.data_location.size_in_file};
@@ -23,6 +23,7 @@ CheckpointLocation CheckpointLocation::copyWithNewDataFileId(std::shared_ptr<con
         .data_file_id = std::move(new_file_id),
         .offset_in_file = this->offset_in_file,
         .size_in_file = this->size_in_file,
+        .is_compressed = this->is_compressed,
     };
 }
 
@@ -32,6 +33,7 @@ CheckpointProto::EntryDataLocation CheckpointLocation::toProto() const
     proto_rec.set_data_file_id(*data_file_id);
     proto_rec.set_offset_in_file(offset_in_file);
     proto_rec.set_size_in_file(size_in_file);
+    proto_rec.set_is_compressed(is_compressed);
     return proto_rec;
 }
 
@@ -56,6 +58,7 @@ CheckpointLocation CheckpointLocation::fromProto(
     val.data_file_id = data_file_id;
     val.offset_in_file = proto_rec.offset_in_file();
     val.size_in_file = proto_rec.size_in_file();
+    val.is_compressed = proto_rec.is_compressed();
     return val;
 }
 
@@ -34,6 +34,8 @@ struct CheckpointLocation
 
     uint64_t offset_in_file = 0;
     uint64_t size_in_file = 0;
+    // The data is stored as a compressed block of `size_in_file` bytes.
+    bool is_compressed = false;
 
     CheckpointLocation copyWithNewDataFileId(std::shared_ptr<const std::string> new_file_id);
 
@@ -49,7 +51,7 @@ struct CheckpointLocation
 
     std::string toDebugString() const
     {
-        return fmt::format("{{data_file_id: {}, offset_in_file: {}, size_in_file: {}}}", *data_file_id, offset_in_file, size_in_file);
+        return fmt::format("{{data_file_id: {}, offset_in_file: {}, size_in_file: {}, is_compressed: {}}}", *data_file_id, offset_in_file, size_in_file, is_compressed);
     }
 };
 
@@ -12,12 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/PODArray.h>
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedStream.h>
+#include <IO/ReadBufferFromMemory.h>
 #include <IO/ReadBufferFromRandomAccessFile.h>
 #include <Storages/Page/V3/Universal/S3PageReader.h>
 #include <Storages/Page/V3/Universal/UniversalPageIdFormatImpl.h>
 #include <Storages/S3/S3Common.h>
 #include <Storages/S3/S3Filename.h>
 #include <Storages/S3/S3RandomAccessFile.h>
+#include <common/unaligned.h>
 
 namespace DB::PS::V3
 {
@@ -48,12 +53,30 @@ Page S3PageReader::read(const UniversalPageIdAndEntry & page_id_and_entry)
     buf.seek(location.offset_in_file, SEEK_SET);
     auto buf_size = location.size_in_file;
     RUNTIME_CHECK(buf_size != 0, page_id_and_entry);
+    PODArray<char> compressed_data;
+    if (location.is_compressed)
+    {
+        // The data is a standalone compressed block, the decompressed size is in the block header.
+        RUNTIME_CHECK(buf_size > COMPRESSED_BLOCK_HEADER_SIZE, page_id_and_entry);
+        compressed_data.resize(buf_size);
+        buf.readStrict(compressed_data.data(), buf_size);
+        buf_size = unalignedLoad<UInt32>(&compressed_data[5]);
+    }
     char * data_buf = static_cast<char *>(alloc(buf_size));
     MemHolder mem_holder = createMemHolder(data_buf, [&, buf_size](char * p) {
         free(p, buf_size);
     });
     // TODO: support checksum verification
-    buf.readStrict(data_buf, buf_size);
+    if (location.is_compressed)
+    {
+        ReadBufferFromMemory compressed_buf(compressed_data.data(), compressed_data.size());
+        CompressedReadBuffer<false> decompressed_buf(compressed_buf);
+        decompressed_buf.readStrict(data_buf, buf_size);
+    }
+    else
+    {
+        buf.readStrict(data_buf, buf_size);
+    }
     Page page{UniversalPageIdFormat::getU64ID(page_id_and_entry.first)};
     page.data = std::string_view(data_buf, buf_size);
     page.mem_holder = mem_holder;
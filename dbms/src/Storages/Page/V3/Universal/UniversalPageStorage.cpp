@@ -458,6 +458,7 @@ PS::V3::CPDataWriteStats UniversalPageStorage::dumpIncrementalCheckpoint(const U
         .manifest_file_id = manifest_file_id,
         .data_source = PS::V3::CPWriteDataSourceBlobStore::create(*blob_store),
         .must_locked_files = options.must_locked_files,
+        .compression_method = options.compression_method,
     });
 
     writer->writePrefix({
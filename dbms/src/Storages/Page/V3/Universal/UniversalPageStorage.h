@@ -16,6 +16,7 @@
 
 #include <Common/Stopwatch.h>
 #include <Encryption/FileProvider_fwd.h>
+#include <IO/CompressedStream.h>
 #include <IO/WriteBufferFromString.h>
 #include <IO/WriteHelpers.h>
 #include <Storages/DeltaMerge/Remote/DataStore/DataStore.h>
@@ -193,6 +194,11 @@ public:
         /**
          */
         const std::function<std::unordered_set<String>()> compact_getter = nullptr;
+
+        /**
+         * The compression method of the page data in the data files.
+         */
+        const CompressionMethod compression_method = CompressionMethod::NONE;
     };
 
     PS::V3::CPDataWriteStats dumpIncrementalCheckpoint(const DumpCheckpointOptions & options);
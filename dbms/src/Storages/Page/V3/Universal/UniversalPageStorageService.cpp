@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/Exception.h>
+#include <Common/TiFlashMetrics.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Poco/File.h>
@@ -235,15 +236,23 @@ bool UniversalPageStorageService::uploadCheckpointImpl(
             .remote_store = remote_store,
             .log = log,
         },
+        .compression_method = settings.remote_checkpoint_compression_method,
     };
     const auto write_stats = uni_page_storage->dumpIncrementalCheckpoint(opts);
 
+    const auto data_bytes = write_stats.incremental_data_bytes + write_stats.rewrite_data_bytes;
+    GET_METRIC(tiflash_storage_checkpoint_data_bytes, type_data).Increment(data_bytes);
+    GET_METRIC(tiflash_storage_checkpoint_data_bytes, type_written).Increment(write_stats.written_data_bytes);
+    GET_METRIC(tiflash_storage_checkpoint_data_bytes, type_deduplicated).Increment(write_stats.deduplicated_data_bytes);
     LOG_INFO(
         log,
-        "Upload checkpoint success, upload_sequence={} incremental_bytes={} rewrite_bytes={}",
+        "Upload checkpoint success, upload_sequence={} incremental_bytes={} rewrite_bytes={} written_bytes={} deduplicated_bytes={} compression_ratio={:.2f}",
         upload_info.upload_sequence,
         write_stats.incremental_data_bytes,
-        write_stats.rewrite_data_bytes);
+        write_stats.rewrite_data_bytes,
+        write_stats.written_data_bytes,
+        write_stats.deduplicated_data_bytes,
+        write_stats.written_data_bytes == 0 ? 1.0 : static_cast<double>(data_bytes - write_stats.deduplicated_data_bytes) / write_stats.written_data_bytes);
 
     // the checkpoint is uploaded to remote data store, remove local temp files
     Poco::File(local_dir).remove(true);
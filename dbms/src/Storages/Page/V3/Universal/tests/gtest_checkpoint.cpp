@@ -221,6 +221,45 @@ try
 }
 CATCH
 
+TEST_F(PSCheckpointTest, DeduplicatedDataValidSize)
+try
+{
+    const String data = "The flower carriage rocked";
+    {
+        UniversalWriteBatch batch;
+        batch.putPage("5", tag, "Said she just dreamed a dream");
+        batch.putPage("6", tag, "Nahida opened her eyes");
+        page_storage->write(std::move(batch));
+    }
+    {
+        UniversalWriteBatch batch;
+        batch.putPage("5", tag, data);
+        batch.putPage("6", tag, data);
+        page_storage->write(std::move(batch));
+    }
+    dumpCheckpoint();
+
+    // Both pages share the same record in the data file.
+    auto snap = page_storage->getSnapshot("");
+    auto entry5 = page_storage->page_directory->getByID("5", snap).second;
+    auto entry6 = page_storage->page_directory->getByID("6", snap).second;
+    ASSERT_TRUE(entry5.checkpoint_info.has_value());
+    ASSERT_TRUE(entry6.checkpoint_info.has_value());
+    const auto & location = entry5.checkpoint_info.data_location;
+    ASSERT_EQ(*location.data_file_id, *entry6.checkpoint_info.data_location.data_file_id);
+    ASSERT_EQ(location.offset_in_file, entry6.checkpoint_info.data_location.offset_in_file);
+    ASSERT_EQ(location.size_in_file, data.size());
+    snap.reset();
+
+    // The shared record is only counted once in the valid size of the data file.
+    page_storage->gc(/* not_skip */ true);
+    auto stats = page_storage->getRemoteDataFilesStatCache();
+    ASSERT_EQ(stats.size(), 1);
+    ASSERT_EQ(stats.begin()->first, *location.data_file_id);
+    ASSERT_EQ(stats.begin()->second.valid_size, data.size());
+}
+CATCH
+
 TEST_F(PSCheckpointTest, ZeroSizedEntry)
 try
 {
@@ -41,7 +41,7 @@ inline void deserializeVersionFrom(ReadBuffer & buf, PageVersion & version)
     readIntBinary(version.epoch, buf);
 }
 
-inline void serializeEntryTo(const PageEntryV3 & entry, WriteBuffer & buf, bool has_checkpoint_info)
+inline void serializeEntryTo(const PageEntryV3 & entry, WriteBuffer & buf, bool has_checkpoint_info, bool with_compressed_location)
 {
     writeIntBinary(entry.file_id, buf);
     writeIntBinary(entry.offset, buf);
@@ -61,10 +61,12 @@ inline void serializeEntryTo(const PageEntryV3 & entry, WriteBuffer & buf, bool
         writeIntBinary(entry.checkpoint_info.data_location.offset_in_file, buf);
         writeIntBinary(entry.checkpoint_info.data_location.size_in_file, buf);
         writeStringBinary(*(entry.checkpoint_info.data_location.data_file_id), buf);
+        if (with_compressed_location)
+            writeBinary(entry.checkpoint_info.data_location.is_compressed, buf);
     }
 }
 
-inline void deserializeEntryFrom(ReadBuffer & buf, PageEntryV3 & entry, bool has_checkpoint_info, DataFileIdSet * data_file_id_set)
+inline void deserializeEntryFrom(ReadBuffer & buf, PageEntryV3 & entry, bool has_checkpoint_info, bool with_compressed_location, DataFileIdSet * data_file_id_set)
 {
     readIntBinary(entry.file_id, buf);
     readIntBinary(entry.offset, buf);
@@ -114,6 +116,8 @@ inline void deserializeEntryFrom(ReadBuffer & buf, PageEntryV3 & entry, bool has
         {
             checkpoint_info.data_location.data_file_id = std::make_shared<String>(data_file_id);
         }
+        if (with_compressed_location)
+            readBinary(checkpoint_info.data_location.is_compressed, buf);
         entry.checkpoint_info = checkpoint_info;
     }
 }
@@ -142,8 +146,19 @@ inline bool isCheckpointInfoExists(UInt32 flags)
     return flags & FLAG_CHECKPOINT_INFO;
 }
 
+template <typename PageEntriesEdit>
+bool hasCompressedLocation(const PageEntriesEdit & edit)
+{
+    for (const auto & record : edit.getRecords())
+    {
+        if (record.entry.checkpoint_info.has_value() && record.entry.checkpoint_info.data_location.is_compressed)
+            return true;
+    }
+    return false;
+}
+
 template <typename EditRecord>
-void serializePutTo(const EditRecord & record, WriteBuffer & buf)
+void serializePutTo(const EditRecord & record, WriteBuffer & buf, bool with_compressed_location)
 {
     assert(record.type == EditRecordType::PUT || record.type == EditRecordType::UPSERT || record.type == EditRecordType::VAR_ENTRY || record.type == EditRecordType::UPDATE_DATA_FROM_REMOTE);
 
@@ -167,11 +182,11 @@ void serializePutTo(const EditRecord & record, WriteBuffer & buf)
     serializeVersionTo(record.version, buf);
     writeIntBinary(record.being_ref_count, buf);
 
-    serializeEntryTo(record.entry, buf, has_checkpoint_info);
+    serializeEntryTo(record.entry, buf, has_checkpoint_info, with_compressed_location);
 }
 
 template <typename EditType>
-void deserializePutFrom([[maybe_unused]] const EditRecordType record_type, ReadBuffer & buf, EditType & edit, DataFileIdSet * data_file_id_set)
+void deserializePutFrom([[maybe_unused]] const EditRecordType record_type, ReadBuffer & buf, EditType & edit, bool with_compressed_location, DataFileIdSet * data_file_id_set)
 {
     assert(record_type == EditRecordType::PUT || record_type == EditRecordType::UPSERT || record_type == EditRecordType::VAR_ENTRY || record_type == EditRecordType::UPDATE_DATA_FROM_REMOTE);
 
@@ -191,7 +206,7 @@ void deserializePutFrom([[maybe_unused]] const EditRecordType record_type, ReadB
     }
     deserializeVersionFrom(buf, rec.version);
     readIntBinary(rec.being_ref_count, buf);
-    deserializeEntryFrom(buf, rec.entry, has_checkpoint_info, data_file_id_set);
+    deserializeEntryFrom(buf, rec.entry, has_checkpoint_info, with_compressed_location, data_file_id_set);
 
     edit.appendRecord(rec);
 }
@@ -239,7 +254,7 @@ void deserializeRefFrom([[maybe_unused]] const EditRecordType record_type, ReadB
 }
 
 template <typename EditRecord>
-void serializePutExternalTo(const EditRecord & record, WriteBuffer & buf)
+void serializePutExternalTo(const EditRecord & record, WriteBuffer & buf, [[maybe_unused]] bool with_compressed_location)
 {
     assert(record.type == EditRecordType::PUT_EXTERNAL || record.type == EditRecordType::VAR_EXTERNAL);
 
@@ -266,6 +281,8 @@ void serializePutExternalTo(const EditRecord & record, WriteBuffer & buf)
             writeIntBinary(record.entry.checkpoint_info.data_location.offset_in_file, buf);
             writeIntBinary(record.entry.checkpoint_info.data_location.size_in_file, buf);
             writeStringBinary(*(record.entry.checkpoint_info.data_location.data_file_id), buf);
+            if (with_compressed_location)
+                writeBinary(record.entry.checkpoint_info.data_location.is_compressed, buf);
         }
         else
         {
@@ -275,7 +292,7 @@ void serializePutExternalTo(const EditRecord & record, WriteBuffer & buf)
 }
 
 template <typename EditType>
-void deserializePutExternalFrom([[maybe_unused]] const EditRecordType record_type, ReadBuffer & buf, EditType & edit)
+void deserializePutExternalFrom([[maybe_unused]] const EditRecordType record_type, ReadBuffer & buf, EditType & edit, [[maybe_unused]] bool with_compressed_location)
 {
     assert(record_type == EditRecordType::PUT_EXTERNAL || record_type == EditRecordType::VAR_EXTERNAL);
 
@@ -306,6 +323,8 @@ void deserializePutExternalFrom([[maybe_unused]] const EditRecordType record_typ
             readStringBinary(data_file_id, buf);
             // TODO: The `data_file_id` of external id is the lock key of DTFile, so it should almost have no duplication.
             checkpoint_info.data_location.data_file_id = std::make_shared<String>(data_file_id);
+            if (with_compressed_location)
+                readBinary(checkpoint_info.data_location.is_compressed, buf);
             rec.entry.checkpoint_info = checkpoint_info;
         }
     }
@@ -350,7 +369,7 @@ void deserializeDelFrom([[maybe_unused]] const EditRecordType record_type, ReadB
 }
 
 template <typename EditType>
-void deserializeFrom(ReadBuffer & buf, EditType & edit, DataFileIdSet * data_file_id_set)
+void deserializeFrom(ReadBuffer & buf, EditType & edit, bool with_compressed_location, DataFileIdSet * data_file_id_set)
 {
     EditRecordType record_type;
     while (!buf.eof())
@@ -363,7 +382,7 @@ void deserializeFrom(ReadBuffer & buf, EditType & edit, DataFileIdSet * data_fil
         case EditRecordType::VAR_ENTRY:
         case EditRecordType::UPDATE_DATA_FROM_REMOTE:
         {
-            deserializePutFrom(record_type, buf, edit, data_file_id_set);
+            deserializePutFrom(record_type, buf, edit, with_compressed_location, data_file_id_set);
             break;
         }
         case EditRecordType::REF:
@@ -381,7 +400,7 @@ void deserializeFrom(ReadBuffer & buf, EditType & edit, DataFileIdSet * data_fil
         case EditRecordType::PUT_EXTERNAL:
         case EditRecordType::VAR_EXTERNAL:
         {
-            deserializePutExternalFrom(record_type, buf, edit);
+            deserializePutExternalFrom(record_type, buf, edit, with_compressed_location);
             break;
         }
         default:
@@ -394,7 +413,8 @@ template <typename PageEntriesEdit>
 String Serializer<PageEntriesEdit>::serializeTo(const PageEntriesEdit & edit)
 {
     WriteBufferFromOwnString buf;
-    UInt32 version = WALSerializeVersion::Plain;
+    const bool with_compressed_location = hasCompressedLocation(edit);
+    UInt32 version = with_compressed_location ? WALSerializeVersion::PlainWithCompressedLocation : WALSerializeVersion::Plain;
     writeIntBinary(version, buf);
     for (const auto & record : edit.getRecords())
     {
@@ -404,7 +424,7 @@ String Serializer<PageEntriesEdit>::serializeTo(const PageEntriesEdit & edit)
         case EditRecordType::UPSERT:
         case EditRecordType::VAR_ENTRY:
         case EditRecordType::UPDATE_DATA_FROM_REMOTE:
-            serializePutTo(record, buf);
+            serializePutTo(record, buf, with_compressed_location);
             break;
         case EditRecordType::REF:
         case EditRecordType::VAR_REF:
@@ -416,7 +436,7 @@ String Serializer<PageEntriesEdit>::serializeTo(const PageEntriesEdit & edit)
             break;
         case EditRecordType::PUT_EXTERNAL:
         case EditRecordType::VAR_EXTERNAL:
-            serializePutExternalTo(record, buf);
+            serializePutExternalTo(record, buf, with_compressed_location);
             break;
         }
     }
@@ -427,7 +447,8 @@ template <typename PageEntriesEdit>
 String Serializer<PageEntriesEdit>::serializeInCompressedFormTo(const PageEntriesEdit & edit)
 {
     WriteBufferFromOwnString buf;
-    UInt32 version = WALSerializeVersion::LZ4;
+    const bool with_compressed_location = hasCompressedLocation(edit);
+    UInt32 version = with_compressed_location ? WALSerializeVersion::LZ4WithCompressedLocation : WALSerializeVersion::LZ4;
     writeIntBinary(version, buf);
     CompressedWriteBuffer compressed_buf(buf);
     for (const auto & record : edit.getRecords())
@@ -438,7 +459,7 @@ String Serializer<PageEntriesEdit>::serializeInCompressedFormTo(const PageEntrie
         case EditRecordType::UPSERT:
         case EditRecordType::VAR_ENTRY:
         case EditRecordType::UPDATE_DATA_FROM_REMOTE:
-            serializePutTo(record, compressed_buf);
+            serializePutTo(record, compressed_buf, with_compressed_location);
             break;
         case EditRecordType::REF:
         case EditRecordType::VAR_REF:
@@ -450,7 +471,7 @@ String Serializer<PageEntriesEdit>::serializeInCompressedFormTo(const PageEntrie
             break;
         case EditRecordType::PUT_EXTERNAL:
         case EditRecordType::VAR_EXTERNAL:
-            serializePutExternalTo(record, compressed_buf);
+            serializePutExternalTo(record, compressed_buf, with_compressed_location);
             break;
         }
     }
@@ -469,12 +490,14 @@ PageEntriesEdit Serializer<PageEntriesEdit>::deserializeFrom(std::string_view re
     switch (version)
     {
     case WALSerializeVersion::Plain:
-        DB::PS::V3::deserializeFrom(buf, edit, data_file_id_set);
+    case WALSerializeVersion::PlainWithCompressedLocation:
+        DB::PS::V3::deserializeFrom(buf, edit, version == WALSerializeVersion::PlainWithCompressedLocation, data_file_id_set);
         break;
     case WALSerializeVersion::LZ4:
+    case WALSerializeVersion::LZ4WithCompressedLocation:
     {
         CompressedReadBuffer compressed_buf(buf);
-        DB::PS::V3::deserializeFrom(compressed_buf, edit, data_file_id_set);
+        DB::PS::V3::deserializeFrom(compressed_buf, edit, version == WALSerializeVersion::LZ4WithCompressedLocation, data_file_id_set);
         break;
     }
     default:
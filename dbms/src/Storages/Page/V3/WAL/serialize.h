@@ -24,6 +24,12 @@ enum WALSerializeVersion : UInt32
 {
     Plain = 1,
     LZ4 = 2,
+    // Same as `Plain` and `LZ4`, but the checkpoint location of each entry carries whether
+    // the data is compressed in the checkpoint data file. Only used when there is any
+    // compressed location in the edit, so that the WAL can still be read after downgrade
+    // if checkpoint compression is not enabled.
+    PlainWithCompressedLocation = 3,
+    LZ4WithCompressedLocation = 4,
 };
 
 struct Comparator
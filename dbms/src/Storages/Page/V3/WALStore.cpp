@@ -209,21 +209,34 @@ bool WALStore::saveSnapshot(
     FilesSnapshot && files_snap,
     String && serialized_snap,
     const WriteLimiterPtr & write_limiter)
+{
+    std::vector<String> serialized_snap_records;
+    serialized_snap_records.emplace_back(std::move(serialized_snap));
+    return saveSnapshot(std::move(files_snap), std::move(serialized_snap_records), write_limiter);
+}
+
+bool WALStore::saveSnapshot(
+    FilesSnapshot && files_snap,
+    std::vector<String> && serialized_snap_records,
+    const WriteLimiterPtr & write_limiter)
 {
     if (files_snap.persisted_log_files.empty())
         return false;
 
-    LOG_INFO(logger, "Saving directory snapshot [num_records={}]", files_snap.num_records);
+    LOG_INFO(logger, "Saving directory snapshot [num_records={}] [num_log_records={}]", files_snap.num_records, serialized_snap_records.size());
 
     // Use {largest_log_num, 1} to save the `edit`
     const auto log_num = files_snap.persisted_log_files.rbegin()->log_num;
     // Create a temporary file for saving directory snapshot
     auto [compact_log, log_filename] = createLogWriter({log_num, 1}, /*manual_flush*/ true);
 
-    // TODO: split the snap into multiple records in LogFile so that the memory
-    //       consumption could be more smooth.
-    ReadBufferFromString payload(serialized_snap);
-    compact_log->addRecord(payload, serialized_snap.size(), write_limiter, /*background*/ true);
+    for (auto & serialized_snap : serialized_snap_records)
+    {
+        ReadBufferFromString payload(serialized_snap);
+        compact_log->addRecord(payload, serialized_snap.size(), write_limiter, /*background*/ true);
+        // Release the memory of the written record as early as possible
+        String().swap(serialized_snap);
+    }
     compact_log->flush(write_limiter, /*background*/ true);
     compact_log.reset(); // close fd explicitly before renaming file.
 
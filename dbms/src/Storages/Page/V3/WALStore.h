@@ -99,6 +99,13 @@ public:
         String && serialized_snap,
         const WriteLimiterPtr & write_limiter = nullptr);
 
+    // Save the snapshot as multiple records in the log file, so that the memory consumption
+    // is smoother and the records can be decoded in parallel when restoring.
+    bool saveSnapshot(
+        FilesSnapshot && files_snap,
+        std::vector<String> && serialized_snap_records,
+        const WriteLimiterPtr & write_limiter = nullptr);
+
     const String & name() { return storage_name; }
 
     friend class tests::WALStoreTest; // for testing
@@ -0,0 +1,78 @@
+// Copyright 2023 PingCAP, Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Encryption/FileProvider.h>
+#include <Poco/File.h>
+#include <Storages/Page/V3/PageDirectory.h>
+#include <Storages/Page/V3/PageDirectoryFactory.h>
+#include <Storages/Page/V3/PageEntriesEdit.h>
+#include <TestUtils/MockDiskDelegator.h>
+#include <TestUtils/TiFlashTestEnv.h>
+#include <benchmark/benchmark.h>
+
+namespace DB::PS::V3::bench
+{
+namespace
+{
+String prepareDirectory(size_t num_pages, bool dump_snapshot)
+{
+    auto path = DB::tests::TiFlashTestEnv::getTemporaryPath(fmt::format("bench_page_directory_restore_{}_{}", num_pages, dump_snapshot));
+    if (Poco::File file(path); file.exists())
+        file.remove(true);
+
+    auto provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    PSDiskDelegatorPtr delegator = std::make_shared<DB::tests::MockDiskDelegatorSingle>(path);
+    auto dir = u128::PageDirectoryFactory{}.setDecodeThreads(1).create("bench", provider, delegator, WALConfig());
+
+    constexpr size_t num_pages_per_edit = 1000;
+    for (size_t page_id = 1; page_id <= num_pages;)
+    {
+        u128::PageEntriesEdit edit;
+        for (size_t i = 0; i < num_pages_per_edit && page_id <= num_pages; ++i, ++page_id)
+        {
+            PageEntryV3 entry{.file_id = 1, .size = 1024, .padded_size = 0, .tag = 0, .offset = page_id * 1024, .checksum = 0x4567};
+            edit.put(buildV3Id(TEST_NAMESPACE_ID, page_id), entry);
+        }
+        dir->apply(std::move(edit));
+    }
+    if (dump_snapshot)
+        dir->tryDumpSnapshot(nullptr, nullptr, /*force*/ true);
+    return path;
+}
+
+// Restore the PageDirectory from the WAL files.
+// Args: number of pages, whether to restore from a dumped snapshot, number of decode threads.
+void restorePageDirectory(benchmark::State & state)
+{
+    const auto num_pages = static_cast<size_t>(state.range(0));
+    const bool dump_snapshot = state.range(1) != 0;
+    const auto decode_threads = static_cast<size_t>(state.range(2));
+    const auto path = prepareDirectory(num_pages, dump_snapshot);
+
+    auto provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    PSDiskDelegatorPtr delegator = std::make_shared<DB::tests::MockDiskDelegatorSingle>(path);
+    for (auto _ : state)
+    {
+        auto dir = u128::PageDirectoryFactory{}.setDecodeThreads(decode_threads).create("bench", provider, delegator, WALConfig());
+        benchmark::DoNotOptimize(dir);
+    }
+    state.SetItemsProcessed(state.iterations() * num_pages);
+}
+} // namespace
+
+BENCHMARK(restorePageDirectory)
+    ->ArgsProduct({{100'000, 1'000'000}, {0, 1}, {1, 4, 8}})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace DB::PS::V3::bench
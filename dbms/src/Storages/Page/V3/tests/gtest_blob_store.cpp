@@ -1127,6 +1127,95 @@ try
 }
 CATCH
 
+TEST_F(BlobStoreTest, ReadWithMergedRanges)
+try
+{
+    const auto file_provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    auto blob_store = BlobStore(getCurrentTestName(), file_provider, delegator, config);
+
+    // Write the pages by one write batch so they are placed adjacently in the same blob file
+    const size_t page_size = 40 * 1024;
+    const size_t num_pages = 64;
+    std::vector<char> data(page_size * num_pages);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<char>(i * 7 + i / page_size);
+
+    WriteBatch wb;
+    for (size_t i = 0; i < num_pages; ++i)
+    {
+        ReadBufferPtr buff = std::make_shared<ReadBufferFromMemory>(data.data() + i * page_size, page_size);
+        PageFieldSizes field_sizes{page_size / 4, page_size / 4, page_size / 2};
+        wb.putPage(i + 1, /* tag */ 0, buff, page_size, field_sizes);
+    }
+    PageEntriesEdit edit = blob_store.write(std::move(wb), nullptr);
+    const auto & records = edit.getRecords();
+    ASSERT_EQ(records.size(), num_pages);
+
+    auto check_page = [&](const Page & page, size_t index) {
+        ASSERT_EQ(page.data.size(), page_size);
+        ASSERT_EQ(0, memcmp(page.data.data(), data.data() + index * page_size, page_size));
+    };
+
+    {
+        // All adjacent pages in shuffled order, plus another page id sharing the same entry
+        BlobStore::PageIdAndEntries entries;
+        for (size_t i = 0; i < num_pages; ++i)
+            entries.emplace_back(records[i].page_id, records[i].entry);
+        entries.emplace_back(buildV3Id(TEST_NAMESPACE_ID, 1000), records[3].entry);
+        std::reverse(entries.begin(), entries.end());
+        auto page_map = blob_store.read(entries);
+        ASSERT_EQ(page_map.size(), num_pages + 1);
+        for (size_t i = 0; i < num_pages; ++i)
+            check_page(page_map.at(i + 1), i);
+        check_page(page_map.at(1000), 3);
+    }
+    {
+        // Every other page, the gaps are too large to be merged and the reads are issued concurrently
+        BlobStore::PageIdAndEntries entries;
+        for (size_t i = 0; i < num_pages; i += 2)
+            entries.emplace_back(records[i].page_id, records[i].entry);
+        auto page_map = blob_store.read(entries);
+        ASSERT_EQ(page_map.size(), num_pages / 2);
+        for (size_t i = 0; i < num_pages; i += 2)
+            check_page(page_map.at(i + 1), i);
+    }
+    {
+        // Read some fields of each page
+        BlobStore::FieldReadInfos read_infos;
+        for (size_t i = 0; i < num_pages; ++i)
+            read_infos.emplace_back(records[i].page_id, records[i].entry, std::vector<size_t>{0, 2});
+        auto page_map = blob_store.read(read_infos);
+        ASSERT_EQ(page_map.size(), num_pages);
+        for (size_t i = 0; i < num_pages; ++i)
+        {
+            const auto & page = page_map.at(i + 1);
+            ASSERT_EQ(page.data.size(), page_size / 4 + page_size / 2);
+            ASSERT_EQ(0, memcmp(page.getFieldData(0).data(), data.data() + i * page_size, page_size / 4));
+            ASSERT_EQ(0, memcmp(page.getFieldData(2).data(), data.data() + i * page_size + page_size / 2, page_size / 2));
+        }
+    }
+
+    // Check how the ranges are merged
+    auto get_range = [&](size_t index, char * buf) {
+        const auto & entry = records[index].entry;
+        return BlobStore::ReadRange{records[index].page_id, entry.file_id, entry.offset, entry.size, buf};
+    };
+    std::vector<char> buf(page_size * 4);
+    {
+        // Adjacent ranges are read by one read
+        BlobStore::ReadRanges ranges{get_range(0, buf.data()), get_range(1, buf.data() + page_size), get_range(2, buf.data() + 2 * page_size)};
+        ASSERT_EQ(blob_store.readRanges(ranges, nullptr), 1);
+        ASSERT_EQ(0, memcmp(buf.data(), data.data(), 3 * page_size));
+    }
+    {
+        // Far away ranges are read separately
+        BlobStore::ReadRanges ranges{get_range(0, buf.data()), get_range(2, buf.data() + page_size), get_range(4, buf.data() + 2 * page_size)};
+        ASSERT_EQ(blob_store.readRanges(ranges, nullptr), 3);
+        ASSERT_EQ(0, memcmp(buf.data() + 2 * page_size, data.data() + 4 * page_size, page_size));
+    }
+}
+CATCH
+
 TEST_F(BlobStoreTest, TestBigBlob)
 try
 {
@@ -1070,6 +1070,54 @@ TEST_F(PageDirectoryGCTest, ManyEditsAndDumpSnapshot)
     }
 }
 
+TEST_F(PageDirectoryGCTest, RestoreWithParallelDecode)
+try
+{
+    // Large edits so that the records are decoded in parallel when restoring
+    constexpr size_t num_edits = 64;
+    constexpr size_t num_pages_per_edit = 2000;
+    for (size_t i = 0; i < num_edits; ++i)
+    {
+        PageEntriesEdit edit;
+        for (size_t j = 0; j < num_pages_per_edit; ++j)
+        {
+            // page id starts from 1, and the size of entry is the same as page id for checking
+            const PageIdU64 page_id = i * num_pages_per_edit + j + 1;
+            PageEntryV3 entry{.file_id = 1, .size = page_id, .padded_size = 0, .tag = 0, .offset = 0x123, .checksum = 0x4567};
+            edit.put(buildV3Id(TEST_NAMESPACE_ID, page_id), entry);
+        }
+        if (i > 0)
+            edit.ref(buildV3Id(TEST_NAMESPACE_ID, num_edits * num_pages_per_edit + i + 1), buildV3Id(TEST_NAMESPACE_ID, (i - 1) * num_pages_per_edit + 1));
+        dir->apply(std::move(edit));
+    }
+    INSERT_DELETE(1);
+
+    auto check_restored = [&](size_t decode_threads) {
+        dir.reset();
+        auto path = getTemporaryPath();
+        auto provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+        PSDiskDelegatorPtr delegator = std::make_shared<DB::tests::MockDiskDelegatorSingle>(path);
+        PageDirectoryFactory<u128::FactoryTrait> factory;
+        dir = factory.setDecodeThreads(decode_threads).create("PageDirectoryTest", provider, delegator, WALConfig());
+
+        auto snap = dir->createSnapshot();
+        EXPECT_ENTRY_NOT_EXIST(dir, 1, snap);
+        for (PageIdU64 page_id = 2; page_id <= num_edits * num_pages_per_edit; ++page_id)
+            ASSERT_EQ(getEntry(dir, page_id, snap).size, page_id);
+        for (size_t i = 1; i < num_edits; ++i)
+            ASSERT_EQ(getNormalPageIdU64(dir, num_edits * num_pages_per_edit + i + 1, snap), (i - 1) * num_pages_per_edit + 1);
+    };
+
+    check_restored(1);
+    check_restored(4);
+
+    // The snapshot is dumped into multiple records
+    EXPECT_TRUE(dir->tryDumpSnapshot(nullptr, nullptr, /*force*/ true));
+    check_restored(1);
+    check_restored(4);
+}
+CATCH
+
 TEST_F(PageDirectoryGCTest, GCPushForward)
 try
 {
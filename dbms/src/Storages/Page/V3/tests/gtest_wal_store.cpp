@@ -29,6 +29,7 @@
 #include <TestUtils/MockDiskDelegator.h>
 #include <TestUtils/TiFlashStorageTestBasic.h>
 #include <TestUtils/TiFlashTestEnv.h>
+#include <common/unaligned.h>
 
 #include <future>
 #include <mutex>
@@ -741,6 +742,103 @@ try
 }
 CATCH
 
+TEST_P(WALStoreTest, CompressedCheckpointLocation)
+try
+{
+    auto provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    auto path = getTemporaryPath();
+
+    auto [wal, reader] = WALStore::create(getCurrentTestName(), provider, delegator, config);
+    ASSERT_NE(wal, nullptr);
+
+    CheckpointLocation location1{
+        .data_file_id = std::make_shared<String>("hhhhh"),
+        .offset_in_file = 100,
+        .size_in_file = 2000,
+        .is_compressed = true,
+    };
+    PageEntryV3 entry_p1{.file_id = 1, .size = 1, .padded_size = 0, .tag = 0, .offset = 0x123, .checksum = 0x4567, .checkpoint_info = {.data_location = location1, .is_valid = true}};
+    CheckpointLocation location2{
+        .data_file_id = std::make_shared<String>("hhhhh"),
+        .offset_in_file = 5000,
+        .size_in_file = 2000,
+    };
+    PageEntryV3 entry_p2{.file_id = 1, .size = 2, .padded_size = 0, .tag = 0, .offset = 0x123, .checksum = 0x4567, .checkpoint_info = {.data_location = location2, .is_valid = true}};
+    CheckpointLocation location3{
+        .data_file_id = std::make_shared<String>("lock_key"),
+        .offset_in_file = 0,
+        .size_in_file = 0,
+        .is_compressed = true,
+    };
+    PageEntryV3 entry_p3{.checkpoint_info = {.data_location = location3, .is_valid = true}};
+
+    // The edit with compressed locations is written in the new format, and the others are
+    // kept in the old format.
+    {
+        universal::PageEntriesEdit edit;
+        edit.put(UniversalPageId{"1"}, entry_p1);
+        edit.put(UniversalPageId{"2"}, entry_p2);
+        edit.varExternal(UniversalPageId{"3"}, PageVersion(20), entry_p3, 1);
+        const auto plain = universal::Serializer::serializeTo(edit);
+        ASSERT_EQ(unalignedLoad<UInt32>(plain.data()), WALSerializeVersion::PlainWithCompressedLocation);
+        wal->apply(plain);
+        const auto compressed = universal::Serializer::serializeInCompressedFormTo(edit);
+        ASSERT_EQ(unalignedLoad<UInt32>(compressed.data()), WALSerializeVersion::LZ4WithCompressedLocation);
+        wal->apply(compressed);
+    }
+    {
+        universal::PageEntriesEdit edit;
+        edit.put(UniversalPageId{"2"}, entry_p2);
+        const auto plain = universal::Serializer::serializeTo(edit);
+        ASSERT_EQ(unalignedLoad<UInt32>(plain.data()), WALSerializeVersion::Plain);
+        wal->apply(plain);
+    }
+
+    wal.reset();
+
+    // Restore from the WAL files, the locations are restored as they are written.
+    {
+        size_t num_applied_edit = 0;
+        size_t num_compressed = 0;
+        auto reader = WALStoreReader::create(getCurrentTestName(), provider, delegator);
+        while (reader->remained())
+        {
+            const auto record = reader->next();
+            if (!record)
+                break;
+            auto edit = universal::Serializer::deserializeFrom(record.value(), nullptr);
+            for (const auto & r : edit.getRecords())
+            {
+                ASSERT_TRUE(r.entry.checkpoint_info.has_value());
+                const auto & location = r.entry.checkpoint_info.data_location;
+                if (r.page_id == UniversalPageId{"1"})
+                {
+                    ASSERT_TRUE(location.is_compressed);
+                    ASSERT_EQ(location.offset_in_file, 100);
+                    ASSERT_EQ(location.size_in_file, 2000);
+                    ++num_compressed;
+                }
+                else if (r.page_id == UniversalPageId{"3"})
+                {
+                    ASSERT_EQ(r.type, EditRecordType::VAR_EXTERNAL);
+                    ASSERT_TRUE(location.is_compressed);
+                    ASSERT_EQ(*location.data_file_id, "lock_key");
+                    ++num_compressed;
+                }
+                else
+                {
+                    ASSERT_FALSE(location.is_compressed);
+                    ASSERT_EQ(location.offset_in_file, 5000);
+                }
+            }
+            num_applied_edit += 1;
+        }
+        EXPECT_EQ(num_applied_edit, 3);
+        EXPECT_EQ(num_compressed, 4);
+    }
+}
+CATCH
+
 TEST_P(WALStoreTest, ManyEdits)
 try
 {
@@ -31,6 +31,11 @@ SelectQueryInfo::SelectQueryInfo(const SelectQueryInfo & rhs)
     , req_id(rhs.req_id)
     , keep_order(rhs.keep_order)
     , is_fast_scan(rhs.is_fast_scan)
+    , read_limit(rhs.read_limit)
+    , read_in_handle_order(rhs.read_in_handle_order)
+    , read_desc(rhs.read_desc)
+    , topn_threshold(rhs.topn_threshold)
+    , topn_column_id(rhs.topn_column_id)
 {}
 
 SelectQueryInfo::SelectQueryInfo(SelectQueryInfo && rhs) noexcept
@@ -41,6 +46,11 @@ SelectQueryInfo::SelectQueryInfo(SelectQueryInfo && rhs) noexcept
     , req_id(std::move(rhs.req_id))
     , keep_order(rhs.keep_order)
     , is_fast_scan(rhs.is_fast_scan)
+    , read_limit(rhs.read_limit)
+    , read_in_handle_order(rhs.read_in_handle_order)
+    , read_desc(rhs.read_desc)
+    , topn_threshold(std::move(rhs.topn_threshold))
+    , topn_column_id(rhs.topn_column_id)
 {}
 
 } // namespace DB
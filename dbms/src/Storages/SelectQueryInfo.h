@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <common/types.h>
+
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -33,6 +35,9 @@ using PreparedSets = std::unordered_map<IAST *, SetPtr>;
 struct MvccQueryInfo;
 struct DAGQueryInfo;
 
+class TopNThreshold;
+using TopNThresholdPtr = std::shared_ptr<TopNThreshold>;
+
 
 /** Query along with some additional data,
   *  that can be used during query processing
@@ -54,6 +59,17 @@ struct SelectQueryInfo
     bool keep_order = true;
     bool is_fast_scan = false;
 
+    /// The limit of LIMIT/TopN directly above the table scan without any filter, 0 means no limit.
+    /// The storage can stop reading once enough rows are read.
+    size_t read_limit = 0;
+    /// The TopN is ordered by the int handle, so the rows should be read in the order of handle.
+    bool read_in_handle_order = false;
+    bool read_desc = false;
+    /// The threshold of the TopN directly above the table scan ordered by the column `topn_column_id`.
+    /// The packs that all rows are after the threshold can be skipped.
+    TopNThresholdPtr topn_threshold;
+    Int64 topn_column_id = 0;
+
     SelectQueryInfo();
     ~SelectQueryInfo();
 
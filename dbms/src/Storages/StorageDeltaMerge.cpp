@@ -87,6 +87,7 @@ StorageDeltaMerge::StorageDeltaMerge(
     : IManageableStorage{columns_, tombstone}
     , data_path_contains_database_name(db_engine != "TiFlash")
     , store_inited(false)
+    , write_combiner([this](Block & block, const Settings & settings) { write(block, settings); })
     , max_column_id_used(0)
     , global_context(global_context_.getGlobalContext())
     , log(Logger::get(fmt::format("{}.{}", db_name_, table_name_)))
@@ -533,6 +534,11 @@ void StorageDeltaMerge::write(Block & block, const Settings & settings)
     store->write(global_context, settings, block);
 }
 
+void StorageDeltaMerge::writeCombined(Block & block, const Settings & settings)
+{
+    write_combiner.write(block, settings);
+}
+
 std::unordered_set<UInt64> parseSegmentSet(const ASTPtr & ast)
 {
     if (!ast)
@@ -641,6 +647,29 @@ void checkReadTso(UInt64 read_tso, const Context & context, const String & req_i
     }
 }
 
+DM::ReadLimitHint parseReadLimitHint(const SelectQueryInfo & query_info, const ColumnDefines & columns_to_read, bool support_in_handle_order)
+{
+    DM::ReadLimitHint limit_hint;
+    if (!query_info.read_in_handle_order || support_in_handle_order)
+    {
+        limit_hint.rows = query_info.read_limit;
+        limit_hint.in_handle_order = query_info.read_in_handle_order;
+        limit_hint.desc = query_info.read_desc;
+    }
+    if (query_info.topn_threshold)
+    {
+        auto iter = std::find_if(columns_to_read.begin(), columns_to_read.end(), [&](const ColumnDefine & cd) {
+            return cd.id == query_info.topn_column_id;
+        });
+        if (iter != columns_to_read.end())
+        {
+            limit_hint.topn_threshold = query_info.topn_threshold;
+            limit_hint.topn_attr = DM::Attr{.col_name = iter->name, .col_id = iter->id, .type = iter->type};
+        }
+    }
+    return limit_hint;
+}
+
 DM::RowKeyRanges StorageDeltaMerge::parseMvccQueryInfo(
     const DB::MvccQueryInfo & mvcc_query_info,
     unsigned num_streams,
@@ -886,7 +915,8 @@ BlockInputStreams StorageDeltaMerge::read(
         max_block_size,
         parseSegmentSet(select_query.segment_expression_list),
         extra_table_id_index,
-        scan_context);
+        scan_context,
+        parseReadLimitHint(query_info, columns_to_read, /*support_in_handle_order*/ true));
 
     /// Ensure read_tso info after read.
     checkReadTso(mvcc_query_info.read_tso, context, query_info.req_id);
@@ -943,7 +973,9 @@ SourceOps StorageDeltaMerge::readSourceOps(
         max_block_size,
         parseSegmentSet(select_query.segment_expression_list),
         extra_table_id_index,
-        scan_context);
+        scan_context,
+        // Reading in the order of handle is not supported by pipeline yet.
+        parseReadLimitHint(query_info, columns_to_read, /*support_in_handle_order*/ false));
 
     /// Ensure read_tso info after read.
     checkReadTso(mvcc_query_info.read_tso, context, query_info.req_id);
@@ -22,6 +22,7 @@
 #include <Storages/DeltaMerge/Filter/PushDownFilter.h>
 #include <Storages/DeltaMerge/Remote/DisaggSnapshot_fwd.h>
 #include <Storages/DeltaMerge/ScanContext.h>
+#include <Storages/DeltaMerge/WriteCombiner.h>
 #include <Storages/IManageableStorage.h>
 #include <Storages/IStorage.h>
 #include <Storages/Transaction/DecodingStorageSchemaSnapshot.h>
@@ -90,6 +91,10 @@ public:
     /// Write from raft layer.
     void write(Block & block, const Settings & settings);
 
+    /// Write from raft layer, combined with the blocks written by other regions at the same time.
+    /// Return after `block` is written.
+    void writeCombined(Block & block, const Settings & settings);
+
     void flushCache(const Context & context) override;
 
     bool flushCache(const Context & context, const DM::RowKeyRange & range_to_flush, bool try_until_succeed) override;
@@ -285,6 +290,9 @@ private:
     // avoid creating too many cached blocks(the typical num should be less and equal than raft apply thread)
     static constexpr size_t max_cached_blocks_num = 16;
 
+    // Combine the concurrent writes from raft layer
+    DM::WriteCombiner write_combiner;
+
     // Used to allocate new column-id when this table is NOT synced from TiDB
     ColumnID max_column_id_used;
 
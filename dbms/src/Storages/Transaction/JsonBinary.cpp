@@ -95,6 +95,14 @@ String JsonBinary::getObjectKey(size_t index) const
     return String(data.data + key_offset, key_length);
 }
 
+StringRef JsonBinary::getObjectKeyRef(size_t index) const
+{
+    size_t cursor = HEADER_SIZE + index * KEY_ENTRY_SIZE;
+    auto key_offset = decodeNumeric<UInt32>(cursor, data);
+    auto key_length = decodeNumeric<UInt16>(cursor, data);
+    return getSubRef(key_offset, key_length);
+}
+
 JsonBinary JsonBinary::getObjectValue(size_t index) const
 {
     auto element_count = getElementCount();
@@ -558,8 +566,12 @@ bool JsonBinary::extract(std::vector<JsonPathExprRefContainerPtr> & path_expr_co
     std::vector<JsonBinary> extracted_json_binary_vec;
     for (auto & path_expr_container : path_expr_container_vec)
     {
-        DupCheckSet dup_check_set = std::make_unique<std::unordered_set<const char *>>();
         const auto * first_path_ref = path_expr_container->firstRef();
+        // A path without asterisk or range selects at most one value, so there is no need to check duplication
+        // and allocate the set for every row.
+        DupCheckSet dup_check_set = (first_path_ref && first_path_ref->couldMatchMultipleValues())
+            ? std::make_unique<std::unordered_set<const char *>>()
+            : nullptr;
         extractTo(extracted_json_binary_vec, first_path_ref, dup_check_set, false);
     }
 
@@ -606,7 +618,7 @@ std::optional<JsonBinary> JsonBinary::searchObjectKey(JsonPathObjectKey & key) c
     {
     case JsonPathObjectKeyCached:
         found_index = key.cached_index;
-        if (found_index < element_count && getObjectKey(found_index) == key.key)
+        if (found_index < element_count && getObjectKeyRef(found_index) == StringRef(key.key))
             return {getObjectValue(found_index)};
         else
             found_index = binarySearchKey(key, element_count);
@@ -618,7 +630,7 @@ std::optional<JsonBinary> JsonBinary::searchObjectKey(JsonPathObjectKey & key) c
         break;
     }
 
-    if (found_index < element_count && getObjectKey(found_index) == key.key)
+    if (found_index < element_count && getObjectKeyRef(found_index) == StringRef(key.key))
     {
         if (key.status == JsonPathObjectKeyUncached)
         {
@@ -636,11 +648,11 @@ UInt32 JsonBinary::binarySearchKey(const JsonPathObjectKey & key, UInt32 element
     RUNTIME_CHECK(element_count > 0);
     Int32 first = 0;
     Int32 distance = element_count - 1;
+    const StringRef target_key(key.key);
     while (distance > 0)
     {
-        Int32 step = distance >> 2;
-        const String & current_key = getObjectKey(first + step);
-        if (current_key < key.key)
+        Int32 step = distance >> 1;
+        if (getObjectKeyRef(first + step) < target_key)
         {
             first += step;
             ++first;
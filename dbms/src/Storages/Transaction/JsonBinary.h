@@ -161,6 +161,7 @@ private:
 
     JsonBinary getArrayElement(size_t index) const;
     String getObjectKey(size_t index) const; /// Expect object key not be too long, use String instead of StringRef as return type
+    StringRef getObjectKeyRef(size_t index) const; /// Used for searching keys, avoid allocation for each comparison
     JsonBinary getObjectValue(size_t index) const;
     JsonBinary getValueEntry(size_t value_entry_offset) const;
 
@@ -69,6 +69,8 @@ struct RegionPreDecodeBlockData;
 using RegionPreDecodeBlockDataPtr = std::unique_ptr<RegionPreDecodeBlockData>;
 class ReadIndexWorkerManager;
 using BatchReadIndexRes = std::vector<std::pair<kvrpcpb::ReadIndexResponse, uint64_t>>;
+struct ReadIndexFuture;
+using ReadIndexFuturePtr = std::shared_ptr<ReadIndexFuture>;
 class ReadIndexStressTest;
 struct FileUsageStatistics;
 class PathPool;
@@ -152,6 +154,10 @@ public:
 
     BatchReadIndexRes batchReadIndex(const std::vector<kvrpcpb::ReadIndexRequest> & req, uint64_t timeout_ms) const;
 
+    /// Send read-index requests without blocking, the futures are in the same order as `req`.
+    /// Return `std::nullopt` if read-index workers are not initialized, the caller should fallback to `batchReadIndex`.
+    std::optional<std::vector<ReadIndexFuturePtr>> genReadIndexFutures(const std::vector<kvrpcpb::ReadIndexRequest> & req) const;
+
     /// Initialize read-index worker context. It only can be invoked once.
     /// `worker_coefficient` means `worker_coefficient * runner_cnt` workers will be created.
     /// `runner_cnt` means number of runner which controls behavior of worker.
@@ -25,6 +25,7 @@
 #include <Storages/Transaction/LearnerRead.h>
 #include <Storages/Transaction/LockException.h>
 #include <Storages/Transaction/ProxyFFI.h>
+#include <Storages/Transaction/ReadIndexWorker.h>
 #include <Storages/Transaction/RegionException.h>
 #include <Storages/Transaction/RegionExecutionResult.h>
 #include <Storages/Transaction/TMTContext.h>
@@ -141,111 +142,61 @@ struct LearnerReadStatistics
     UInt64 num_stale_read = 0;
 };
 
-LearnerReadSnapshot doLearnerRead(
-    const TiDB::TableID logical_table_id,
-    MvccQueryInfo & mvcc_query_info_,
-    bool for_batch_cop,
-    Context & context,
-    const LoggerPtr & log)
+class LearnerReadWorker : boost::noncopyable
 {
-    assert(log != nullptr);
-    RUNTIME_ASSERT(!(context.getSharedContextDisagg()->isDisaggregatedComputeMode() && context.getSharedContextDisagg()->use_autoscaler));
-
-    auto & tmt = context.getTMTContext();
-
-    MvccQueryInfoWrap mvcc_query_info(mvcc_query_info_, tmt, logical_table_id);
-    const auto & regions_info = mvcc_query_info.getRegionsInfo();
+public:
+    LearnerReadWorker(
+        const TiDB::TableID logical_table_id,
+        MvccQueryInfo & mvcc_query_info_,
+        TMTContext & tmt_,
+        bool for_batch_cop_,
+        const LoggerPtr & log_)
+        : mvcc_query_info(mvcc_query_info_, tmt_, logical_table_id)
+        , tmt(tmt_)
+        , kvstore(tmt_.getKVStore())
+        , for_batch_cop(for_batch_cop_)
+        , log(log_)
+    {}
 
-    KVStorePtr & kvstore = tmt.getKVStore();
-    LearnerReadSnapshot regions_snapshot;
     // check region is not null and store region map.
-    for (const auto & info : regions_info)
+    void buildRegionsSnapshot()
     {
-        auto region = kvstore->getRegion(info.region_id);
-        if (region == nullptr)
-        {
-            LOG_WARNING(log, "[region {}] is not found in KVStore, try again", info.region_id);
-            throw RegionException({info.region_id}, RegionException::RegionReadStatus::NOT_FOUND);
-        }
-        regions_snapshot.emplace(info.region_id, std::move(region));
-    }
-    // make sure regions are not duplicated.
-    if (unlikely(regions_snapshot.size() != regions_info.size()))
-        throw TiFlashException(
-            Errors::Coprocessor::BadRequest,
-            "Duplicate region id, n_request={} n_actual={}",
-            regions_info.size(),
-            regions_snapshot.size());
-
-    const size_t num_regions = regions_info.size();
-
-    // TODO: refactor this enormous lambda into smaller parts
-    UnavailableRegions unavailable_regions;
-    LearnerReadStatistics stats;
-    const auto batch_wait_index = [&](const size_t region_begin_idx) -> void {
-        Stopwatch batch_wait_data_watch;
-        Stopwatch watch;
-
-        const size_t ori_batch_region_size = num_regions - region_begin_idx;
-        std::unordered_map<RegionID, kvrpcpb::ReadIndexResponse> batch_read_index_result;
-
-        std::vector<kvrpcpb::ReadIndexRequest> batch_read_index_req;
-        batch_read_index_req.reserve(ori_batch_region_size);
-
+        const auto & regions_info = mvcc_query_info.getRegionsInfo();
+        for (const auto & info : regions_info)
         {
-            // If using `std::numeric_limits<uint64_t>::max()`, set `start-ts` 0 to get the latest index but let read-index-worker do not record as history.
-            auto read_index_tso = mvcc_query_info->read_tso == std::numeric_limits<uint64_t>::max() ? 0 : mvcc_query_info->read_tso;
-            RegionTable & region_table = tmt.getRegionTable();
-            for (size_t region_idx = region_begin_idx; region_idx < num_regions; ++region_idx)
+            auto region = kvstore->getRegion(info.region_id);
+            if (region == nullptr)
             {
-                const auto & region_to_query = regions_info[region_idx];
-                const RegionID region_id = region_to_query.region_id;
-                // don't stale read in test scenarios.
-                bool can_stale_read = mvcc_query_info->read_tso != std::numeric_limits<uint64_t>::max() && read_index_tso <= region_table.getSelfSafeTS(region_id);
-                if (!can_stale_read)
-                {
-                    if (auto ori_read_index = mvcc_query_info.getReadIndexRes(region_id); ori_read_index)
-                    {
-                        auto resp = kvrpcpb::ReadIndexResponse();
-                        resp.set_read_index(ori_read_index);
-                        batch_read_index_result.emplace(region_id, std::move(resp));
-                    }
-                    else
-                    {
-                        auto & region = regions_snapshot.find(region_id)->second;
-                        batch_read_index_req.emplace_back(GenRegionReadIndexReq(*region, read_index_tso));
-                    }
-                }
-                else
-                {
-                    batch_read_index_result.emplace(region_id, kvrpcpb::ReadIndexResponse());
-                    ++stats.num_stale_read;
-                }
+                LOG_WARNING(log, "[region {}] is not found in KVStore, try again", info.region_id);
+                throw RegionException({info.region_id}, RegionException::RegionReadStatus::NOT_FOUND);
             }
+            regions_snapshot.emplace(info.region_id, std::move(region));
         }
-        GET_METRIC(tiflash_stale_read_count).Increment(stats.num_stale_read);
-        GET_METRIC(tiflash_raft_read_index_count).Increment(batch_read_index_req.size());
+        // make sure regions are not duplicated.
+        if (unlikely(regions_snapshot.size() != regions_info.size()))
+            throw TiFlashException(
+                Errors::Coprocessor::BadRequest,
+                "Duplicate region id, n_request={} n_actual={}",
+                regions_info.size(),
+                regions_snapshot.size());
+    }
 
-        const auto & make_default_batch_read_index_result = [&](bool with_region_error) {
-            for (const auto & req : batch_read_index_req)
-            {
-                auto resp = kvrpcpb::ReadIndexResponse();
-                if (with_region_error)
-                    resp.mutable_region_error()->mutable_region_not_found();
-                batch_read_index_result.emplace(req.context().region_id(), std::move(resp));
-            }
-        };
+    /// Blocking read index.
+    void readIndex()
+    {
+        watch.restart();
+        buildReadIndexRequests();
         [&]() {
             if (!tmt.checkRunning(std::memory_order_relaxed))
             {
-                make_default_batch_read_index_result(true);
+                makeDefaultReadIndexResult(true);
                 return;
             }
             kvstore->addReadIndexEvent(1);
             SCOPE_EXIT({ kvstore->addReadIndexEvent(-1); });
             if (!tmt.checkRunning())
             {
-                make_default_batch_read_index_result(true);
+                makeDefaultReadIndexResult(true);
                 return;
             }
 
@@ -262,64 +213,112 @@ LearnerReadSnapshot doLearnerRead(
             else
             {
                 // Only in mock test, `proxy_helper` will be `nullptr`. Set `read_index` to 0 and skip waiting.
-                make_default_batch_read_index_result(false);
+                makeDefaultReadIndexResult(false);
             }
         }();
+        onReadIndexFinished();
+    }
 
+    /// Send read index requests without blocking. If read-index workers are not enabled, fallback to blocking read index.
+    void submitReadIndex()
+    {
+        watch.restart();
+        buildReadIndexRequests();
+        if (!tmt.checkRunning(std::memory_order_relaxed))
         {
-            stats.read_index_elapsed_ms = watch.elapsedMilliseconds();
-            GET_METRIC(tiflash_raft_read_index_duration_seconds).Observe(stats.read_index_elapsed_ms / 1000.0);
-            const size_t cached_size = ori_batch_region_size - batch_read_index_req.size();
+            makeDefaultReadIndexResult(true);
+            onReadIndexFinished();
+            return;
+        }
+        // Like `readIndex`, the read index event is held until the read index is done, so that the
+        // store is not terminated while the requests are pending.
+        kvstore->addReadIndexEvent(1);
+        holding_read_index_event = true;
+        if (!tmt.checkRunning())
+        {
+            makeDefaultReadIndexResult(true);
+            releaseReadIndexEvent();
+            onReadIndexFinished();
+            return;
+        }
+        if (kvstore->getProxyHelper())
+        {
+            if (auto futures = kvstore->genReadIndexFutures(batch_read_index_req); futures)
+            {
+                read_index_futures = std::move(*futures);
+                // The event is released and `onReadIndexFinished` is called in `pollReadIndex`.
+                if (!read_index_futures.empty())
+                    return;
+            }
+            else
+            {
+                // read-index workers are not enabled, there is no way to read index asynchronously.
+                auto res = kvstore->batchReadIndex(batch_read_index_req, tmt.batchReadIndexTimeout());
+                for (auto && [resp, region_id] : res)
+                    batch_read_index_result.emplace(region_id, std::move(resp));
+            }
+        }
+        else
+        {
+            makeDefaultReadIndexResult(false);
+        }
+        releaseReadIndexEvent();
+        onReadIndexFinished();
+    }
 
-            LOG_DEBUG(
-                log,
-                "Batch read index, original size {}, send & get {} message, cost {}ms{}",
-                ori_batch_region_size,
-                batch_read_index_req.size(),
-                stats.read_index_elapsed_ms,
-                (cached_size != 0) ? (fmt::format(", {} in cache", cached_size)) : "");
+    ~LearnerReadWorker() { releaseReadIndexEvent(); }
 
-            watch.restart(); // restart to count the elapsed of wait index
-        }
+    /// Return true if all the read index requests sent by `submitReadIndex` are finished or timeout.
+    bool pollReadIndex()
+    {
+        // All the read index requests are finished in `submitReadIndex`.
+        if (read_index_futures.empty())
+            return true;
 
-        // if size of batch_read_index_result is not equal with batch_read_index_req, there must be region_error/lock, find and return directly.
-        for (auto & [region_id, resp] : batch_read_index_result)
+        const bool is_timeout = watch.elapsedMilliseconds() > tmt.batchReadIndexTimeout() || !tmt.checkRunning(std::memory_order_relaxed);
+        size_t num_finished = 0;
+        for (size_t i = 0; i < read_index_futures.size(); ++i)
         {
-            if (resp.has_region_error())
+            auto & future = read_index_futures[i];
+            if (future == nullptr)
             {
-                const auto & region_error = resp.region_error();
-                auto region_status = RegionException::RegionReadStatus::NOT_FOUND;
-                if (region_error.has_epoch_not_match())
-                    region_status = RegionException::RegionReadStatus::EPOCH_NOT_MATCH;
-                unavailable_regions.add(region_id, region_status);
+                ++num_finished;
+                continue;
             }
-            else if (resp.has_locked())
+            const RegionID region_id = batch_read_index_req[i].context().region_id();
+            if (auto res = future->poll(); res)
             {
-                unavailable_regions.setRegionLock(region_id, LockInfoPtr(resp.release_locked()));
+                batch_read_index_result.emplace(region_id, std::move(*res));
+            }
+            else if (is_timeout)
+            {
+                // means that the region can not get response from leader in time, same as `batchReadIndex`.
+                kvrpcpb::ReadIndexResponse resp;
+                resp.mutable_region_error()->mutable_region_not_found();
+                batch_read_index_result.emplace(region_id, std::move(resp));
             }
             else
             {
-                // cache read-index to avoid useless overhead about retry.
-                // resp.read_index() is 0 when stale read, skip it to avoid overwriting read_index res in last retry.
-                if (resp.read_index() != 0)
-                {
-                    mvcc_query_info.addReadIndexRes(region_id, resp.read_index());
-                }
+                continue;
             }
+            future.reset();
+            ++num_finished;
         }
+        if (num_finished != read_index_futures.size())
+            return false;
 
-        auto handle_wait_timeout_region = [&unavailable_regions, for_batch_cop](const DB::RegionID region_id, UInt64 index) {
-            if (!for_batch_cop)
-            {
-                // If server is being terminated / time-out, add the region_id into `unavailable_regions` to other store.
-                unavailable_regions.add(region_id, RegionException::RegionReadStatus::NOT_FOUND);
-                return;
-            }
-            // TODO: Maybe collect all the Regions that happen wait index timeout instead of just throwing one Region id
-            throw TiFlashException(Errors::Coprocessor::RegionError, "Region {} is unavailable at {}", region_id, index);
-        };
+        read_index_futures.clear();
+        releaseReadIndexEvent();
+        onReadIndexFinished();
+        return true;
+    }
+
+    /// Blocking wait index | resolve locks | check memory cache.
+    void waitIndex()
+    {
+        const auto & regions_info = mvcc_query_info.getRegionsInfo();
         const auto wait_index_timeout_ms = tmt.waitIndexTimeout();
-        for (size_t region_idx = region_begin_idx, read_index_res_idx = 0; region_idx < num_regions; ++region_idx, ++read_index_res_idx)
+        for (size_t region_idx = 0; region_idx < regions_info.size(); ++region_idx)
         {
             const auto & region_to_query = regions_info[region_idx];
 
@@ -335,10 +334,10 @@ LearnerReadSnapshot doLearnerRead(
             {
                 // Wait index timeout is disabled; or timeout is enabled but not happen yet, wait index for
                 // a specify Region.
-                auto [wait_res, time_cost] = region->waitIndex(index_to_wait, tmt.waitIndexTimeout(), [&tmt]() { return tmt.checkRunning(); });
+                auto [wait_res, time_cost] = region->waitIndex(index_to_wait, tmt.waitIndexTimeout(), [this]() { return tmt.checkRunning(); });
                 if (wait_res != WaitIndexResult::Finished)
                 {
-                    handle_wait_timeout_region(region_to_query.region_id, index_to_wait);
+                    handleWaitIndexTimeout(region_to_query.region_id, index_to_wait);
                     continue;
                 }
                 if (time_cost > 0)
@@ -353,45 +352,263 @@ LearnerReadSnapshot doLearnerRead(
                 // for Regions one by one.
                 if (!region->checkIndex(index_to_wait))
                 {
-                    handle_wait_timeout_region(region_to_query.region_id, index_to_wait);
+                    handleWaitIndexTimeout(region_to_query.region_id, index_to_wait);
                     continue;
                 }
             }
 
-            // Try to resolve locks and flush data into storage layer
-            if (mvcc_query_info->resolve_locks)
+            resolveLocks(region_to_query, region);
+        }
+        onWaitIndexFinished();
+    }
+
+    /// Non-blocking version of `waitIndex`. Return true if all regions have caught up the read index or timeout.
+    /// The locks of the regions are not resolved here, call `finishWaitIndex` after it returns true.
+    bool pollWaitIndex()
+    {
+        const auto & regions_info = mvcc_query_info.getRegionsInfo();
+        if (!wait_index_started)
+        {
+            wait_index_started = true;
+            pending_regions.reserve(regions_info.size());
+            for (size_t region_idx = 0; region_idx < regions_info.size(); ++region_idx)
+            {
+                if (!unavailable_regions.contains(regions_info[region_idx].region_id))
+                    pending_regions.push_back(region_idx);
+            }
+        }
+
+        const auto wait_index_timeout_ms = tmt.waitIndexTimeout();
+        const auto total_wait_index_elapsed_ms = watch.elapsedMilliseconds();
+        const bool is_timeout = (wait_index_timeout_ms != 0 && total_wait_index_elapsed_ms > wait_index_timeout_ms) || !tmt.checkRunning();
+        auto iter = pending_regions.begin();
+        while (iter != pending_regions.end())
+        {
+            const auto & region_to_query = regions_info[*iter];
+            auto & region = regions_snapshot.find(region_to_query.region_id)->second;
+            auto index_to_wait = batch_read_index_result.find(region_to_query.region_id)->second.read_index();
+            if (region->checkIndex(index_to_wait))
+            {
+                if (total_wait_index_elapsed_ms > 0)
+                {
+                    // Only record information if wait-index does happen
+                    GET_METRIC(tiflash_raft_wait_index_duration_seconds).Observe(total_wait_index_elapsed_ms / 1000.0);
+                }
+                caught_up_regions.push_back(*iter);
+            }
+            else if (is_timeout)
+            {
+                handleWaitIndexTimeout(region_to_query.region_id, index_to_wait);
+            }
+            else
+            {
+                ++iter;
+                continue;
+            }
+            iter = pending_regions.erase(iter);
+        }
+        return pending_regions.empty();
+    }
+
+    /// Resolve locks and check memory cache of the regions that have caught up the read index in `pollWaitIndex`.
+    void finishWaitIndex()
+    {
+        const auto & regions_info = mvcc_query_info.getRegionsInfo();
+        for (auto region_idx : caught_up_regions)
+        {
+            const auto & region_to_query = regions_info[region_idx];
+            resolveLocks(region_to_query, regions_snapshot.find(region_to_query.region_id)->second);
+        }
+        caught_up_regions.clear();
+        onWaitIndexFinished();
+    }
+
+    LearnerReadSnapshot finish(Context & context, const Clock::time_point & start_time)
+    {
+        unavailable_regions.tryThrowRegionException(for_batch_cop);
+
+        const auto end_time = Clock::now();
+        const auto time_elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
+        // Use info level if read wait index run slow
+        const auto log_lvl = time_elapsed_ms > 1000 ? Poco::Message::PRIO_INFORMATION : Poco::Message::PRIO_DEBUG;
+        LOG_IMPL(
+            log,
+            log_lvl,
+            "[Learner Read] batch read index | wait index"
+            " total_cost={} read_cost={} wait_cost={} n_regions={} n_stale_read={} n_unavailable={}",
+            time_elapsed_ms,
+            stats.read_index_elapsed_ms,
+            stats.wait_index_elapsed_ms,
+            mvcc_query_info.getRegionsInfo().size(),
+            stats.num_stale_read,
+            unavailable_regions.size());
+
+        if (auto * dag_context = context.getDAGContext())
+        {
+            dag_context->has_read_wait_index = true;
+            dag_context->read_wait_index_start_timestamp = start_time;
+            dag_context->read_wait_index_end_timestamp = end_time;
+        }
+
+        return std::move(regions_snapshot);
+    }
+
+    const LearnerReadStatistics & getStats() const { return stats; }
+
+private:
+    void buildReadIndexRequests()
+    {
+        const auto & regions_info = mvcc_query_info.getRegionsInfo();
+        batch_read_index_req.reserve(regions_info.size());
+
+        // If using `std::numeric_limits<uint64_t>::max()`, set `start-ts` 0 to get the latest index but let read-index-worker do not record as history.
+        auto read_index_tso = mvcc_query_info->read_tso == std::numeric_limits<uint64_t>::max() ? 0 : mvcc_query_info->read_tso;
+        RegionTable & region_table = tmt.getRegionTable();
+        for (const auto & region_to_query : regions_info)
+        {
+            const RegionID region_id = region_to_query.region_id;
+            // don't stale read in test scenarios.
+            bool can_stale_read = mvcc_query_info->read_tso != std::numeric_limits<uint64_t>::max() && read_index_tso <= region_table.getSelfSafeTS(region_id);
+            if (!can_stale_read)
+            {
+                if (auto ori_read_index = mvcc_query_info.getReadIndexRes(region_id); ori_read_index)
+                {
+                    auto resp = kvrpcpb::ReadIndexResponse();
+                    resp.set_read_index(ori_read_index);
+                    batch_read_index_result.emplace(region_id, std::move(resp));
+                }
+                else
+                {
+                    auto & region = regions_snapshot.find(region_id)->second;
+                    batch_read_index_req.emplace_back(GenRegionReadIndexReq(*region, read_index_tso));
+                }
+            }
+            else
+            {
+                batch_read_index_result.emplace(region_id, kvrpcpb::ReadIndexResponse());
+                ++stats.num_stale_read;
+            }
+        }
+        GET_METRIC(tiflash_stale_read_count).Increment(stats.num_stale_read);
+        GET_METRIC(tiflash_raft_read_index_count).Increment(batch_read_index_req.size());
+    }
+
+    void releaseReadIndexEvent()
+    {
+        if (holding_read_index_event)
+        {
+            holding_read_index_event = false;
+            kvstore->addReadIndexEvent(-1);
+        }
+    }
+
+    void makeDefaultReadIndexResult(bool with_region_error)
+    {
+        for (const auto & req : batch_read_index_req)
+        {
+            auto resp = kvrpcpb::ReadIndexResponse();
+            if (with_region_error)
+                resp.mutable_region_error()->mutable_region_not_found();
+            batch_read_index_result.emplace(req.context().region_id(), std::move(resp));
+        }
+    }
+
+    void onReadIndexFinished()
+    {
+        {
+            stats.read_index_elapsed_ms = watch.elapsedMilliseconds();
+            GET_METRIC(tiflash_raft_read_index_duration_seconds).Observe(stats.read_index_elapsed_ms / 1000.0);
+            const size_t cached_size = mvcc_query_info.getRegionsInfo().size() - batch_read_index_req.size();
+
+            LOG_DEBUG(
+                log,
+                "Batch read index, original size {}, send & get {} message, cost {}ms{}",
+                mvcc_query_info.getRegionsInfo().size(),
+                batch_read_index_req.size(),
+                stats.read_index_elapsed_ms,
+                (cached_size != 0) ? (fmt::format(", {} in cache", cached_size)) : "");
+
+            watch.restart(); // restart to count the elapsed of wait index
+        }
+
+        // if size of batch_read_index_result is not equal with batch_read_index_req, there must be region_error/lock, find and return directly.
+        for (auto & [region_id, resp] : batch_read_index_result)
+        {
+            if (resp.has_region_error())
             {
-                Int64 physical_table_id = region_to_query.physical_table_id;
-                auto res = RegionTable::resolveLocksAndWriteRegion(
-                    tmt,
-                    physical_table_id,
-                    region,
-                    mvcc_query_info->read_tso,
-                    region_to_query.bypass_lock_ts,
-                    region_to_query.version,
-                    region_to_query.conf_version,
-                    log);
-
-                std::visit(
-                    variant_op::overloaded{
-                        [&](LockInfoPtr & lock) { unavailable_regions.setRegionLock(region->id(), std::move(lock)); },
-                        [&](RegionException::RegionReadStatus & status) {
-                            if (status != RegionException::RegionReadStatus::OK)
-                            {
-                                LOG_WARNING(
-                                    log,
-                                    "Check memory cache, region {}, version {}, handle range {}, status {}",
-                                    region_to_query.region_id,
-                                    region_to_query.version,
-                                    RecordKVFormat::DecodedTiKVKeyRangeToDebugString(region_to_query.range_in_table),
-                                    magic_enum::enum_name(status));
-                                unavailable_regions.add(region->id(), status);
-                            }
-                        },
-                    },
-                    res);
+                const auto & region_error = resp.region_error();
+                auto region_status = RegionException::RegionReadStatus::NOT_FOUND;
+                if (region_error.has_epoch_not_match())
+                    region_status = RegionException::RegionReadStatus::EPOCH_NOT_MATCH;
+                unavailable_regions.add(region_id, region_status);
+            }
+            else if (resp.has_locked())
+            {
+                unavailable_regions.setRegionLock(region_id, LockInfoPtr(resp.release_locked()));
+            }
+            else
+            {
+                // cache read-index to avoid useless overhead about retry.
+                // resp.read_index() is 0 when stale read, skip it to avoid overwriting read_index res in last retry.
+                if (resp.read_index() != 0)
+                {
+                    mvcc_query_info.addReadIndexRes(region_id, resp.read_index());
+                }
             }
         }
+    }
+
+    void handleWaitIndexTimeout(const RegionID region_id, UInt64 index)
+    {
+        if (!for_batch_cop)
+        {
+            // If server is being terminated / time-out, add the region_id into `unavailable_regions` to other store.
+            unavailable_regions.add(region_id, RegionException::RegionReadStatus::NOT_FOUND);
+            return;
+        }
+        // TODO: Maybe collect all the Regions that happen wait index timeout instead of just throwing one Region id
+        throw TiFlashException(Errors::Coprocessor::RegionError, "Region {} is unavailable at {}", region_id, index);
+    }
+
+    // Try to resolve locks and flush data into storage layer
+    void resolveLocks(const RegionQueryInfo & region_to_query, const RegionPtr & region)
+    {
+        if (!mvcc_query_info->resolve_locks)
+            return;
+
+        Int64 physical_table_id = region_to_query.physical_table_id;
+        auto res = RegionTable::resolveLocksAndWriteRegion(
+            tmt,
+            physical_table_id,
+            region,
+            mvcc_query_info->read_tso,
+            region_to_query.bypass_lock_ts,
+            region_to_query.version,
+            region_to_query.conf_version,
+            log);
+
+        std::visit(
+            variant_op::overloaded{
+                [&](LockInfoPtr & lock) { unavailable_regions.setRegionLock(region->id(), std::move(lock)); },
+                [&](RegionException::RegionReadStatus & status) {
+                    if (status != RegionException::RegionReadStatus::OK)
+                    {
+                        LOG_WARNING(
+                            log,
+                            "Check memory cache, region {}, version {}, handle range {}, status {}",
+                            region_to_query.region_id,
+                            region_to_query.version,
+                            RecordKVFormat::DecodedTiKVKeyRangeToDebugString(region_to_query.range_in_table),
+                            magic_enum::enum_name(status));
+                        unavailable_regions.add(region->id(), status);
+                    }
+                },
+            },
+            res);
+    }
+
+    void onWaitIndexFinished()
+    {
         GET_METRIC(tiflash_syncing_data_freshness).Observe(batch_wait_data_watch.elapsedSeconds()); // For DBaaS SLI
         stats.wait_index_elapsed_ms = watch.elapsedMilliseconds();
         LOG_DEBUG(
@@ -400,37 +617,103 @@ LearnerReadSnapshot doLearnerRead(
             batch_read_index_req.size(),
             stats.wait_index_elapsed_ms,
             unavailable_regions.size());
-    };
+    }
+
+private:
+    MvccQueryInfoWrap mvcc_query_info;
+    TMTContext & tmt;
+    KVStorePtr & kvstore;
+    const bool for_batch_cop;
+    const LoggerPtr log;
+
+    LearnerReadSnapshot regions_snapshot;
+    UnavailableRegions unavailable_regions;
+    LearnerReadStatistics stats;
+
+    Stopwatch batch_wait_data_watch;
+    Stopwatch watch;
+
+    std::vector<kvrpcpb::ReadIndexRequest> batch_read_index_req;
+    std::unordered_map<RegionID, kvrpcpb::ReadIndexResponse> batch_read_index_result;
+
+    // Only used by async learner read.
+    // The futures are in the same order as `batch_read_index_req`, finished ones are reset to nullptr.
+    std::vector<ReadIndexFuturePtr> read_index_futures;
+    bool holding_read_index_event = false;
+    bool wait_index_started = false;
+    // The index in `regions_info` of regions that have not caught up the read index.
+    std::vector<size_t> pending_regions;
+    // The index in `regions_info` of regions that have caught up the read index, the locks are not resolved yet.
+    std::vector<size_t> caught_up_regions;
+};
+
+LearnerReadSnapshot doLearnerRead(
+    const TiDB::TableID logical_table_id,
+    MvccQueryInfo & mvcc_query_info_,
+    bool for_batch_cop,
+    Context & context,
+    const LoggerPtr & log)
+{
+    assert(log != nullptr);
+    RUNTIME_ASSERT(!(context.getSharedContextDisagg()->isDisaggregatedComputeMode() && context.getSharedContextDisagg()->use_autoscaler));
+
+    LearnerReadWorker worker(logical_table_id, mvcc_query_info_, context.getTMTContext(), for_batch_cop, log);
+    worker.buildRegionsSnapshot();
 
     const auto start_time = Clock::now();
-    batch_wait_index(0);
-
-    unavailable_regions.tryThrowRegionException(for_batch_cop);
-
-    const auto end_time = Clock::now();
-    const auto time_elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
-    // Use info level if read wait index run slow
-    const auto log_lvl = time_elapsed_ms > 1000 ? Poco::Message::PRIO_INFORMATION : Poco::Message::PRIO_DEBUG;
-    LOG_IMPL(
-        log,
-        log_lvl,
-        "[Learner Read] batch read index | wait index"
-        " total_cost={} read_cost={} wait_cost={} n_regions={} n_stale_read={} n_unavailable={}",
-        time_elapsed_ms,
-        stats.read_index_elapsed_ms,
-        stats.wait_index_elapsed_ms,
-        num_regions,
-        stats.num_stale_read,
-        unavailable_regions.size());
-
-    if (auto * dag_context = context.getDAGContext())
+    worker.readIndex();
+    worker.waitIndex();
+    return worker.finish(context, start_time);
+}
+
+AsyncLearnerRead::AsyncLearnerRead(
+    const TiDB::TableID logical_table_id,
+    MvccQueryInfo & mvcc_query_info,
+    bool for_batch_cop,
+    Context & context_,
+    const LoggerPtr & log)
+    : context(context_)
+{
+    assert(log != nullptr);
+    RUNTIME_ASSERT(!(context.getSharedContextDisagg()->isDisaggregatedComputeMode() && context.getSharedContextDisagg()->use_autoscaler));
+
+    worker = std::make_unique<LearnerReadWorker>(logical_table_id, mvcc_query_info, context.getTMTContext(), for_batch_cop, log);
+    worker->buildRegionsSnapshot();
+
+    start_time = Clock::now();
+    worker->submitReadIndex();
+}
+
+AsyncLearnerRead::~AsyncLearnerRead() = default;
+
+bool AsyncLearnerRead::poll()
+{
+    switch (stage)
     {
-        dag_context->has_read_wait_index = true;
-        dag_context->read_wait_index_start_timestamp = start_time;
-        dag_context->read_wait_index_end_timestamp = end_time;
+    case Stage::ReadIndex:
+        if (!worker->pollReadIndex())
+            return false;
+        GET_METRIC(tiflash_raft_async_learner_read_duration_seconds, type_read_index).Observe(worker->getStats().read_index_elapsed_ms / 1000.0);
+        stage = Stage::WaitIndex;
+        [[fallthrough]];
+    case Stage::WaitIndex:
+        if (!worker->pollWaitIndex())
+            return false;
+        GET_METRIC(tiflash_raft_async_learner_read_duration_seconds, type_wait_index).Observe(worker->getStats().wait_index_elapsed_ms / 1000.0);
+        stage = Stage::Finished;
+        [[fallthrough]];
+    case Stage::Finished:
+        return true;
     }
+    __builtin_unreachable();
+}
 
-    return regions_snapshot;
+LearnerReadSnapshot AsyncLearnerRead::finish()
+{
+    RUNTIME_CHECK_MSG(stage == Stage::Finished, "AsyncLearnerRead::finish is called before learner read is done");
+    worker->finishWaitIndex();
+    GET_METRIC(tiflash_raft_async_learner_read_duration_seconds, type_total).Observe(std::chrono::duration_cast<std::chrono::duration<double>>(Clock::now() - start_time).count());
+    return worker->finish(context, start_time);
 }
 
 /// Ensure regions' info after read.
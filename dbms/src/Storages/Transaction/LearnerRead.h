@@ -19,6 +19,7 @@
 #include <Storages/Transaction/Region.h>
 #include <Storages/Transaction/Types.h>
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -46,6 +47,46 @@ doLearnerRead(
     Context & context,
     const LoggerPtr & log);
 
+class LearnerReadWorker;
+
+/// The non-blocking version of `doLearnerRead`.
+/// Read-index requests are sent when constructing, then the caller should call `poll` repeatedly until it returns true
+/// instead of blocking the thread, e.g. in the `awaitImpl` of a pipeline task, which is checked by `WaitReactor`.
+/// `poll` only checks the read index and the applied index, so it is cheap.
+/// After `poll` returns true, call `finish` to resolve locks and get the snapshot, it may throw `RegionException` like `doLearnerRead`.
+/// Note that it falls back to blocking read index if read-index workers are not enabled in KVStore.
+class AsyncLearnerRead
+{
+public:
+    AsyncLearnerRead(
+        const TiDB::TableID table_id,
+        MvccQueryInfo & mvcc_query_info,
+        bool for_batch_cop,
+        Context & context_,
+        const LoggerPtr & log);
+
+    ~AsyncLearnerRead();
+
+    // Return true if both read index and wait index are done.
+    bool poll();
+
+    [[nodiscard]] LearnerReadSnapshot finish();
+
+private:
+    enum class Stage
+    {
+        ReadIndex,
+        WaitIndex,
+        Finished,
+    };
+
+    Context & context;
+    std::unique_ptr<LearnerReadWorker> worker;
+    Stage stage = Stage::ReadIndex;
+    Clock::time_point start_time;
+};
+using AsyncLearnerReadPtr = std::unique_ptr<AsyncLearnerRead>;
+
 // After getting stream from storage, we must make sure regions' version haven't changed after learner read.
 // If some regions' version changed, this function will throw `RegionException`.
 void validateQueryInfo(
@@ -145,9 +145,9 @@ static void writeRegionDataToStorage(
         {
             auto dm_storage = std::dynamic_pointer_cast<StorageDeltaMerge>(storage);
             if (need_decode)
-                dm_storage->write(*block_ptr, context.getSettingsRef());
+                dm_storage->writeCombined(*block_ptr, context.getSettingsRef());
             else
-                dm_storage->write(block, context.getSettingsRef());
+                dm_storage->writeCombined(block, context.getSettingsRef());
             break;
         }
         default:
@@ -732,6 +732,16 @@ ReadIndexFuturePtr ReadIndexWorkerManager::genReadIndexFuture(const kvrpcpb::Rea
     return getWorkerByRegion(req.context().region_id()).genReadIndexFuture(req);
 }
 
+std::vector<ReadIndexFuturePtr> ReadIndexWorkerManager::genReadIndexFutures(const std::vector<kvrpcpb::ReadIndexRequest> & reqs)
+{
+    std::vector<ReadIndexFuturePtr> futures;
+    futures.reserve(reqs.size());
+    for (const auto & req : reqs)
+        futures.emplace_back(genReadIndexFuture(req));
+    this->wakeAll();
+    return futures;
+}
+
 void ReadIndexWorker::runOneRound(SteadyClock::duration min_dur)
 {
     if (!read_index_notify_ctrl->empty())
@@ -915,6 +925,14 @@ BatchReadIndexRes KVStore::batchReadIndex(const std::vector<kvrpcpb::ReadIndexRe
     }
 }
 
+std::optional<std::vector<ReadIndexFuturePtr>> KVStore::genReadIndexFutures(const std::vector<kvrpcpb::ReadIndexRequest> & reqs) const
+{
+    assert(this->proxy_helper);
+    if (!read_index_worker_manager)
+        return std::nullopt;
+    return read_index_worker_manager->genReadIndexFutures(reqs);
+}
+
 std::unique_ptr<ReadIndexWorkerManager> ReadIndexWorkerManager::newReadIndexWorkerManager(
     const TiFlashRaftProxyHelper & proxy_helper,
     size_t cap,
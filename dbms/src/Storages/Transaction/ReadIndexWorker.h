@@ -105,6 +105,10 @@ public:
 
     ReadIndexFuturePtr genReadIndexFuture(const kvrpcpb::ReadIndexRequest & req);
 
+    /// Generate futures for a batch of read-index requests and wake runners to handle them.
+    /// Unlike `batchReadIndex`, the caller is not blocked and should poll the futures by itself.
+    std::vector<ReadIndexFuturePtr> genReadIndexFutures(const std::vector<kvrpcpb::ReadIndexRequest> & reqs);
+
 private:
     void runOneRoundAll(SteadyClock::duration min_dur = std::chrono::milliseconds{0});
 
@@ -23,6 +23,7 @@
 #include <Storages/Transaction/SSTReader.h>
 #include <Storages/Transaction/TMTContext.h>
 #include <Storages/Transaction/TiKVRange.h>
+#include <Storages/Transaction/TiKVRecordFormat.h>
 
 #include <ext/scope_guard.h>
 #include <memory>
@@ -70,7 +71,15 @@ void Region::insert(ColumnFamilyType type, TiKVKey && key, TiKVValue && value)
 
 void Region::doInsert(ColumnFamilyType type, TiKVKey && key, TiKVValue && value)
 {
+    const auto commit_ts = type == ColumnFamilyType::Write ? RecordKVFormat::getTs(key) : 0;
     data.insert(type, std::move(key), std::move(value));
+    updateMaxAppliedCommitTs(commit_ts);
+}
+
+void Region::updateMaxAppliedCommitTs(UInt64 commit_ts)
+{
+    if (commit_ts > max_applied_commit_ts.load(std::memory_order_relaxed))
+        max_applied_commit_ts.store(commit_ts, std::memory_order_release);
 }
 
 void Region::remove(const std::string & cf, const TiKVKey & key)
@@ -112,6 +121,7 @@ RegionPtr Region::splitInto(RegionMeta && meta)
 
     const auto range = new_region->getRange();
     data.splitInto(range->comparableKeys(), new_region->data);
+    new_region->max_applied_commit_ts.store(maxAppliedCommitTs(), std::memory_order_release);
 
     return new_region;
 }
@@ -274,6 +284,7 @@ RegionID RegionRaftCommandDelegate::execCommitMerge(const raft_cmdpb::AdminReque
         { // Only operation region merge will lock 2 regions at same time. We have made it safe under task lock in KVStore.
             std::shared_lock<std::shared_mutex> lock2(source_region->mutex);
             data.mergeFrom(source_region->data);
+            updateMaxAppliedCommitTs(source_region->maxAppliedCommitTs());
         }
 
         meta_delegate.execCommitMerge(res, index, term, source_region_meta_delegate, response);
@@ -391,6 +402,7 @@ RegionPtr Region::deserialize(ReadBuffer & buf, const TiFlashRaftProxyHelper * p
     auto region = std::make_shared<Region>(std::move(meta), proxy_helper);
 
     RegionData::deserialize(buf, region->data);
+    region->max_applied_commit_ts.store(UNKNOWN_COMMIT_TS, std::memory_order_release);
     return region;
 }
 
@@ -579,6 +591,7 @@ void Region::assignRegion(Region && new_region)
     std::unique_lock<std::shared_mutex> lock(mutex);
 
     data.assignRegionData(std::move(new_region.data));
+    max_applied_commit_ts.store(new_region.maxAppliedCommitTs(), std::memory_order_release);
 
     meta.assignRegionMeta(std::move(new_region.meta));
     meta.notifyAll();
@@ -743,6 +756,7 @@ void Region::finishIngestSSTByDTFile(RegionPtr && rhs, UInt64 index, UInt64 term
             // Merge the uncommitted data from `rhs`
             // (we have taken the ownership of `rhs`, so don't acquire lock on `rhs.mutex`)
             data.mergeFrom(rhs->data);
+            updateMaxAppliedCommitTs(rhs->maxAppliedCommitTs());
         }
 
         meta.setApplied(index, term);
@@ -19,6 +19,7 @@
 #include <Storages/Transaction/TiKVKeyValue.h>
 #include <common/logger_useful.h>
 
+#include <limits>
 #include <shared_mutex>
 
 namespace kvrpcpb
@@ -153,6 +154,13 @@ public:
     void markCompactLog() const;
     Timepoint lastCompactLogTime() const;
 
+    /// The max commit ts of the writes that have been applied to this region, or `UNKNOWN_COMMIT_TS`
+    /// if the region is restored from disk, whose applied writes before restarting are unknown. It is
+    /// known again after the region applies a snapshot.
+    UInt64 maxAppliedCommitTs() const { return max_applied_commit_ts.load(std::memory_order_acquire); }
+
+    static constexpr UInt64 UNKNOWN_COMMIT_TS = std::numeric_limits<UInt64>::max();
+
     friend bool operator==(const Region & region1, const Region & region2)
     {
         std::shared_lock<std::shared_mutex> lock1(region1.mutex);
@@ -223,6 +231,7 @@ private:
     DecodedLockCFValuePtr getLockInfo(const RegionLockReadQuery & query) const;
 
     RegionPtr splitInto(RegionMeta && meta);
+    void updateMaxAppliedCommitTs(UInt64 commit_ts);
     void setPeerState(raft_serverpb::PeerState state);
 
 private:
@@ -239,6 +248,8 @@ private:
     std::atomic<UInt64> snapshot_event_flag{1};
     const TiFlashRaftProxyHelper * proxy_helper{nullptr};
     mutable std::atomic<Timepoint> last_compact_log_time{Timepoint::min()};
+    // Only updated under the unique lock of `mutex`. A region is created empty, except by `deserialize`.
+    std::atomic<UInt64> max_applied_commit_ts{0};
     mutable std::atomic<size_t> approx_mem_cache_rows{0};
     mutable std::atomic<size_t> approx_mem_cache_bytes{0};
 };
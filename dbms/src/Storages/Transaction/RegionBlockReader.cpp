@@ -112,6 +112,16 @@ bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & d
             auto * raw_column = const_cast<IColumn *>((block.getByPosition(pos)).column.get());
             raw_column->reserve(expected_rows);
         }
+
+        // Try to decode the value part of all rows column by column, fall back to decode row by row
+        // if some rows do not exactly match the schema.
+        RowV2BatchDecoder batch_decoder(schema_snapshot, column_ids_iter, read_column_ids.end(), next_column_pos);
+        if (batch_decoder.prepare(data_list))
+        {
+            if (!batch_decoder.decode(data_list, block, force_decode))
+                return false;
+            need_decode_value = false;
+        }
     }
 
     size_t index = 0;
@@ -12,12 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Columns/ColumnNullable.h>
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
 #include <Columns/IColumn.h>
+#include <Common/typeid_cast.h>
 #include <IO/Endian.h>
 #include <IO/Operators.h>
 #include <Storages/Transaction/Datum.h>
 #include <Storages/Transaction/DatumCodec.h>
 #include <Storages/Transaction/RowCodec.h>
+#include <Storages/Transaction/TiKVRecordFormat.h>
 
 
 namespace DB
@@ -518,6 +523,248 @@ bool appendRowV2ToBlockImpl(
     return true;
 }
 
+RowV2BatchDecoder::RowV2BatchDecoder(
+    const DecodingStorageSchemaSnapshotConstPtr & schema_snapshot_,
+    SortedColumnIDWithPosConstIter column_ids_iter,
+    SortedColumnIDWithPosConstIter column_ids_iter_end,
+    size_t block_column_pos)
+    : schema_snapshot(schema_snapshot_)
+{
+    // when pk is handle, the pk column is decoded from encoded key instead of encoded value
+    if (schema_snapshot->pk_is_handle)
+        pk_handle_id = schema_snapshot->pk_column_ids[0];
+
+    for (; column_ids_iter != column_ids_iter_end; ++column_ids_iter, ++block_column_pos)
+    {
+        if (column_ids_iter->first == pk_handle_id)
+            continue;
+        const auto & cd = (*schema_snapshot->column_defines)[column_ids_iter->second];
+        const bool can_be_absent = schema_snapshot->is_common_handle && schema_snapshot->column_infos[column_ids_iter->second].hasPriKeyFlag();
+        targets.push_back(Target{column_ids_iter->first, block_column_pos, cd.type->isNullable(), can_be_absent});
+    }
+}
+
+template <bool is_big>
+bool RowV2BatchDecoder::collectDatumLocs(const TiKVValue::Base & raw_value, size_t row_idx)
+{
+    size_t cursor = 2; // Skip the initial codec ver and row flag.
+    size_t num_not_null_columns = decodeUInt<UInt16>(cursor, raw_value);
+    size_t num_null_columns = decodeUInt<UInt16>(cursor, raw_value);
+    not_null_column_ids.clear();
+    null_column_ids.clear();
+    value_offsets.clear();
+    decodeUInts<ColumnID, typename RowV2::Types<is_big>::ColumnIDType>(cursor, raw_value, num_not_null_columns, not_null_column_ids);
+    decodeUInts<ColumnID, typename RowV2::Types<is_big>::ColumnIDType>(cursor, raw_value, num_null_columns, null_column_ids);
+    decodeUInts<size_t, typename RowV2::Types<is_big>::ValueOffsetType>(cursor, raw_value, num_not_null_columns, value_offsets);
+    size_t values_start_pos = cursor;
+
+    size_t idx_not_null = 0;
+    size_t idx_null = 0;
+    size_t idx_target = 0;
+    // Merge ordered not null/null columns to keep order, same as `appendRowV2ToBlockImpl`.
+    while (idx_not_null < not_null_column_ids.size() || idx_null < null_column_ids.size())
+    {
+        bool is_null;
+        if (idx_not_null < not_null_column_ids.size() && idx_null < null_column_ids.size())
+            is_null = not_null_column_ids[idx_not_null] > null_column_ids[idx_null];
+        else
+            is_null = idx_null < null_column_ids.size();
+
+        auto next_datum_column_id = is_null ? null_column_ids[idx_null] : not_null_column_ids[idx_not_null];
+        if (next_datum_column_id != pk_handle_id)
+        {
+            // skip the absent pk columns, they are decoded from the key
+            while (idx_target < targets.size() && targets[idx_target].column_id < next_datum_column_id && targets[idx_target].can_be_absent)
+            {
+                targets[idx_target].num_absent++;
+                ++idx_target;
+            }
+            // extra column or missing column, let `appendRowToBlock` handle it
+            if (idx_target == targets.size() || targets[idx_target].column_id != next_datum_column_id)
+                return false;
+
+            auto & target = targets[idx_target];
+            auto & loc = datum_locs[idx_target * num_rows + row_idx];
+            if (is_null)
+            {
+                if (!target.is_nullable)
+                    return false;
+                target.has_default = true;
+                loc = DatumLoc{0, NullDatumLength};
+            }
+            else
+            {
+                size_t start = idx_not_null ? value_offsets[idx_not_null - 1] : 0;
+                loc = DatumLoc{static_cast<UInt32>(values_start_pos + start), static_cast<UInt32>(value_offsets[idx_not_null] - start)};
+            }
+            ++idx_target;
+        }
+
+        if (is_null)
+            idx_null++;
+        else
+            idx_not_null++;
+    }
+    for (; idx_target < targets.size(); ++idx_target)
+    {
+        if (!targets[idx_target].can_be_absent)
+            return false;
+        targets[idx_target].num_absent++;
+    }
+    return true;
+}
+
+bool RowV2BatchDecoder::prepare(const RegionDataReadInfoList & data_list)
+{
+    num_rows = data_list.size();
+    datum_locs.resize(targets.size() * num_rows);
+    for (auto & target : targets)
+    {
+        target.has_default = false;
+        target.num_absent = 0;
+    }
+
+    for (size_t row_idx = 0; row_idx < num_rows; ++row_idx)
+    {
+        const auto & [pk, write_type, commit_ts, value_ptr] = data_list[row_idx];
+        if (write_type == RecordKVFormat::CFModifyFlag::DelFlag)
+        {
+            for (size_t i = 0; i < targets.size(); ++i)
+            {
+                targets[i].has_default = true;
+                datum_locs[i * num_rows + row_idx] = DatumLoc{0, NullDatumLength};
+            }
+            continue;
+        }
+
+        const TiKVValue::Base & raw_value = *value_ptr;
+        if (static_cast<UInt8>(raw_value[0]) != static_cast<UInt8>(RowCodecVer::ROW_V2))
+            return false;
+        bool is_big = readLittleEndian<UInt8>(&raw_value[1]) & RowV2::BigRowMask;
+        if (!(is_big ? collectDatumLocs<true>(raw_value, row_idx) : collectDatumLocs<false>(raw_value, row_idx)))
+            return false;
+    }
+
+    // A pk column must be either present in all rows or absent in all rows, so that it
+    // can be filled from the key row by row after the batch decoding.
+    for (const auto & target : targets)
+    {
+        if (target.num_absent != 0 && target.num_absent != num_rows)
+            return false;
+    }
+    return true;
+}
+
+namespace
+{
+template <typename ColumnType, bool has_default>
+bool decodeDatumsInBatch(
+    ColumnType & column,
+    PaddedPODArray<UInt8> * null_map,
+    const RowV2BatchDecoder::DatumLoc * locs,
+    const RegionDataReadInfoList & data_list,
+    bool force_decode)
+{
+    for (size_t row_idx = 0; row_idx < data_list.size(); ++row_idx)
+    {
+        const auto & loc = locs[row_idx];
+        if constexpr (has_default)
+        {
+            if (loc.length == RowV2BatchDecoder::NullDatumLength)
+            {
+                column.insertDefault();
+                if (null_map)
+                    null_map->push_back(1);
+                continue;
+            }
+        }
+        const TiKVValue::Base & raw_value = *std::get<3>(data_list[row_idx]);
+        if (!column.decodeTiDBRowV2Datum(loc.cursor, raw_value, loc.length, force_decode))
+            return false;
+        if (null_map)
+            null_map->push_back(0);
+    }
+    return true;
+}
+
+template <typename ColumnType>
+bool decodeDatumsInBatch(
+    ColumnType & column,
+    PaddedPODArray<UInt8> * null_map,
+    const RowV2BatchDecoder::DatumLoc * locs,
+    const RegionDataReadInfoList & data_list,
+    bool has_default,
+    bool force_decode)
+{
+    return has_default ? decodeDatumsInBatch<ColumnType, true>(column, null_map, locs, data_list, force_decode)
+                       : decodeDatumsInBatch<ColumnType, false>(column, null_map, locs, data_list, force_decode);
+}
+
+/// Return std::nullopt if the column is not a `ColumnVector` of any type in `Ts`.
+template <typename... Ts>
+std::optional<bool> tryDecodeNumbersInBatch(
+    IColumn & column,
+    PaddedPODArray<UInt8> * null_map,
+    const RowV2BatchDecoder::DatumLoc * locs,
+    const RegionDataReadInfoList & data_list,
+    bool has_default,
+    bool force_decode)
+{
+    std::optional<bool> res;
+    // `ColumnVector` is final, so the type-specific decoding can be inlined into the loop
+    ([&] {
+        if (auto * column_vector = typeid_cast<ColumnVector<Ts> *>(&column); column_vector)
+        {
+            res = decodeDatumsInBatch(*column_vector, null_map, locs, data_list, has_default, force_decode);
+            return true;
+        }
+        return false;
+    }()
+     || ...);
+    return res;
+}
+} // namespace
+
+bool RowV2BatchDecoder::decode(const RegionDataReadInfoList & data_list, Block & block, bool force_decode) const
+{
+    assert(data_list.size() == num_rows);
+    for (size_t i = 0; i < targets.size(); ++i)
+    {
+        const auto & target = targets[i];
+        if (target.num_absent != 0)
+            continue;
+        const auto * locs = datum_locs.data() + i * num_rows;
+        auto * raw_column = const_cast<IColumn *>((block.getByPosition(target.block_column_pos)).column.get());
+
+        IColumn * column = raw_column;
+        PaddedPODArray<UInt8> * null_map = nullptr;
+        if (raw_column->isColumnNullable())
+        {
+            auto & nullable_column = static_cast<ColumnNullable &>(*raw_column);
+            column = &nullable_column.getNestedColumn();
+            null_map = &nullable_column.getNullMapData();
+        }
+
+        auto res = tryDecodeNumbersInBatch<Int64, UInt64, Int32, UInt32, Int16, UInt16, Int8, UInt8, Float64, Float32>(
+            *column,
+            null_map,
+            locs,
+            data_list,
+            target.has_default,
+            force_decode);
+        if (!res)
+        {
+            if (auto * column_string = typeid_cast<ColumnString *>(column); column_string)
+                res = decodeDatumsInBatch(*column_string, null_map, locs, data_list, target.has_default, force_decode);
+            else
+                res = decodeDatumsInBatch(*column, null_map, locs, data_list, target.has_default, force_decode);
+        }
+        if (!*res)
+            return false;
+    }
+    return true;
+}
+
 using TiDB::DatumFlat;
 bool appendRowV1ToBlock(
     const TiKVValue::Base & raw_value,
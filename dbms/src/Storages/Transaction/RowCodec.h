@@ -16,6 +16,7 @@
 
 #include <Core/Block.h>
 #include <Storages/Transaction/DecodingStorageSchemaSnapshot.h>
+#include <Storages/Transaction/RegionDataRead.h>
 #include <Storages/Transaction/TiKVKeyValue.h>
 
 namespace DB
@@ -33,5 +34,66 @@ bool appendRowToBlock(
     const DecodingStorageSchemaSnapshotConstPtr & schema_snapshot,
     bool force_decode);
 
+/// Decode the value part of a batch of rows encoded in row format v2 column by column.
+/// `prepare` scans the column id and offset arrays of all rows first, then `decode` fills each
+/// destination column in a tight loop, which avoids dispatching on the column type for every datum.
+/// Only rows that exactly match the schema are supported, otherwise the caller should fall back to `appendRowToBlock`.
+class RowV2BatchDecoder
+{
+public:
+    RowV2BatchDecoder(
+        const DecodingStorageSchemaSnapshotConstPtr & schema_snapshot_,
+        SortedColumnIDWithPosConstIter column_ids_iter,
+        SortedColumnIDWithPosConstIter column_ids_iter_end,
+        size_t block_column_pos);
+
+    /// Collect the location of each datum in `data_list`, nothing is written into the block.
+    /// Return false if any row can not be decoded in batch, i.e. it is encoded in row format v1,
+    /// it has extra/missing columns or it has null value for a not null column.
+    /// Pk columns that are absent in all rows are skipped and left for decoding from the key.
+    bool prepare(const RegionDataReadInfoList & data_list);
+
+    /// Append the values of all rows in `data_list` to `block`. Deleted rows are filled with default values.
+    /// Must be called after `prepare` returns true.
+    bool decode(const RegionDataReadInfoList & data_list, Block & block, bool force_decode) const;
+
+    /// The location of a datum in the encoded value, `length == NullDatumLength` means the datum is null or the row is deleted.
+    struct DatumLoc
+    {
+        UInt32 cursor;
+        UInt32 length;
+    };
+    static constexpr UInt32 NullDatumLength = std::numeric_limits<UInt32>::max();
+
+    struct Target
+    {
+        ColumnID column_id;
+        size_t block_column_pos;
+        bool is_nullable;
+        // For clustered index, the pk column may be absent in the value and decoded from the key instead.
+        bool can_be_absent;
+        // whether there are null values or deleted rows of this column in the batch
+        bool has_default = false;
+        size_t num_absent = 0;
+    };
+
+private:
+    template <bool is_big>
+    bool collectDatumLocs(const TiKVValue::Base & raw_value, size_t row_idx);
+
+private:
+    DecodingStorageSchemaSnapshotConstPtr schema_snapshot;
+    ColumnID pk_handle_id = InvalidColumnID;
+    std::vector<Target> targets;
+
+    size_t num_rows = 0;
+    // column-major, the location of datum of `targets[i]` in row `j` is `datum_locs[i * num_rows + j]`
+    std::vector<DatumLoc> datum_locs;
+
+    // buffers for decoding the row header, reused among rows
+    std::vector<ColumnID> not_null_column_ids;
+    std::vector<ColumnID> null_column_ids;
+    std::vector<size_t> value_offsets;
+};
 
 } // namespace DB
@@ -121,6 +121,39 @@ protected:
             ColumnIDValue(10, DecimalField(ToDecimal<UInt64, Decimal64>(12345678910ULL, 4), 4)),
             ColumnIDValueNull<UInt64>(11));
     }
+
+    // A table without primary key, the columns are Int64/nullable UInt64/String/Float64 in turn.
+    std::pair<TableInfo, std::vector<Field>> getWideTableInfoFields(size_t num_columns) const
+    {
+        TableInfo table_info;
+        std::vector<Field> fields;
+        for (size_t i = 0; i < num_columns; ++i)
+        {
+            const ColumnID column_id = i + 2;
+            switch (i % 4)
+            {
+            case 0:
+                table_info.columns.emplace_back(getColumnInfo<Int64>(column_id));
+                fields.emplace_back(static_cast<Int64>(handle_value + i));
+                break;
+            case 1:
+                table_info.columns.emplace_back(getColumnInfo<UInt64, true>(column_id));
+                fields.emplace_back(i % 8 == 1 ? Field() : Field(static_cast<UInt64>(i)));
+                break;
+            case 2:
+                table_info.columns.emplace_back(getColumnInfo<String>(column_id));
+                fields.emplace_back(String("value_of_column_") + std::to_string(column_id));
+                break;
+            default:
+                table_info.columns.emplace_back(getColumnInfo<Float64>(column_id));
+                fields.emplace_back(static_cast<Float64>(i) / 3);
+                break;
+            }
+        }
+        table_info.pk_is_handle = false;
+        table_info.is_common_handle = false;
+        return std::make_pair(std::move(table_info), std::move(fields));
+    }
 };
 
 BENCHMARK_DEFINE_F(RegionBlockReaderBenchTest, CommonHandle)
@@ -163,10 +196,25 @@ BENCHMARK_DEFINE_F(RegionBlockReaderBenchTest, PKIsHandle)
     }
 }
 
+BENCHMARK_DEFINE_F(RegionBlockReaderBenchTest, WideTable)
+(benchmark::State & state)
+{
+    size_t num_columns = state.range(0);
+    size_t num_rows = state.range(1);
+    auto [table_info, fields] = getWideTableInfoFields(num_columns);
+    encodeColumns(table_info, fields, RowEncodeVersion::RowV2, num_rows);
+    auto decoding_schema = getDecodingStorageSchemaSnapshot(table_info);
+    for (auto _ : state)
+    {
+        decodeColumns(decoding_schema, true);
+    }
+}
+
 constexpr size_t num_iterations_test = 1000;
 
 BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, PKIsHandle)->Iterations(num_iterations_test)->Arg(1)->Arg(10)->Arg(100);
 BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, CommonHandle)->Iterations(num_iterations_test)->Arg(1)->Arg(10)->Arg(100);
 BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, PKIsNotHandle)->Iterations(num_iterations_test)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, WideTable)->Iterations(num_iterations_test)->Args({10, 100})->Args({50, 100})->Args({200, 100})->Args({10, 1000})->Args({50, 1000})->Args({200, 1000});
 
 } // namespace DB::tests
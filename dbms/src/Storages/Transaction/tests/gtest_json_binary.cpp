@@ -728,6 +728,26 @@ try
         ASSERT_TRUE(found);
         checkJsonPathKeyCacheDisable(path_expr);
     }
+
+    {
+        /// Every key can be found by binary search, and non-existent keys between or around them can not
+        for (const auto & [path, expect_found] : std::vector<std::pair<String, bool>>{
+                 {R"($."\"hello\"")", true},
+                 {"$.a", true},
+                 {"$.b", true},
+                 {"$.c", true},
+                 {"$.A", false},
+                 {"$.aa", false},
+                 {"$.d", false}})
+        {
+            std::vector<JsonPathExprRefContainerPtr> path_expr_container_vec;
+            auto path_expr = JsonPathExpr::parseJsonPathExpr(path);
+            ASSERT_TRUE(path_expr) << path;
+            path_expr_container_vec.push_back(std::make_unique<JsonPathExprRefContainer>(path_expr));
+            bool found = json_binary_1.extract(path_expr_container_vec, write_buffer);
+            ASSERT_EQ(found, expect_found) << path;
+        }
+    }
 }
 CATCH
 
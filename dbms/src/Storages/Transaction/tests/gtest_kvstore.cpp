@@ -735,6 +735,18 @@ TEST_F(RegionKVStoreTest, Region)
         }
         ASSERT_EQ(0, region->writeCFCount());
     }
+    {
+        // Only the commit ts of the write cf is tracked, and removing data does not lower it.
+        ASSERT_EQ(8, region->maxAppliedCommitTs());
+        region->insert("default", RecordKVFormat::genKey(table_id, 5, 15), TiKVValue("value1"));
+        region->insert("lock", RecordKVFormat::genKey(table_id, 5), RecordKVFormat::encodeLockCfValue(RecordKVFormat::CFModifyFlag::PutFlag, "PK", 15, 20));
+        ASSERT_EQ(8, region->maxAppliedCommitTs());
+        region->insert("write", RecordKVFormat::genKey(table_id, 6, 12), RecordKVFormat::encodeWriteCfValue(RecordKVFormat::CFModifyFlag::PutFlag, 10));
+        region->insert("write", RecordKVFormat::genKey(table_id, 7, 9), RecordKVFormat::encodeWriteCfValue(RecordKVFormat::CFModifyFlag::PutFlag, 7));
+        ASSERT_EQ(12, region->maxAppliedCommitTs());
+        region->clearAllData();
+        ASSERT_EQ(12, region->maxAppliedCommitTs());
+    }
     {
         ASSERT_EQ(0, region->dataSize());
 
@@ -328,6 +328,29 @@ TEST_F(RegionBlockReaderTest, CommonHandle)
     ASSERT_TRUE(decodeAndCheckColumns(decoding_schema, true));
 }
 
+TEST_F(RegionBlockReaderTest, DeletedRowsRowV2)
+{
+    auto [table_info, fields] = getNormalTableInfoFields({EXTRA_HANDLE_COLUMN_ID}, false);
+    encodeColumns(table_info, fields, RowEncodeVersion::RowV2);
+    // the value columns of deleted rows should be filled with default values
+    std::get<1>(data_list_read[1]) = RecordKVFormat::CFModifyFlag::DelFlag;
+
+    auto decoding_schema = getDecodingStorageSchemaSnapshot(table_info);
+    RegionBlockReader reader{decoding_schema};
+    Block block = createBlockSortByColumnID(decoding_schema);
+    ASSERT_TRUE(reader.read(block, data_list_read, true));
+    for (size_t pos = 0; pos < block.columns(); pos++)
+    {
+        const auto & column_element = block.getByPosition(pos);
+        ASSERT_EQ(column_element.column->size(), rows);
+        if (fields_map.count(column_element.column_id) == 0)
+            continue;
+        ASSERT_FIELD_EQ((*column_element.column)[0], fields_map.at(column_element.column_id));
+        ASSERT_FIELD_EQ((*column_element.column)[1], column_element.type->getDefault());
+        ASSERT_FIELD_EQ((*column_element.column)[2], fields_map.at(column_element.column_id));
+    }
+}
+
 TEST_F(RegionBlockReaderTest, MissingColumnRowV2)
 {
     auto [table_info, fields] = getNormalTableInfoFields({EXTRA_HANDLE_COLUMN_ID}, false);
@@ -152,6 +152,8 @@ try
     ReadBufferFromFile read_buf(path, DBMS_DEFAULT_BUFFER_SIZE, O_RDONLY);
     auto new_region = Region::deserialize(read_buf);
     ASSERT_REGION_EQ(*new_region, *region);
+    // The commit ts of the writes applied before restarting is not persisted.
+    ASSERT_EQ(new_region->maxAppliedCommitTs(), Region::UNKNOWN_COMMIT_TS);
 }
 CATCH
 